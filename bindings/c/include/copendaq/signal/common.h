@@ -49,6 +49,14 @@ extern "C"
                                                        ///< queue was empty
     } daqPacketReadyNotification;
 
+    typedef enum daqPacketQueueMode
+    {
+        daqPacketQueueModeLocked = 0,              ///< Packets are stored in a mutex protected queue.
+        daqPacketQueueModeLockFreeSingleProducer,  ///< Lock-free ring buffer. Packets must be enqueued from one thread at a time.
+        daqPacketQueueModeLockFreeMultiProducer    ///< Lock-free ring buffer. Producers are serialized among themselves, but never with the
+                                                   ///< consumer.
+    } daqPacketQueueMode;
+
     typedef enum daqPacketType
     {
         daqPacketTypeNone = 0,  ///< Undefined packet type
@@ -54,6 +54,8 @@ extern "C"
     daqErrCode EXPORTED daqInputPortConfig_getGapCheckingEnabled(daqInputPortConfig* self, daqBool* gapCheckingEnabled);
     daqErrCode EXPORTED daqInputPortConfig_notifyPacketEnqueuedWithScheduler(daqInputPortConfig* self);
     daqErrCode EXPORTED daqInputPortConfig_getListener(daqInputPortConfig* self, daqInputPortNotifications** port);
+    daqErrCode EXPORTED daqInputPortConfig_setPacketQueueMode(daqInputPortConfig* self, daqPacketQueueMode mode);
+    daqErrCode EXPORTED daqInputPortConfig_getPacketQueueMode(daqInputPortConfig* self, daqPacketQueueMode* mode);
     daqErrCode EXPORTED daqInputPortConfig_createInputPort(daqInputPortConfig** obj, daqContext* context, daqComponent* parent, daqString* localId, daqBool gapChecking);
 
 #ifdef __cplusplus
@@ -42,6 +42,8 @@ extern "C"
 
     daqErrCode EXPORTED daqInputPortPrivate_disconnectWithoutSignalNotification(daqInputPortPrivate* self);
     daqErrCode EXPORTED daqInputPortPrivate_connectSignalSchedulerNotification(daqInputPortPrivate* self, daqSignal* signal);
+    daqErrCode EXPORTED daqInputPortPrivate_getSchedulerNotificationRequestCount(daqInputPortPrivate* self, daqSizeT* count);
+    daqErrCode EXPORTED daqInputPortPrivate_getSchedulerNotificationRunCount(daqInputPortPrivate* self, daqSizeT* count);
 
 #ifdef __cplusplus
 }
@@ -92,6 +92,16 @@ daqErrCode daqMultiReader_getInputUsed(daqMultiReader* self, daqString* id, daqB
     return reinterpret_cast<daq::IMultiReader*>(self)->getInputUsed(reinterpret_cast<daq::IString*>(id), isUsed);
 }
 
+daqErrCode daqMultiReader_readPlanar(daqMultiReader* self, void* samples, daqSizeT* count, daqSizeT timeoutMs, daqMultiReaderStatus** status)
+{
+    return reinterpret_cast<daq::IMultiReader*>(self)->readPlanar(samples, count, timeoutMs, reinterpret_cast<daq::IMultiReaderStatus**>(status));
+}
+
+daqErrCode daqMultiReader_readInterleaved(daqMultiReader* self, void* samples, daqSizeT* count, daqSizeT timeoutMs, daqMultiReaderStatus** status)
+{
+    return reinterpret_cast<daq::IMultiReader*>(self)->readInterleaved(samples, count, timeoutMs, reinterpret_cast<daq::IMultiReaderStatus**>(status));
+}
+
 daqErrCode daqMultiReader_createMultiReader(daqMultiReader** obj, daqList* signals, daqSampleType valueReadType, daqSampleType domainReadType, daqReadMode mode, daqReadTimeoutType timeoutType)
 {
     daq::IMultiReader* ptr = nullptr;
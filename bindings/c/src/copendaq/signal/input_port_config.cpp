@@ -77,6 +77,16 @@ daqErrCode daqInputPortConfig_getListener(daqInputPortConfig* self, daqInputPort
     return reinterpret_cast<daq::IInputPortConfig*>(self)->getListener(reinterpret_cast<daq::IInputPortNotifications**>(port));
 }
 
+daqErrCode daqInputPortConfig_setPacketQueueMode(daqInputPortConfig* self, daqPacketQueueMode mode)
+{
+    return reinterpret_cast<daq::IInputPortConfig*>(self)->setPacketQueueMode(static_cast<daq::PacketQueueMode>(mode));
+}
+
+daqErrCode daqInputPortConfig_getPacketQueueMode(daqInputPortConfig* self, daqPacketQueueMode* mode)
+{
+    return reinterpret_cast<daq::IInputPortConfig*>(self)->getPacketQueueMode(reinterpret_cast<daq::PacketQueueMode*>(mode));
+}
+
 daqErrCode daqInputPortConfig_createInputPort(daqInputPortConfig** obj, daqContext* context, daqComponent* parent, daqString* localId, daqBool gapChecking)
 {
     daq::IInputPortConfig* ptr = nullptr;
@@ -31,3 +31,13 @@ daqErrCode daqInputPortPrivate_connectSignalSchedulerNotification(daqInputPortPr
 {
     return reinterpret_cast<daq::IInputPortPrivate*>(self)->connectSignalSchedulerNotification(reinterpret_cast<daq::ISignal*>(signal));
 }
+
+daqErrCode daqInputPortPrivate_getSchedulerNotificationRequestCount(daqInputPortPrivate* self, daqSizeT* count)
+{
+    return reinterpret_cast<daq::IInputPortPrivate*>(self)->getSchedulerNotificationRequestCount(count);
+}
+
+daqErrCode daqInputPortPrivate_getSchedulerNotificationRunCount(daqInputPortPrivate* self, daqSizeT* count)
+{
+    return reinterpret_cast<daq::IInputPortPrivate*>(self)->getSchedulerNotificationRunCount(count);
+}
@@ -87,6 +87,33 @@ void defineIBlockReader(pybind11::module_ m, PyDaqIntf<daq::IBlockReader, daq::I
         "Copies at maximum the next `count` blocks of unread samples and clock-stamps to the `dataBlocks` and `domainBlocks` buffers."
         "The amount actually read is returned through the `count` parameter.");
 
+    cls.def(
+        "read_into",
+        [](daq::IBlockReader* object, py::array values, const size_t timeoutMs, bool returnStatus)
+        {
+            return PyTypedReader::readValuesInto(daq::BlockReaderPtr::Borrow(object), values, timeoutMs, returnStatus);
+        },
+        py::arg("values").noconvert(),
+        py::arg("timeout_ms") = 0,
+        py::arg("return_status") = false,
+        "Reads at maximum as many blocks as fit into the preallocated `values` array of shape (blocks, block_size) directly "
+        "into it, without intermediate copies. Returns the amount of blocks actually read. The GIL is released while waiting "
+        "for and copying the samples.");
+
+    cls.def(
+        "read_with_domain_into",
+        [](daq::IBlockReader* object, py::array values, py::array domain, const size_t timeoutMs, bool returnStatus)
+        {
+            return PyTypedReader::readValuesWithDomainInto(daq::BlockReaderPtr::Borrow(object), values, domain, timeoutMs, returnStatus);
+        },
+        py::arg("values").noconvert(),
+        py::arg("domain").noconvert(),
+        py::arg("timeout_ms") = 0,
+        py::arg("return_status") = false,
+        "Reads at maximum as many blocks of samples and clock-stamps as fit into the preallocated `values` and `domain` arrays "
+        "of shape (blocks, block_size) directly into them, without intermediate copies. Returns the amount of blocks actually "
+        "read. The GIL is released while waiting for and copying the samples.");
+
     cls.def_property_readonly(
         "block_size",
         [](daq::IBlockReader* object)
@@ -61,6 +61,22 @@ void defineIMultiReader(pybind11::module_ m, PyDaqIntf<daq::IMultiReader, daq::I
         },
         py::arg("count"), py::arg("timeout_ms") = 0, py::arg("return_status") = false,
         "Copies at maximum the next `count` unread samples and clock-stamps to the `samples` and `domain` buffers. The amount actually read is returned through the `count` parameter.");
+    cls.def("read_into",
+        [](daq::IMultiReader *object, py::array values, const size_t timeoutMs, bool returnStatus)
+        {
+            const auto objectPtr = daq::MultiReaderPtr::Borrow(object);
+            return PyTypedReader::readValuesInto(objectPtr, values, timeoutMs, returnStatus);
+        },
+        py::arg("values").noconvert(), py::arg("timeout_ms") = 0, py::arg("return_status") = false,
+        "Reads at maximum as many unread samples as fit into the rows of the preallocated 2-D `values` array directly into it, one row per signal, without intermediate copies. Returns the amount of samples actually read per signal. The GIL is released while waiting for and copying the samples.");
+    cls.def("read_with_domain_into",
+        [](daq::IMultiReader *object, py::array values, py::array domain, const size_t timeoutMs, bool returnStatus)
+        {
+            const auto objectPtr = daq::MultiReaderPtr::Borrow(object);
+            return PyTypedReader::readValuesWithDomainInto(objectPtr, values, domain, timeoutMs, returnStatus);
+        },
+        py::arg("values").noconvert(), py::arg("domain").noconvert(), py::arg("timeout_ms") = 0, py::arg("return_status") = false,
+        "Reads at maximum as many unread samples and clock-stamps as fit into the rows of the preallocated 2-D `values` and `domain` arrays directly into them, one row per signal, without intermediate copies. Returns the amount of samples actually read per signal. The GIL is released while waiting for and copying the samples.");
     cls.def("skip_samples",
         [](daq::IMultiReader *object, size_t count, bool returnStatus)
         {
@@ -87,6 +87,31 @@ void defineIStreamReader(pybind11::module_ m, PyDaqIntf<daq::IStreamReader, daq:
         py::arg("return_status") = false,
         "Copies at maximum the next `count` unread samples and clock-stamps to the `values` and `stamps` buffers. The amount actually read "
         "is returned through the `count` parameter.");
+    cls.def(
+        "read_into",
+        [](daq::IStreamReader* object, py::array values, const size_t timeoutMs, bool returnStatus)
+        {
+            return PyTypedReader::readValuesInto(daq::StreamReaderPtr::Borrow(object), values, timeoutMs, returnStatus);
+        },
+        py::arg("values").noconvert(),
+        py::arg("timeout_ms") = 0,
+        py::arg("return_status") = false,
+        "Reads at maximum as many unread samples as fit into the preallocated one-dimensional `values` array directly into it, "
+        "without intermediate copies. Returns the amount of samples actually read. The GIL is released while waiting for and "
+        "copying the samples.");
+    cls.def(
+        "read_with_domain_into",
+        [](daq::IStreamReader* object, py::array values, py::array domain, const size_t timeoutMs, bool returnStatus)
+        {
+            return PyTypedReader::readValuesWithDomainInto(daq::StreamReaderPtr::Borrow(object), values, domain, timeoutMs, returnStatus);
+        },
+        py::arg("values").noconvert(),
+        py::arg("domain").noconvert(),
+        py::arg("timeout_ms") = 0,
+        py::arg("return_status") = false,
+        "Reads at maximum as many unread samples and clock-stamps as fit into the preallocated `values` and `domain` arrays "
+        "directly into them, without intermediate copies. Returns the amount of samples actually read. The GIL is released "
+        "while waiting for and copying the samples.");
     cls.def(
         "skip_samples",
         [](daq::IStreamReader* object, size_t count, bool returnStatus)
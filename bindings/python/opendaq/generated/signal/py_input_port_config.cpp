@@ -40,6 +40,11 @@ PyDaqIntf<daq::IInputPortConfig, daq::IInputPort> declareIInputPortConfig(pybind
         .value("SchedulerQueueWasEmpty", daq::PacketReadyNotification::SchedulerQueueWasEmpty)
         .value("Unspecified", daq::PacketReadyNotification::Unspecified);
 
+    py::enum_<daq::PacketQueueMode>(m, "PacketQueueMode")
+        .value("Locked", daq::PacketQueueMode::Locked)
+        .value("LockFreeSingleProducer", daq::PacketQueueMode::LockFreeSingleProducer)
+        .value("LockFreeMultiProducer", daq::PacketQueueMode::LockFreeMultiProducer);
+
     return wrapInterface<daq::IInputPortConfig, daq::IInputPort>(m, "IInputPortConfig");
 }
 
@@ -132,4 +137,18 @@ void defineIInputPortConfig(pybind11::module_ m, PyDaqIntf<daq::IInputPortConfig
             objectPtr.notifyPacketEnqueuedWithScheduler();
         },
         "Gets called when a packet was enqueued in a connection.");
+    cls.def_property("packet_queue_mode",
+        [](daq::IInputPortConfig *object)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            return objectPtr.getPacketQueueMode();
+        },
+        [](daq::IInputPortConfig *object, daq::PacketQueueMode mode)
+        {
+            py::gil_scoped_release release;
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            objectPtr.setPacketQueueMode(mode);
+        },
+        "Gets the packet queue implementation used by connections of the input port. / Sets the packet queue implementation used by connections of the input port.");
 }
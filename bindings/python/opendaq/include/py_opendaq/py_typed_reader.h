@@ -17,8 +17,10 @@
 #pragma once
 
 #include <cstddef>
+#include <string>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include "coretypes/exceptions.h"
 #include "opendaq/block_reader_ptr.h"
@@ -194,6 +196,101 @@ struct PyTypedReader
         }
     }
 
+    // Reads directly into the caller-provided `values` array without intermediate buffers. Must be called
+    // with the GIL held; the GIL is released while waiting for and copying the samples.
+    template <typename ReaderType>
+    static inline SizeReaderStatusVariant<ReaderType> readValuesInto(const ReaderType& reader,
+                                                                     py::array& values,
+                                                                     size_t timeoutMs,
+                                                                     bool returnStatus)
+    {
+        daq::SampleType valueType = daq::SampleType::Undefined;
+        reader->getValueReadType(&valueType);
+
+        const daq::DataDescriptorPtr dataDescriptor = getDescriptor<ReaderType>(reader, VALUE_DATA_DESCRIPTOR_ATTRIBUTE);
+        switch (valueType)
+        {
+            case daq::SampleType::Float32:
+                return readInto<daq::SampleTypeToType<daq::SampleType::Float32>::Type>(reader, values, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Float64:
+                return readInto<daq::SampleTypeToType<daq::SampleType::Float64>::Type>(reader, values, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::UInt32:
+                return readInto<daq::SampleTypeToType<daq::SampleType::UInt32>::Type>(reader, values, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Int32:
+                return readInto<daq::SampleTypeToType<daq::SampleType::Int32>::Type>(reader, values, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::UInt64:
+                return readInto<daq::SampleTypeToType<daq::SampleType::UInt64>::Type>(reader, values, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Int64:
+                return readInto<daq::SampleTypeToType<daq::SampleType::Int64>::Type>(reader, values, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::UInt8:
+                return readInto<daq::SampleTypeToType<daq::SampleType::UInt8>::Type>(reader, values, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Int8:
+                return readInto<daq::SampleTypeToType<daq::SampleType::Int8>::Type>(reader, values, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::UInt16:
+                return readInto<daq::SampleTypeToType<daq::SampleType::UInt16>::Type>(reader, values, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Int16:
+                return readInto<daq::SampleTypeToType<daq::SampleType::Int16>::Type>(reader, values, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Struct:
+            case daq::SampleType::Undefined:
+            case daq::SampleType::RangeInt64:
+            case daq::SampleType::ComplexFloat64:
+            case daq::SampleType::ComplexFloat32:
+            case daq::SampleType::Binary:
+            case daq::SampleType::String:
+            default:
+                DAQ_THROW_EXCEPTION(daq::InvalidParameterException,
+                                    "Reading into an array requires a numeric value read type, got: " + convertSampleTypeToString(valueType));
+        }
+    }
+
+    // Reads directly into the caller-provided `values` and `domain` arrays without intermediate buffers. Must be
+    // called with the GIL held; the GIL is released while waiting for and copying the samples.
+    template <typename ReaderType>
+    static inline SizeReaderStatusVariant<ReaderType> readValuesWithDomainInto(const ReaderType& reader,
+                                                                               py::array& values,
+                                                                               py::array& domain,
+                                                                               size_t timeoutMs,
+                                                                               bool returnStatus)
+    {
+        daq::SampleType valueType = daq::SampleType::Undefined;
+        reader->getValueReadType(&valueType);
+
+        const daq::DataDescriptorPtr dataDescriptor = getDescriptor<ReaderType>(reader, VALUE_DATA_DESCRIPTOR_ATTRIBUTE);
+        switch (valueType)
+        {
+            case daq::SampleType::Float32:
+                return readWithDomainInto<daq::SampleTypeToType<daq::SampleType::Float32>::Type>(reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Float64:
+                return readWithDomainInto<daq::SampleTypeToType<daq::SampleType::Float64>::Type>(reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::UInt32:
+                return readWithDomainInto<daq::SampleTypeToType<daq::SampleType::UInt32>::Type>(reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Int32:
+                return readWithDomainInto<daq::SampleTypeToType<daq::SampleType::Int32>::Type>(reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::UInt64:
+                return readWithDomainInto<daq::SampleTypeToType<daq::SampleType::UInt64>::Type>(reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Int64:
+                return readWithDomainInto<daq::SampleTypeToType<daq::SampleType::Int64>::Type>(reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::UInt8:
+                return readWithDomainInto<daq::SampleTypeToType<daq::SampleType::UInt8>::Type>(reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Int8:
+                return readWithDomainInto<daq::SampleTypeToType<daq::SampleType::Int8>::Type>(reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::UInt16:
+                return readWithDomainInto<daq::SampleTypeToType<daq::SampleType::UInt16>::Type>(reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Int16:
+                return readWithDomainInto<daq::SampleTypeToType<daq::SampleType::Int16>::Type>(reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Struct:
+            case daq::SampleType::Undefined:
+            case daq::SampleType::RangeInt64:
+            case daq::SampleType::ComplexFloat64:
+            case daq::SampleType::ComplexFloat32:
+            case daq::SampleType::Binary:
+            case daq::SampleType::String:
+            default:
+                DAQ_THROW_EXCEPTION(daq::InvalidParameterException,
+                                    "Reading into an array requires a numeric value read type, got: " + convertSampleTypeToString(valueType));
+        }
+    }
+
     static inline void checkTypes(daq::SampleType valueType, daq::SampleType domainType)
     {
         checkSampleType(valueType);
@@ -566,6 +663,224 @@ private:
                    : SampleTypeDomainTypeReaderStatusVariant<ReaderType>{std::make_tuple(std::move(valuesArray), std::move(domainArray))};
     }
 
+    template <typename ValueType, typename ReaderType>
+    static inline SizeReaderStatusVariant<ReaderType> readWithDomainInto(const ReaderType& reader,
+                                                                         py::array& values,
+                                                                         py::array& domain,
+                                                                         size_t timeoutMs,
+                                                                         bool returnStatus,
+                                                                         const daq::DataDescriptorPtr& dataDescriptor)
+    {
+        daq::SampleType domainType = daq::SampleType::Undefined;
+        reader->getDomainReadType(&domainType);
+
+        switch (domainType)
+        {
+            case daq::SampleType::Float32:
+                return readInto<ValueType, daq::SampleTypeToType<daq::SampleType::Float32>::Type>(
+                    reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Float64:
+                return readInto<ValueType, daq::SampleTypeToType<daq::SampleType::Float64>::Type>(
+                    reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::UInt32:
+                return readInto<ValueType, daq::SampleTypeToType<daq::SampleType::UInt32>::Type>(
+                    reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Int32:
+                return readInto<ValueType, daq::SampleTypeToType<daq::SampleType::Int32>::Type>(
+                    reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::UInt64:
+                return readInto<ValueType, daq::SampleTypeToType<daq::SampleType::UInt64>::Type>(
+                    reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Int64:
+                return readInto<ValueType, daq::SampleTypeToType<daq::SampleType::Int64>::Type>(
+                    reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::UInt8:
+                return readInto<ValueType, daq::SampleTypeToType<daq::SampleType::UInt8>::Type>(
+                    reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Int8:
+                return readInto<ValueType, daq::SampleTypeToType<daq::SampleType::Int8>::Type>(
+                    reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::UInt16:
+                return readInto<ValueType, daq::SampleTypeToType<daq::SampleType::UInt16>::Type>(
+                    reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Int16:
+                return readInto<ValueType, daq::SampleTypeToType<daq::SampleType::Int16>::Type>(
+                    reader, values, domain, timeoutMs, returnStatus, dataDescriptor);
+            case daq::SampleType::Undefined:
+            case daq::SampleType::RangeInt64:
+            case daq::SampleType::ComplexFloat64:
+            case daq::SampleType::ComplexFloat32:
+            case daq::SampleType::Binary:
+            case daq::SampleType::String:
+            case daq::SampleType::Struct:
+            default:
+                DAQ_THROW_EXCEPTION(daq::InvalidParameterException,
+                                    "Reading into an array requires a numeric domain read type, got: " + convertSampleTypeToString(domainType));
+        }
+    }
+
+    template <typename ValueType, typename ReaderType>
+    static inline SizeReaderStatusVariant<ReaderType> readInto(const ReaderType& reader,
+                                                               py::array& values,
+                                                               [[maybe_unused]] size_t timeoutMs,
+                                                               bool returnStatus,
+                                                               const daq::DataDescriptorPtr& dataDescriptor)
+    {
+        constexpr const bool isMultiReader = std::is_base_of_v<daq::MultiReaderPtr, ReaderType>;
+
+        const size_t blockSize = getBlockSize(reader);
+        const size_t valuesPerSample = getValuesPerSample(dataDescriptor);
+        size_t count = getTargetCapacity<ValueType, ReaderType>(values, blockSize, valuesPerSample, "values");
+
+        using StatusType = typename daq::ReaderStatusType<ReaderType>::Type;
+        StatusType status;
+        if constexpr (isMultiReader)
+        {
+            // One pointer per signal, each pointing to a row of the caller's array.
+            std::vector<void*> ptrs = getRowPointers(values, blockSize);
+            py::gil_scoped_release release;
+            daq::checkErrorInfo(reader->read(ptrs.data(), &count, timeoutMs, &status));
+        }
+        else
+        {
+            void* ptr = values.mutable_data();
+            py::gil_scoped_release release;
+            if constexpr (ReaderHasReadWithTimeout<ReaderType>::value)
+                daq::checkErrorInfo(reader->read(ptr, &count, timeoutMs, &status));
+            else
+                daq::checkErrorInfo(reader->read(ptr, &count, &status));
+        }
+
+        // update descriptors if changed
+        assignDescriptorsFromStatus(reader, status);
+
+        return returnStatus ? SizeReaderStatusVariant<ReaderType>{std::make_tuple(count, status.detach())}
+                            : SizeReaderStatusVariant<ReaderType>{count};
+    }
+
+    template <typename ValueType, typename DomainType, typename ReaderType>
+    static inline SizeReaderStatusVariant<ReaderType> readInto(const ReaderType& reader,
+                                                               py::array& values,
+                                                               py::array& domain,
+                                                               [[maybe_unused]] size_t timeoutMs,
+                                                               bool returnStatus,
+                                                               const daq::DataDescriptorPtr& dataDescriptor)
+    {
+        constexpr const bool isMultiReader = std::is_base_of_v<daq::MultiReaderPtr, ReaderType>;
+
+        const size_t blockSize = getBlockSize(reader);
+        const size_t valuesPerSample = getValuesPerSample(dataDescriptor);
+        size_t count = getTargetCapacity<ValueType, ReaderType>(values, blockSize, valuesPerSample, "values");
+        if (getTargetCapacity<DomainType, ReaderType>(domain, blockSize, 1, "domain") != count)
+            DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "The values and domain arrays must hold the same number of samples.");
+
+        using StatusType = typename daq::ReaderStatusType<ReaderType>::Type;
+        StatusType status;
+        if constexpr (isMultiReader)
+        {
+            std::vector<void*> valuesPtrs = getRowPointers(values, blockSize);
+            std::vector<void*> domainPtrs = getRowPointers(domain, blockSize);
+            py::gil_scoped_release release;
+            daq::checkErrorInfo(reader->readWithDomain(valuesPtrs.data(), domainPtrs.data(), &count, timeoutMs, &status));
+        }
+        else
+        {
+            void* valuesPtr = values.mutable_data();
+            void* domainPtr = domain.mutable_data();
+            py::gil_scoped_release release;
+            if constexpr (ReaderHasReadWithTimeout<ReaderType>::value)
+                daq::checkErrorInfo(reader->readWithDomain(valuesPtr, domainPtr, &count, timeoutMs, &status));
+            else
+                daq::checkErrorInfo(reader->readWithDomain(valuesPtr, domainPtr, &count, &status));
+        }
+
+        // update descriptors if changed
+        assignDescriptorsFromStatus(reader, status);
+
+        return returnStatus ? SizeReaderStatusVariant<ReaderType>{std::make_tuple(count, status.detach())}
+                            : SizeReaderStatusVariant<ReaderType>{count};
+    }
+
+    template <typename ReaderType>
+    static inline size_t getBlockSize(const ReaderType& reader)
+    {
+        size_t blockSize = 1;
+        if constexpr (std::is_base_of_v<daq::BlockReaderPtr, ReaderType>)
+        {
+            reader->getBlockSize(&blockSize);
+        }
+        if constexpr (std::is_base_of_v<daq::MultiReaderPtr, ReaderType>)
+        {
+            // Block size denotes the number of signals that are being read.
+            daq::ReaderConfigPtr readerConfig = reader.template asPtr<daq::IReaderConfig>();
+            blockSize = readerConfig.getInputPorts().getCount();
+        }
+        return blockSize;
+    }
+
+    static inline size_t getValuesPerSample(const daq::DataDescriptorPtr& dataDescriptor)
+    {
+        if (!dataDescriptor.assigned() || !dataDescriptor.getDimensions().assigned())
+            return 1;
+
+        auto dimensions = dataDescriptor.getDimensions();
+        if (dimensions.getCount() > 1)
+            throw std::runtime_error("Typed reading: cannot read matrix/tensor data.");
+        return dimensions.getCount() == 1 ? static_cast<size_t>(dimensions[0].getSize()) : 1;
+    }
+
+    // Checks that the reader can write into `target` directly and returns the number of samples (blocks for
+    // the BlockReader) that fit into it. Stream readers take a contiguous 1-D array, block readers a contiguous
+    // array of shape (blocks, blockSize * valuesPerSample) and multi readers an array of shape
+    // (signals, samples * valuesPerSample) where each row is contiguous.
+    template <typename SampleType, typename ReaderType>
+    static inline size_t getTargetCapacity(const py::array& target, size_t blockSize, size_t valuesPerSample, const std::string& name)
+    {
+        if (!py::isinstance<py::array_t<SampleType>>(target))
+            DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "The dtype of the " + name + " array does not match the read type.");
+        if (!target.writeable())
+            DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "The " + name + " array is not writeable.");
+
+        size_t capacity = 0;
+        if constexpr (std::is_base_of_v<daq::MultiReaderPtr, ReaderType>)
+        {
+            if (target.ndim() != 2 || static_cast<size_t>(target.shape(0)) != blockSize)
+                DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "The " + name + " array must have one row per signal.");
+            if (target.shape(1) > 1 && target.strides(1) != static_cast<py::ssize_t>(sizeof(SampleType)))
+                DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "The rows of the " + name + " array must be contiguous.");
+            capacity = static_cast<size_t>(target.shape(1));
+        }
+        else
+        {
+            if (!(target.flags() & py::array::c_style))
+                DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "The " + name + " array must be C-contiguous.");
+
+            if constexpr (std::is_base_of_v<daq::BlockReaderPtr, ReaderType>)
+            {
+                if (target.ndim() != 2 || static_cast<size_t>(target.shape(1)) != blockSize * valuesPerSample)
+                    DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "The " + name + " array must have one row per block.");
+                return static_cast<size_t>(target.shape(0));
+            }
+
+            if (target.ndim() != 1)
+                DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "The " + name + " array must be one-dimensional.");
+            capacity = static_cast<size_t>(target.shape(0));
+        }
+
+        if (capacity % valuesPerSample != 0)
+            DAQ_THROW_EXCEPTION(daq::InvalidParameterException, "The " + name + " array does not hold a whole number of samples.");
+        return capacity / valuesPerSample;
+    }
+
+    static inline std::vector<void*> getRowPointers(py::array& target, size_t rowCount)
+    {
+        auto* data = static_cast<uint8_t*>(target.mutable_data());
+        std::vector<void*> ptrs(rowCount);
+        for (size_t i = 0; i < rowCount; i++)
+            ptrs[i] = data + static_cast<py::ssize_t>(i) * target.strides(0);
+        return ptrs;
+    }
+
     template <typename ReaderType>
     static inline typename daq::ReaderStatusType<ReaderType>::Type readZeroValues(const ReaderType& reader, [[maybe_unused]] size_t timeoutMs)
     {
@@ -683,5 +683,76 @@ class TestReaderDateTime(opendaq_test.TestCase):
             self.assertIsInstance(v, numpy.int64)
 
 
+    def test_read_into(self):
+        mock = opendaq.MockSignal()
+        reader = opendaq.StreamReader(mock.signal)
+        reader.read(0)
+
+        values = numpy.zeros(16, dtype=numpy.float64)
+        domain = numpy.zeros(16, dtype=numpy.int64)
+
+        mock.add_data(numpy.arange(10))
+        count, status = reader.read_into(values, return_status=True)
+        self.assertTrue(status.read_status == opendaq.ReadStatus.Ok)
+        self.assertEqual(count, 10)
+        self.assertTrue(numpy.array_equal(values[:count], numpy.arange(10)))
+
+        # the same arrays are reused for subsequent reads
+        mock.add_data(numpy.arange(10, 20))
+        count = reader.read_with_domain_into(values, domain)
+        self.assertEqual(count, 10)
+        self.assertTrue(numpy.array_equal(values[:count], numpy.arange(10, 20)))
+
+        with self.assertRaises(RuntimeError):
+            reader.read_into(numpy.zeros(16, dtype=numpy.float32))
+        with self.assertRaises(TypeError):
+            reader.read_into([0.0] * 16)
+
+    def test_block_read_into(self):
+        mock = opendaq.MockSignal()
+        reader = opendaq.BlockReader(mock.signal, 2)
+        reader.read(0)
+
+        mock.add_data(numpy.arange(10))
+        values = numpy.zeros((5, 2), dtype=numpy.float64)
+        domain = numpy.zeros((5, 2), dtype=numpy.int64)
+        count = reader.read_with_domain_into(values, domain)
+        self.assertEqual(count, 5)
+        self.assertTrue(numpy.array_equal(
+            values, numpy.arange(10).reshape(5, 2)))
+
+        with self.assertRaises(RuntimeError):
+            reader.read_into(numpy.zeros((5, 3), dtype=numpy.float64))
+
+    def test_multireader_read_into(self):
+        epoch = opendaq.MockSignal.current_epoch()
+
+        sig1 = opendaq.MockSignal('sig1', epoch)
+        sig2 = opendaq.MockSignal('sig2', epoch)
+
+        builder = opendaq.MultiReaderBuilder()
+        builder.input_port_notification_method = opendaq.PacketReadyNotification.SameThread
+        builder.add_signal(sig1.signal)
+        builder.add_signal(sig2.signal)
+        reader = builder.build()
+        reader.read(0)
+
+        nparray = numpy.arange(10)
+        sig1.add_data(nparray)
+        sig2.add_data(nparray)
+
+        # rows only need to be contiguous, so a slice of a larger buffer can be read into
+        buffer = numpy.zeros((2, 20), dtype=numpy.float64)
+        domain = numpy.zeros((2, 10), dtype=numpy.int64)
+        count, status = reader.read_with_domain_into(
+            buffer[:, :10], domain, return_status=True)
+        self.assertTrue(status.read_status == opendaq.ReadStatus.Ok)
+        self.assertEqual(count, 10)
+        self.assertTrue(numpy.array_equal(buffer[0, :10], nparray))
+        self.assertTrue(numpy.array_equal(buffer[1, :10], nparray))
+
+        with self.assertRaises(RuntimeError):
+            reader.read_into(numpy.zeros((3, 10), dtype=numpy.float64))
+
 if __name__ == '__main__':
     unittest.main()
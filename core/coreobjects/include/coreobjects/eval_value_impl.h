@@ -15,6 +15,9 @@
  */
 
 #pragma once
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 #include <coretypes/coretypes.h>
 #include <coreobjects/eval_value.h>
@@ -28,6 +31,33 @@ BEGIN_NAMESPACE_OPENDAQ
 
 struct ISerializedObject;
 
+/*!
+ * @brief Memoized results of an eval value, shared by the eval value and all its owner-bound clones.
+ *
+ * Results are stored per owner together with the owner's value revision at the time of evaluation.
+ * A stored result is valid only while the owner is alive and its value revision is unchanged.
+ */
+class EvalValueResultCache
+{
+public:
+    bool tryGet(const PropertyObjectPtr& owner, SizeT revision, BaseObjectPtr& result);
+    void store(const PropertyObjectPtr& owner, SizeT revision, const BaseObjectPtr& result);
+
+private:
+    struct Entry
+    {
+        WeakRefPtr<IPropertyObject> owner;
+        SizeT revision;
+        BaseObjectPtr result;
+    };
+
+    void removeExpiredEntries();
+
+    std::mutex sync;
+    std::unordered_map<IPropertyObject*, Entry> entries;
+    SizeT pruneThreshold = 16;
+};
+
 class EvalValueImpl : public ImplementationOf<IEvalValue, IOwnable, ICoreType, IInteger_Helper, ISerializable, IFloat_Helper,
                                               IBoolean_Helper, IString_Helper, IConvertible, IList, INumber, IProperty_Helper, 
                                               IUnit_Helper, IStruct_Helper, IDict>
@@ -170,8 +200,11 @@ public:
 
 private:
     StringPtr eval;
-    std::unique_ptr<BaseNode> node;
-    std::unique_ptr<std::unordered_set<std::string>> propertyReferences;
+    std::shared_ptr<BaseNode> node;
+    std::shared_ptr<BaseNode> sourceNode;
+    std::once_flag nodeCloned;
+    std::shared_ptr<std::unordered_set<std::string>> propertyReferences;
+    std::shared_ptr<EvalValueResultCache> resultCache;
     ListPtr<IBaseObject> arguments;
     WeakRefPtr<IPropertyObject> owner;
     StringPtr ownerRefStr;
@@ -181,12 +214,18 @@ private:
     std::string parseErrMessage;
     bool calculated;
     bool useFunctionResolver;
+    bool hasReferences;
     FunctionPtr func;
 
     BaseObjectPtr getReference(const std::string& str, RefType refType, int argIndex, std::string& postRef, bool lock) const;
     int resolveReferences(bool lock);
 
     ErrCode checkParseAndResolve(bool lock);
+    ErrCode getResultInternal(BaseObjectPtr& result, bool lock);
+
+    void cloneSourceNode();
+    bool getOwnerRevision(PropertyObjectPtr& ownerRef, SizeT& revision) const;
+    static BaseObjectPtr copyContainerResult(const BaseObjectPtr& result);
 
     template <typename T>
     inline ErrCode getValueInternal(T& value);
@@ -0,0 +1,334 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/baseobject.h>
+#include <coretypes/weakrefptr.h>
+#include <coreobjects/property_object_ptr.h>
+#include <coreobjects/property_internal_ptr.h>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup objects_property_object
+ * @addtogroup objects_property_handle PropertyHandle
+ * @{
+ */
+
+/*!
+ * @brief Internal functions used by openDAQ core. This interface should never be used in
+ * client SDK or module code.
+ *
+ * Gives access to property values through slots resolved once by name. Slots are valid for as long as
+ * the layout revision of the object does not change. The layout revision is incremented when a property
+ * is added or removed, or when a child Property object is replaced.
+ */
+DECLARE_OPENDAQ_INTERFACE(IPropertyValueSlots, IBaseObject)
+{
+    /*!
+     * @brief Resolves the name of a local property into a value slot.
+     * @param propertyName The name of the property. Must not contain a dot or an index.
+     * @param[out] slot The value slot of the property.
+     * @param[out] layoutRevision The layout revision the slot belongs to.
+     * @retval OPENDAQ_IGNORED if the value of the property cannot be read through a slot and must be
+     * read with `getPropertyValue` instead.
+     * @retval OPENDAQ_ERR_NOTFOUND if the property does not exist.
+     */
+    virtual ErrCode INTERFACE_FUNC resolveValueSlot(IString* propertyName, SizeT* slot, SizeT* layoutRevision) = 0;
+
+    /*!
+     * @brief Gets the value of the property in a slot, as returned by `getPropertyValue`.
+     * @param slot The value slot of the property.
+     * @param layoutRevision The layout revision the slot was resolved with.
+     * @param[out] value The property value.
+     * @retval OPENDAQ_IGNORED if the layout revision changed and the slot must be resolved again.
+     */
+    virtual ErrCode INTERFACE_FUNC getValueSlot(SizeT slot, SizeT layoutRevision, IBaseObject** value) = 0;
+
+    /*!
+     * @brief Gets the current layout revision of the object.
+     * @param[out] layoutRevision The layout revision.
+     */
+    virtual ErrCode INTERFACE_FUNC getLayoutRevision(SizeT* layoutRevision) = 0;
+};
+
+/*!
+ * @brief Property path resolved once for repeated access to its value.
+ *
+ * The path is split into the Property objects it passes through only when the handle is created, or when
+ * the layout of one of these objects changes. Reading the value afterwards does not parse the path or look
+ * up the property by name. Read events are triggered as with `getPropertyValue`.
+ *
+ * Values are written through `setPropertyValue` of the object that owns the property, so all validation and
+ * write events are kept. If the property is removed, the handle becomes invalid and accessing the value throws
+ * a NotFoundException. The handle holds only a weak reference to the object it was created with, so an object
+ * can keep handles to its own properties.
+ *
+ * Paths through reference properties, indexed paths and objects that do not support value slots fall back
+ * to `getPropertyValue` with the full path.
+ *
+ * A handle is not thread-safe. Threads that read the same property should each use their own handle.
+ */
+class PropertyHandle
+{
+public:
+    PropertyHandle() = default;
+    PropertyHandle(const PropertyObjectPtr& object, const StringPtr& path);
+
+    /*!
+     * @brief Gets the value of the property.
+     */
+    BaseObjectPtr getValue();
+
+    /*!
+     * @brief Gets the value of the property converted to `T`.
+     */
+    template <typename T>
+    T getValueAs();
+
+    /*!
+     * @brief Sets the value of the property.
+     */
+    void setValue(const BaseObjectPtr& value);
+
+    /*!
+     * @brief Checks whether the handle refers to an existing property.
+     */
+    bool isValid();
+
+    /*!
+     * @brief Gets the path of the property relative to the object the handle was created with.
+     */
+    StringPtr getPath() const;
+
+private:
+    struct PathLevel
+    {
+        // not set for the root object, which is referenced weakly
+        PropertyObjectPtr object;
+        IPropertyValueSlots* slots;
+        SizeT layoutRevision;
+    };
+
+    PropertyObjectPtr getRoot() const;
+    bool isResolved() const;
+    void resolve(const PropertyObjectPtr& rootObj);
+    PropertyObjectPtr getLeaf(const PropertyObjectPtr& rootObj) const;
+
+    WeakRefPtr<IPropertyObject> root;
+    StringPtr path;
+    StringPtr name;
+    std::vector<PathLevel> levels;
+    SizeT slot{};
+    bool hasSlot{};
+    bool dynamic{};
+    bool resolved{};
+};
+
+/*!@}*/
+
+inline PropertyHandle::PropertyHandle(const PropertyObjectPtr& object, const StringPtr& path)
+    : root(object)
+    , path(path)
+{
+    if (!object.assigned())
+        DAQ_THROW_EXCEPTION(ArgumentNullException, "Property object must not be null");
+    if (!path.assigned())
+        DAQ_THROW_EXCEPTION(ArgumentNullException, "Property path must not be null");
+
+    resolve(object);
+}
+
+inline BaseObjectPtr PropertyHandle::getValue()
+{
+    const auto rootObj = getRoot();
+    if (!isResolved())
+        resolve(rootObj);
+
+    if (dynamic)
+        return rootObj.getPropertyValue(path);
+
+    if (hasSlot)
+    {
+        BaseObjectPtr value;
+        ErrCode errCode = levels.back().slots->getValueSlot(slot, levels.back().layoutRevision, &value);
+        checkErrorInfo(errCode);
+        if (errCode == OPENDAQ_SUCCESS)
+            return value;
+
+        // the layout changed between the revision check and the read
+        resolve(rootObj);
+        if (dynamic)
+            return rootObj.getPropertyValue(path);
+
+        if (hasSlot)
+        {
+            errCode = levels.back().slots->getValueSlot(slot, levels.back().layoutRevision, &value);
+            checkErrorInfo(errCode);
+            if (errCode == OPENDAQ_SUCCESS)
+                return value;
+        }
+    }
+
+    return getLeaf(rootObj).getPropertyValue(name);
+}
+
+template <typename T>
+T PropertyHandle::getValueAs()
+{
+    return static_cast<T>(getValue());
+}
+
+inline void PropertyHandle::setValue(const BaseObjectPtr& value)
+{
+    const auto rootObj = getRoot();
+    if (!isResolved())
+        resolve(rootObj);
+
+    if (dynamic)
+        rootObj.setPropertyValue(path, value);
+    else
+        getLeaf(rootObj).setPropertyValue(name, value);
+}
+
+inline bool PropertyHandle::isValid()
+{
+    if (!root.assigned())
+        return false;
+
+    const PropertyObjectPtr rootObj = root.getRef();
+    if (!rootObj.assigned())
+        return false;
+
+    try
+    {
+        if (!isResolved())
+            resolve(rootObj);
+        return !dynamic || rootObj.hasProperty(path);
+    }
+    catch (const NotFoundException&)
+    {
+        return false;
+    }
+}
+
+inline StringPtr PropertyHandle::getPath() const
+{
+    return path;
+}
+
+inline PropertyObjectPtr PropertyHandle::getRoot() const
+{
+    if (!root.assigned())
+        DAQ_THROW_EXCEPTION(InvalidStateException, "Property handle is not initialized");
+
+    PropertyObjectPtr rootObj = root.getRef();
+    if (!rootObj.assigned())
+        DAQ_THROW_EXCEPTION(InvalidStateException, "Property object of the handle was destroyed");
+
+    return rootObj;
+}
+
+inline bool PropertyHandle::isResolved() const
+{
+    if (!resolved)
+        return false;
+
+    for (const auto& level : levels)
+    {
+        SizeT layoutRevision;
+        if (OPENDAQ_FAILED(level.slots->getLayoutRevision(&layoutRevision)))
+        {
+            daqClearErrorInfo();
+            return false;
+        }
+
+        if (layoutRevision != level.layoutRevision)
+            return false;
+    }
+
+    return true;
+}
+
+inline void PropertyHandle::resolve(const PropertyObjectPtr& rootObj)
+{
+    resolved = false;
+    dynamic = false;
+    hasSlot = false;
+    levels.clear();
+
+    const std::string pathStr = path;
+    if (pathStr.find('[') != std::string::npos)
+    {
+        dynamic = true;
+        resolved = true;
+        return;
+    }
+
+    PropertyObjectPtr current = rootObj;
+    size_t begin = 0;
+    while (true)
+    {
+        auto slots = current.asPtrOrNull<IPropertyValueSlots>(true);
+        if (!slots.assigned())
+        {
+            levels.clear();
+            dynamic = true;
+            resolved = true;
+            return;
+        }
+
+        // the revision is read before the child is, so that replacing the child invalidates the handle
+        PathLevel level{levels.empty() ? PropertyObjectPtr() : current, slots.getObject(), 0};
+        checkErrorInfo(slots->getLayoutRevision(&level.layoutRevision));
+        levels.push_back(std::move(level));
+
+        const size_t end = pathStr.find('.', begin);
+        if (end == std::string::npos)
+        {
+            name = pathStr.substr(begin);
+            break;
+        }
+
+        const StringPtr childName = pathStr.substr(begin, end - begin);
+        const auto childProp = current.getProperty(childName);
+        if (childProp.asPtr<IPropertyInternal>(true).getReferencedPropertyUnresolved().assigned())
+        {
+            // the referenced child can change with the value of another property
+            levels.clear();
+            dynamic = true;
+            resolved = true;
+            return;
+        }
+
+        current = current.getPropertyValue(childName).asPtr<IPropertyObject, PropertyObjectPtr>(true);
+        begin = end + 1;
+    }
+
+    const ErrCode errCode = levels.back().slots->resolveValueSlot(name, &slot, &levels.back().layoutRevision);
+    checkErrorInfo(errCode);
+
+    hasSlot = errCode == OPENDAQ_SUCCESS;
+    resolved = true;
+}
+
+inline PropertyObjectPtr PropertyHandle::getLeaf(const PropertyObjectPtr& rootObj) const
+{
+    return levels.size() > 1 ? levels.back().object : rootObj;
+}
+
+END_NAMESPACE_OPENDAQ
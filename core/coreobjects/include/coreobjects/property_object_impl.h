@@ -36,6 +36,8 @@
 #include <coreobjects/property_object_ptr.h>
 #include <coreobjects/property_ptr.h>
 #include <coreobjects/property_value_event_args_factory.h>
+#include <coreobjects/property_value_revision.h>
+#include <coreobjects/property_handle.h>
 #include <coreobjects/object_lock_guard_ptr.h>
 #include <coretypes/cloneable.h>
 #include <coretypes/coretypes.h>
@@ -44,6 +46,7 @@
 #include <coretypes/updatable.h>
 #include <coretypes/validation.h>
 #include <tsl/ordered_map.h>
+#include <atomic>
 #include <cmath>
 #include <limits>
 #include <map>
@@ -80,6 +83,8 @@ class GenericPropertyObjectImpl : public ImplementationOfWeak<PropObjInterface,
                                                               IUpdatable,
                                                               IPropertyObjectProtected,
                                                               IPropertyObjectInternal,
+                                                              IPropertyValueRevision,
+                                                              IPropertyValueSlots,
                                                               Interfaces...>
 {
 public:
@@ -143,6 +148,15 @@ public:
     virtual ErrCode INTERFACE_FUNC getMutex(IMutex** mutex) override;
     virtual ErrCode INTERFACE_FUNC getMutexOwner(IPropertyObjectInternal** owner) override;
 
+    // IPropertyValueRevision
+    virtual ErrCode INTERFACE_FUNC getValueRevision(SizeT* revision) override;
+    virtual ErrCode INTERFACE_FUNC invalidateValueRevision() override;
+
+    // IPropertyValueSlots
+    virtual ErrCode INTERFACE_FUNC resolveValueSlot(IString* propertyName, SizeT* slot, SizeT* layoutRevision) override;
+    virtual ErrCode INTERFACE_FUNC getValueSlot(SizeT slot, SizeT layoutRevision, IBaseObject** value) override;
+    virtual ErrCode INTERFACE_FUNC getLayoutRevision(SizeT* layoutRevision) override;
+
     // IUpdatable
     virtual ErrCode INTERFACE_FUNC updateInternal(ISerializedObject* obj, IBaseObject* context) override;
     virtual ErrCode INTERFACE_FUNC update(ISerializedObject* obj, IBaseObject* config) override;
@@ -341,6 +355,24 @@ private:
     StringPtr path;
     PermissionManagerPtr permissionManager;
     bool frozen;
+    std::atomic<SizeT> valueRevision;
+
+    // Property resolved through IPropertyValueSlots. The raw value is cached until the value revision changes.
+    struct PropertyValueSlot
+    {
+        StringPtr name;
+        PropertyPtr property;
+        bool isReference;
+        bool valueCached;
+        SizeT valueRevision;
+        BaseObjectPtr value;
+    };
+
+    std::vector<PropertyValueSlot> valueSlots;
+    std::atomic<SizeT> layoutRevision;
+
+    // Invalidates all value slots, so that property handles resolve their paths again
+    void invalidateValueSlots();
 
     ErrCode setPropertyValueInternal(IString* name, IBaseObject* value, bool triggerEvent, bool protectedAccess, bool batch, bool isUpdating = false);
     ErrCode setPropertySelectionValueInternal(IString* propertyName, IBaseObject* value, bool protectedAccess);
@@ -475,6 +507,8 @@ GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::GenericPropertyObjec
     , updateCount(0)
     , path("")
     , frozen(false)
+    , valueRevision(0)
+    , layoutRevision(0)
 {
     this->internalAddRef();
     objPtr = this->template borrowPtr<PropertyObjectPtr>();
@@ -590,6 +624,7 @@ void GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::internalDispose
         }
     }
     propValues.clear();
+    valueSlots.clear();
 
     owner.release();
     className.release();
@@ -783,6 +818,7 @@ BaseObjectPtr GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::callPr
     }
 
     auto args = PropertyValueEventArgs(prop, readValue, readValue, PropertyEventType::Read, False);
+    bool handled = false;
 
     if (!localProperties.count(prop.getName()))
     {
@@ -790,6 +826,7 @@ BaseObjectPtr GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::callPr
         if (propEvent.hasListeners())
         {
             propEvent(objPtr, args);
+            handled = true;
         }
     }
 
@@ -799,14 +836,20 @@ BaseObjectPtr GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::callPr
         if (valueReadEvents[name].hasListeners())
         {
             valueReadEvents[name](objPtr, args);
+            handled = true;
         }
     }
 
     if (valueReadEvents[AnyReadEventName].hasListeners())
     {
         valueReadEvents[AnyReadEventName](objPtr, args);
+        handled = true;
     }
 
+    // Values produced by read handlers can change on every read, so they must not be memoized
+    if (handled)
+        invalidateValueRevision();
+
     return args.getValue();
 }
 
@@ -1132,6 +1175,8 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::setPropertyV
                 childPropAsPropertyObject.setPropertyValue(subName, valuePtr);
             }
 
+            // The child object invalidates its owner as well, unless it is not owned by this object
+            invalidateValueRevision();
             return OPENDAQ_SUCCESS;
         }
 
@@ -1166,6 +1211,7 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::setPropertyV
         else if (ct == ctObject)
         {
             configureClonedObj(propName, valuePtr);
+            invalidateValueSlots();
         }
 
         if (triggerEvent)
@@ -1179,7 +1225,9 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::setPropertyV
 
             if (valuePtr == newValue)
             {
-                writeLocalValue(propName, newValue);
+                // Memoized values are invalidated before any listener can read them
+                if (writeLocalValue(propName, newValue))
+                    invalidateValueRevision();
                 setOwnerToPropertyValue(newValue);
             }
 
@@ -1190,6 +1238,7 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::setPropertyV
         {
             if (!writeLocalValue(propName, valuePtr))
                 return OPENDAQ_IGNORED;
+            invalidateValueRevision();
             setOwnerToPropertyValue(valuePtr);
         }
 
@@ -1413,6 +1462,7 @@ void GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::setChildPropert
     writeLocalValue(propName, cloned, true);
     setOwnerToPropertyValue(cloned);
     configureClonedObj(propName, cloned);
+    invalidateValueSlots();
 }
 
 template <typename PropObjInterface, typename... Interfaces>
@@ -2080,6 +2130,8 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::clearPropert
                 const auto childPropAsPropertyObject = childProp.template asPtr<IPropertyObject, PropertyObjectPtr>(true);
                 childPropAsPropertyObject.clearPropertyValue(subName);
             }
+
+            invalidateValueRevision();
         }
         else
         {
@@ -2124,6 +2176,7 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::clearPropert
                 {
                     auto it = propValues.find(prop.getName());
                     propValues.erase(it);
+                    invalidateValueRevision();
                 }
 
                 if (!isUpdating)
@@ -2339,6 +2392,8 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::addProperty(
             propPtr.asPtrOrNull<IPropertyInternal>().overrideDefaultValue(clone);
         }
         
+        invalidateValueSlots();
+        invalidateValueRevision();
         triggerCoreEventInternal(CoreEventArgsPropertyAdded(objPtr, propPtr, path));
 
         return OPENDAQ_SUCCESS;
@@ -2371,6 +2426,8 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::removeProper
         propValues.erase(propertyName);
     }
 
+    invalidateValueSlots();
+    invalidateValueRevision();
     triggerCoreEventInternal(CoreEventArgsPropertyRemoved(objPtr, propertyName, path));
 
     return OPENDAQ_SUCCESS;
@@ -2400,6 +2457,7 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::setPropertyO
     else
         customOrder.clear();
 
+    invalidateValueRevision();
     if (!isUpdating)
         triggerCoreEventInternal(CoreEventArgsPropertyOrderChanged(objPtr, orderedPropertyNames, path));
 
@@ -3130,6 +3188,153 @@ ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getMutexOwne
     return ownerPtr->getMutexOwner(owner);
 }
 
+template <class PropObjInterface, class... Interfaces>
+ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getValueRevision(SizeT* revision)
+{
+    OPENDAQ_PARAM_NOT_NULL(revision);
+
+    *revision = valueRevision.load(std::memory_order_acquire);
+    return OPENDAQ_SUCCESS;
+}
+
+template <class PropObjInterface, class... Interfaces>
+ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::invalidateValueRevision()
+{
+    valueRevision.fetch_add(1, std::memory_order_acq_rel);
+
+    if (!owner.assigned())
+        return OPENDAQ_SUCCESS;
+
+    // Child objects report their changes to the owner, as expressions of the owner can reference them
+    const ErrCode errCode = daqTry([this]
+    {
+        const auto ownerPtr = owner.getRef();
+        if (!ownerPtr.assigned())
+            return OPENDAQ_SUCCESS;
+
+        const auto ownerRevision = ownerPtr.template asPtrOrNull<IPropertyValueRevision>(true);
+        if (ownerRevision.assigned())
+            return ownerRevision->invalidateValueRevision();
+        return OPENDAQ_SUCCESS;
+    });
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+    return errCode;
+}
+
+template <class PropObjInterface, class... Interfaces>
+ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::resolveValueSlot(IString* propertyName, SizeT* slot, SizeT* layoutRevision)
+{
+    OPENDAQ_PARAM_NOT_NULL(propertyName);
+    OPENDAQ_PARAM_NOT_NULL(slot);
+    OPENDAQ_PARAM_NOT_NULL(layoutRevision);
+
+    auto lock = getRecursiveConfigLock2();
+
+    const auto name = StringPtr::Borrow(propertyName);
+    if (isChildProperty(name) || strchr(name.getCharPtr(), '[') != nullptr)
+        return OPENDAQ_IGNORED;
+
+    const ErrCode errCode = daqTry([&]
+    {
+        *layoutRevision = this->layoutRevision.load(std::memory_order_acquire);
+
+        for (SizeT i = 0; i < valueSlots.size(); ++i)
+        {
+            if (valueSlots[i].name == name)
+            {
+                *slot = i;
+                return OPENDAQ_SUCCESS;
+            }
+        }
+
+        const PropertyPtr prop = getUnboundPropertyOrNull(name);
+        if (!prop.assigned())
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOTFOUND, fmt::format(R"(Property "{}" does not exist)", name));
+
+        // The target of a reference property is resolved on each read, as it can depend on other property values
+        const auto propInternal = prop.template asPtr<IPropertyInternal>(true);
+        const bool isReference = propInternal.getReferencedPropertyUnresolved().assigned();
+        const PropertyPtr boundProp = isReference ? prop : PropertyPtr(propInternal.cloneWithOwner(objPtr));
+
+        valueSlots.push_back(PropertyValueSlot{name, boundProp, isReference, false, 0, nullptr});
+        *slot = valueSlots.size() - 1;
+        return OPENDAQ_SUCCESS;
+    });
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+    return errCode;
+}
+
+template <class PropObjInterface, class... Interfaces>
+ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getValueSlot(SizeT slot, SizeT layoutRevision, IBaseObject** value)
+{
+    OPENDAQ_PARAM_NOT_NULL(value);
+
+    auto lock = getRecursiveConfigLock2();
+
+    if (layoutRevision != this->layoutRevision.load(std::memory_order_acquire) || slot >= valueSlots.size())
+        return OPENDAQ_IGNORED;
+
+    // Read handlers can add or remove properties, so the slot is not accessed after they are called
+    auto& valueSlot = valueSlots[slot];
+    const StringPtr name = valueSlot.name;
+    const PropertyPtr property = valueSlot.property;
+
+    if (valueSlot.isReference || !updatePropertyStack.isEmpty())
+        return getPropertyValueInternal(name, value, true);
+
+    const ErrCode errCode = daqTry([&]
+    {
+        const SizeT revision = valueRevision.load(std::memory_order_acquire);
+        if (!valueSlot.valueCached || valueSlot.valueRevision != revision)
+        {
+            const auto it = propValues.find(name);
+            if (it != propValues.cend())
+                valueSlot.value = it->second;
+            else
+                valueSlot.value = property.template asPtr<IPropertyInternal>(true).getDefaultValueNoLock();
+
+            valueSlot.valueRevision = revision;
+            valueSlot.valueCached = true;
+        }
+
+        BaseObjectPtr valuePtr = valueSlot.value;
+        if (!valuePtr.assigned())
+        {
+            *value = nullptr;
+            return OPENDAQ_SUCCESS;
+        }
+
+        const CoreType coreType = valuePtr.getCoreType();
+        if (coreType == ctList || coreType == ctDict)
+        {
+            BaseObjectPtr clonedValue;
+            OPENDAQ_RETURN_IF_FAILED(valuePtr.template asPtr<ICloneable>()->clone(&clonedValue));
+            valuePtr = clonedValue.detach();
+        }
+
+        *value = callPropertyValueRead(property, valuePtr).detach();
+        return OPENDAQ_SUCCESS;
+    });
+    OPENDAQ_RETURN_IF_FAILED(errCode, "Failed to get property value");
+    return errCode;
+}
+
+template <class PropObjInterface, class... Interfaces>
+ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::getLayoutRevision(SizeT* layoutRevision)
+{
+    OPENDAQ_PARAM_NOT_NULL(layoutRevision);
+
+    *layoutRevision = this->layoutRevision.load(std::memory_order_acquire);
+    return OPENDAQ_SUCCESS;
+}
+
+template <class PropObjInterface, class... Interfaces>
+void GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::invalidateValueSlots()
+{
+    valueSlots.clear();
+    layoutRevision.fetch_add(1, std::memory_order_acq_rel);
+}
+
 template <class PropObjInterface, class... Interfaces>
 ErrCode GenericPropertyObjectImpl<PropObjInterface, Interfaces...>::serializeCustomValues(ISerializer* /*serializer*/, bool /*forUpdate*/)
 {
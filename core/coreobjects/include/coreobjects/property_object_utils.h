@@ -89,6 +89,7 @@ public:
     bool unregisterPropertyUpdating(const std::string& name);
     bool isBaseStackLevel(const std::string& name) const;
     bool getPropertyValue(const std::string& name, BaseObjectPtr& value) const;
+    bool isEmpty() const;
 
 private:
     std::map<std::string, PropertyUpdateStackItem> updatePropertyStack;
@@ -169,4 +170,9 @@ inline bool PropertyUpdateStack::getPropertyValue(const std::string& name, BaseO
     return true;
 }
 
+inline bool PropertyUpdateStack::isEmpty() const
+{
+    return updatePropertyStack.empty();
+}
+
 END_NAMESPACE_OPENDAQ
@@ -0,0 +1,56 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/baseobject.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup objects_property_object
+ * @addtogroup objects_property_value_revision PropertyValueRevision
+ * @{
+ */
+
+/*!
+ * @brief Internal interface exposing a revision counter of the values held by a Property object.
+ *
+ * The revision is incremented after every property value write, clear, property addition/removal and
+ * whenever a value is produced by a read event handler. Changes in nested child Property objects are
+ * propagated to their owners, so the revision of an object covers its whole property value subtree.
+ *
+ * Eval values use the revision of their owner to decide whether a memoized result is still valid.
+ */
+DECLARE_OPENDAQ_INTERFACE(IPropertyValueRevision, IBaseObject)
+{
+    /*!
+     * @brief Gets the current value revision.
+     * @param[out] revision The value revision.
+     * @retval OPENDAQ_IGNORED if the object cannot track changes of its values (eg. the values are owned by another object).
+     */
+    virtual ErrCode INTERFACE_FUNC getValueRevision(SizeT* revision) = 0;
+
+    /*!
+     * @brief Increments the value revision of the object and of all its owners.
+     */
+    virtual ErrCode INTERFACE_FUNC invalidateValueRevision() = 0;
+};
+
+/*!
+ * @}
+ */
+
+END_NAMESPACE_OPENDAQ
@@ -1,12 +1,57 @@
 #include <coreobjects/eval_value_impl.h>
 #include <coreobjects/eval_value_parser.h>
+#include <algorithm>
 #include <functional>
 #include <coreobjects/eval_value_ptr.h>
 #include <coreobjects/property_object_internal_ptr.h>
+#include <coreobjects/property_value_revision.h>
+#include <coretypes/cloneable.h>
 #include <coretypes/dict_ptr.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
+bool EvalValueResultCache::tryGet(const PropertyObjectPtr& owner, SizeT revision, BaseObjectPtr& result)
+{
+    std::scoped_lock lock(sync);
+
+    const auto it = entries.find(owner.getObject());
+    if (it == entries.end() || it->second.revision != revision)
+        return false;
+
+    // a destroyed owner can be replaced by a new object at the same address
+    if (owner.assigned() && it->second.owner.getRef().getObject() != owner.getObject())
+        return false;
+
+    result = it->second.result;
+    return true;
+}
+
+void EvalValueResultCache::store(const PropertyObjectPtr& owner, SizeT revision, const BaseObjectPtr& result)
+{
+    std::scoped_lock lock(sync);
+
+    if (entries.size() >= pruneThreshold)
+        removeExpiredEntries();
+
+    auto& entry = entries[owner.getObject()];
+    entry.owner = owner.assigned() ? WeakRefPtr<IPropertyObject>(owner) : WeakRefPtr<IPropertyObject>();
+    entry.revision = revision;
+    entry.result = result;
+}
+
+void EvalValueResultCache::removeExpiredEntries()
+{
+    for (auto it = entries.begin(); it != entries.end();)
+    {
+        if (it->first != nullptr && !it->second.owner.getRef().assigned())
+            it = entries.erase(it);
+        else
+            ++it;
+    }
+
+    pruneThreshold = std::max<SizeT>(16, entries.size() * 2);
+}
+
 EvalValueImpl::EvalValueImpl(IString* eval)
     : eval(eval)
     , node(nullptr)
@@ -14,6 +59,7 @@ EvalValueImpl::EvalValueImpl(IString* eval)
     , parseErrCode(OPENDAQ_SUCCESS)
     , calculated(false)
     , useFunctionResolver(false)
+    , hasReferences(false)
 {
     onCreate();
 }
@@ -25,6 +71,7 @@ EvalValueImpl::EvalValueImpl(IString* eval, IFunction* func)
     , parseErrCode(OPENDAQ_SUCCESS)
     , calculated(false)
     , useFunctionResolver(true)
+    , hasReferences(false)
     , func(func)
 {
     onCreate();
@@ -38,6 +85,7 @@ EvalValueImpl::EvalValueImpl(IString* eval, ListPtr<IBaseObject> arguments)
     , parseErrCode(OPENDAQ_SUCCESS)
     , calculated(false)
     , useFunctionResolver(false)
+    , hasReferences(false)
 {
     onCreate();
 }
@@ -51,47 +99,35 @@ void EvalValueImpl::internalDispose(bool disposing)
     }
 }
 
+// The expression tree is copied from the source only when the clone has to be evaluated,
+// as the result is often already memoized for the new owner. The source tree is taken from
+// the tree that was parsed, which is never replaced, rather than from a lazily cloned one.
 EvalValueImpl::EvalValueImpl(const EvalValueImpl& ev, IPropertyObject* owner)
     : eval(ev.eval)
+    , sourceNode(ev.sourceNode ? ev.sourceNode : ev.node)
+    , propertyReferences(ev.propertyReferences)
+    , resultCache(ev.resultCache)
     , resolveStatus(ResolveStatus::Unresolved)
     , parseErrCode(ev.parseErrCode)
     , calculated(false)
     , useFunctionResolver(false)
+    , hasReferences(ev.hasReferences)
 {
-    using namespace std::placeholders;
-
     this->owner = owner;
-    node = ev.node->clone([this](const std::string& str, RefType refType, int argIndex, std::string& postRef, bool lock)
-    {
-        return getReference(str, refType, argIndex, postRef, lock);
-    });
-
-    std::unordered_set<std::string> refs;
-    for (auto ref : *ev.propertyReferences)
-        refs.insert(ref);
-    propertyReferences = std::make_unique<std::unordered_set<std::string>>(std::move(refs));
 }
 
 EvalValueImpl::EvalValueImpl(const EvalValueImpl& ev, IPropertyObject* owner, IFunction* func)
     : eval(ev.eval)
+    , sourceNode(ev.sourceNode ? ev.sourceNode : ev.node)
+    , propertyReferences(ev.propertyReferences)
     , resolveStatus(ResolveStatus::Unresolved)
     , parseErrCode(ev.parseErrCode)
     , calculated(false)
     , useFunctionResolver(true)
+    , hasReferences(ev.hasReferences)
     , func(func)
 {
-    using namespace std::placeholders;
-
     this->owner = owner;
-    node = ev.node->clone([this](const std::string& str, RefType refType, int argIndex, std::string& postRef, bool lock)
-    {
-        return getReference(str, refType, argIndex, postRef, lock);
-    });
-
-    std::unordered_set<std::string> refs;
-    for (auto ref : *ev.propertyReferences)
-        refs.insert(ref);
-    propertyReferences = std::make_unique<std::unordered_set<std::string>>(std::move(refs));
 }
 
 void EvalValueImpl::onCreate()
@@ -121,7 +157,78 @@ void EvalValueImpl::onCreate()
 
     parseErrCode = parsed ? OPENDAQ_SUCCESS : OPENDAQ_ERR_PARSEFAILED;
     if (!parsed)
+    {
         parseErrMessage = params.errMessage;
+        return;
+    }
+
+    hasReferences = node->visit([](BaseNode* input)
+    {
+        return dynamic_cast<RefNode*>(input) != nullptr || dynamic_cast<PropFuncNode*>(input) != nullptr ? 1 : 0;
+    }) != 0;
+
+    // Function resolvers and arguments are outside of the owner's value revision, so such
+    // expressions are treated as non-deterministic and are evaluated on every read
+    if (!useFunctionResolver && (!arguments.assigned() || arguments.getCount() == 0))
+        resultCache = std::make_shared<EvalValueResultCache>();
+}
+
+void EvalValueImpl::cloneSourceNode()
+{
+    assert(sourceNode);
+
+    // Concurrent readers of a cloned value can all request the tree, only one of them clones it
+    std::call_once(nodeCloned, [this]
+    {
+        node = sourceNode->clone([this](const std::string& str, RefType refType, int argIndex, std::string& postRef, bool lock)
+        {
+            return getReference(str, refType, argIndex, postRef, lock);
+        });
+    });
+}
+
+bool EvalValueImpl::getOwnerRevision(PropertyObjectPtr& ownerRef, SizeT& revision) const
+{
+    if (!resultCache)
+        return false;
+
+    if (!hasReferences)
+    {
+        ownerRef = nullptr;
+        revision = 0;
+        return true;
+    }
+
+    if (!owner.assigned())
+        return false;
+
+    try
+    {
+        ownerRef = owner.getRef();
+        if (!ownerRef.assigned())
+            return false;
+
+        const auto ownerRevision = ownerRef.asPtrOrNull<IPropertyValueRevision>(true);
+        return ownerRevision.assigned() && ownerRevision->getValueRevision(&revision) == OPENDAQ_SUCCESS;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+BaseObjectPtr EvalValueImpl::copyContainerResult(const BaseObjectPtr& result)
+{
+    if (!result.assigned())
+        return result;
+
+    const auto coreType = result.getCoreType();
+    if (coreType != ctList && coreType != ctDict)
+        return result;
+
+    BaseObjectPtr cloned;
+    checkErrorInfo(result.asPtr<ICloneable>()->clone(&cloned));
+    return cloned;
 }
 
 ErrCode EvalValueImpl::setOwner(IPropertyObject* value)
@@ -245,6 +352,10 @@ int EvalValueImpl::resolveReferences(bool lock)
 ErrCode EvalValueImpl::checkParseAndResolve(bool lock)
 {
     OPENDAQ_RETURN_IF_FAILED(parseErrCode);
+
+    if (sourceNode)
+        cloneSourceNode();
+
     int r = resolveReferences(lock);
     if (r != 0)
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_RESOLVEFAILED);
@@ -252,16 +363,45 @@ ErrCode EvalValueImpl::checkParseAndResolve(bool lock)
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode EvalValueImpl::getResultInternal(BaseObjectPtr& result, bool lock)
+{
+    PropertyObjectPtr ownerRef;
+    SizeT revision = 0;
+    const bool memoize = getOwnerRevision(ownerRef, revision);
+    if (memoize && resultCache->tryGet(ownerRef, revision, result))
+        return OPENDAQ_SUCCESS;
+
+    ErrCode err = checkParseAndResolve(lock);
+    OPENDAQ_RETURN_IF_FAILED(err);
+
+    try
+    {
+        result = calc();
+    }
+    catch (...)
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_CALCFAILED);
+    }
+
+    // Value writes and read handlers invoked during the evaluation change the revision
+    SizeT revisionAfter;
+    if (memoize && getOwnerRevision(ownerRef, revisionAfter) && revisionAfter == revision)
+        resultCache->store(ownerRef, revision, result);
+
+    return OPENDAQ_SUCCESS;
+}
+
 ErrCode EvalValueImpl::getCoreType(CoreType* coreType)
 {
     OPENDAQ_PARAM_NOT_NULL(coreType);
 
-    ErrCode err = checkParseAndResolve(false);
+    BaseObjectPtr result;
+    ErrCode err = getResultInternal(result, false);
     OPENDAQ_RETURN_IF_FAILED(err);
 
     try
     {
-        *coreType = calc().getCoreType();
+        *coreType = result.getCoreType();
         return OPENDAQ_SUCCESS;
     }
     catch (...)
@@ -288,36 +428,34 @@ ErrCode EvalValueImpl::getResult(IBaseObject** obj)
 {
     OPENDAQ_PARAM_NOT_NULL(obj);
 
-    ErrCode err = checkParseAndResolve(true);
+    BaseObjectPtr result;
+    ErrCode err = getResultInternal(result, true);
     OPENDAQ_RETURN_IF_FAILED(err);
 
-    try
-    {
-        *obj = calc().addRefAndReturn();
-        return OPENDAQ_SUCCESS;
-    }
-    catch (...)
+    // memoized lists and dictionaries are shared, so the caller gets a copy
+    const ErrCode errCode = daqTry([&]
     {
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_CALCFAILED);
-    };
+        *obj = (resultCache ? copyContainerResult(result) : result).detach();
+    });
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+    return errCode;
 }
 
 ErrCode EvalValueImpl::getResultNoLock(IBaseObject** obj)
 {
     OPENDAQ_PARAM_NOT_NULL(obj);
 
-    ErrCode err = checkParseAndResolve(false);
+    BaseObjectPtr result;
+    ErrCode err = getResultInternal(result, false);
     OPENDAQ_RETURN_IF_FAILED(err);
 
-    try
-    {
-        *obj = calc().addRefAndReturn();
-        return OPENDAQ_SUCCESS;
-    }
-    catch (...)
+    // memoized lists and dictionaries are shared, so the caller gets a copy
+    const ErrCode errCode = daqTry([&]
     {
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_CALCFAILED);
-    };
+        *obj = (resultCache ? copyContainerResult(result) : result).detach();
+    });
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+    return errCode;
 }
 
 template <typename T>
@@ -391,12 +529,13 @@ ErrCode EvalValueImpl::StringObject_GetLength(SizeT* size)
 template <typename T>
 ErrCode EvalValueImpl::getValueInternal(T& value)
 {
-    auto err = checkParseAndResolve(false);
+    BaseObjectPtr result;
+    auto err = getResultInternal(result, false);
     OPENDAQ_RETURN_IF_FAILED(err);
 
     try
     {
-        value = static_cast<T>(calc());
+        value = static_cast<T>(result);
         return OPENDAQ_SUCCESS;
     }
     catch (...)
@@ -451,10 +590,11 @@ ErrCode EvalValueImpl::getItemAt(SizeT index, IBaseObject** obj)
 {
     OPENDAQ_PARAM_NOT_NULL(obj);
 
-    auto err = checkParseAndResolve(false);
+    BaseObjectPtr result;
+    auto err = getResultInternal(result, false);
     OPENDAQ_RETURN_IF_FAILED(err);
 
-    ListPtr<IBaseObject> list = node->getResult();
+    ListPtr<IBaseObject> list = result;
     auto res = list.getItemAt(index);
 
     *obj = res.addRefAndReturn();
@@ -465,10 +605,9 @@ ErrCode EvalValueImpl::getCount(SizeT* size)
 {
     OPENDAQ_PARAM_NOT_NULL(size);
 
-    auto err = checkParseAndResolve(false);
+    BaseObjectPtr res;
+    auto err = getResultInternal(res, false);
     OPENDAQ_RETURN_IF_FAILED(err);
-
-    BaseObjectPtr res = node->getResult();
     if (const auto list = res.asPtrOrNull<IList>(true); list.assigned())
         *size = list.getCount();
     else if (const auto dict = res.asPtrOrNull<IDict>(true); dict.assigned())
@@ -536,14 +675,15 @@ ErrCode EvalValueImpl::clear()
 
 ErrCode EvalValueImpl::createStartIterator(IIterator** iterator)
 {
-    ErrCode errCode = checkParseAndResolve(false);
+    BaseObjectPtr result;
+    ErrCode errCode = getResultInternal(result, false);
     OPENDAQ_RETURN_IF_FAILED(errCode);
 
     ListPtr<IBaseObject> list;
 
     errCode = daqTry([&]()
     {
-        list = node->getResult();
+        list = result;
     });
     OPENDAQ_RETURN_IF_FAILED(errCode);
 
@@ -555,10 +695,11 @@ ErrCode EvalValueImpl::createStartIterator(IIterator** iterator)
 
 ErrCode EvalValueImpl::createEndIterator(IIterator** iterator)
 {
-    ErrCode errCode = checkParseAndResolve(false);
+    BaseObjectPtr result;
+    ErrCode errCode = getResultInternal(result, false);
     OPENDAQ_RETURN_IF_FAILED(errCode);
 
-    ListPtr<IBaseObject> list = node->getResult();
+    ListPtr<IBaseObject> list = result;
     errCode = list->createEndIterator(iterator);
 
     return errCode;
@@ -809,10 +950,9 @@ ErrCode EvalValueImpl::get(IBaseObject* key, IBaseObject** value)
     OPENDAQ_PARAM_NOT_NULL(key);
     OPENDAQ_PARAM_NOT_NULL(value);
 
-    auto err = checkParseAndResolve(false);
+    BaseObjectPtr res;
+    auto err = getResultInternal(res, false);
     OPENDAQ_RETURN_IF_FAILED(err);
-
-    BaseObjectPtr res = node->getResult();
     auto dict = res.asPtrOrNull<IDict>(true);
     if (!dict.assigned())
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Result of evaluation is not a dictionary.");
@@ -841,10 +981,9 @@ ErrCode EvalValueImpl::hasKey(IBaseObject* key, Bool* hasKey)
     OPENDAQ_PARAM_NOT_NULL(key);
     OPENDAQ_PARAM_NOT_NULL(hasKey);
 
-    auto err = checkParseAndResolve(false);
+    BaseObjectPtr res;
+    auto err = getResultInternal(res, false);
     OPENDAQ_RETURN_IF_FAILED(err);
-
-    BaseObjectPtr res = node->getResult();
     auto dict = res.asPtrOrNull<IDict>(true);
     if (!dict.assigned())
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Result of evaluation is not a dictionary.");
@@ -857,10 +996,9 @@ ErrCode EvalValueImpl::getKeyList(IList** keys)
 {
     OPENDAQ_PARAM_NOT_NULL(keys);
 
-    auto err = checkParseAndResolve(false);
+    BaseObjectPtr res;
+    auto err = getResultInternal(res, false);
     OPENDAQ_RETURN_IF_FAILED(err);
-
-    BaseObjectPtr res = node->getResult();
     auto dict = res.asPtrOrNull<IDict>(true);
     if (!dict.assigned())
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Result of evaluation is not a dictionary.");
@@ -873,10 +1011,9 @@ ErrCode EvalValueImpl::getValueList(IList** values)
 {
     OPENDAQ_PARAM_NOT_NULL(values);
 
-    auto err = checkParseAndResolve(false);
+    BaseObjectPtr res;
+    auto err = getResultInternal(res, false);
     OPENDAQ_RETURN_IF_FAILED(err);
-
-    BaseObjectPtr res = node->getResult();
     auto dict = res.asPtrOrNull<IDict>(true);
     if (!dict.assigned())
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Result of evaluation is not a dictionary.");
@@ -889,10 +1026,9 @@ ErrCode EvalValueImpl::getKeys(IIterable** iterable)
 {
     OPENDAQ_PARAM_NOT_NULL(iterable);
 
-    auto err = checkParseAndResolve(false);
+    BaseObjectPtr res;
+    auto err = getResultInternal(res, false);
     OPENDAQ_RETURN_IF_FAILED(err);
-
-    BaseObjectPtr res = node->getResult();
     auto dict = res.asPtrOrNull<IDict>(true);
     if (!dict.assigned())
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Result of evaluation is not a dictionary.");
@@ -905,10 +1041,9 @@ ErrCode EvalValueImpl::getValues(IIterable** iterable)
 {
     OPENDAQ_PARAM_NOT_NULL(iterable);
 
-    auto err = checkParseAndResolve(false);
+    BaseObjectPtr res;
+    auto err = getResultInternal(res, false);
     OPENDAQ_RETURN_IF_FAILED(err);
-
-    BaseObjectPtr res = node->getResult();
     auto dict = res.asPtrOrNull<IDict>(true);
     if (!dict.assigned())
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Result of evaluation is not a dictionary.");
@@ -970,7 +1105,7 @@ ErrCode EvalValueImpl::cloneWithOwner(IPropertyObject* newOwner, IEvalValue** cl
     OPENDAQ_PARAM_NOT_NULL(newOwner);
 
     // OPENDAQ_TODO: properly handle error when parse failed
-    assert(node != nullptr);
+    assert(node != nullptr || sourceNode != nullptr);
 
     EvalValueImpl* newEvalValue;
     if (useFunctionResolver && func.assigned())
@@ -604,3 +604,135 @@ TEST_F(EvalValueTest, UnitPartial)
     ASSERT_EQ(unit2.getQuantity(), "");
     ASSERT_EQ(unit3.getId(), -1);
 }
+
+TEST_F(EvalValueTest, MemoizedResultUpdatedOnValueWrite)
+{
+    auto propObj = PropertyObject();
+    propObj.addProperty(IntProperty("Lhs", 1));
+    propObj.addProperty(IntProperty("Rhs", 2));
+
+    auto eval = EvalValue("$Lhs + $Rhs").cloneWithOwner(propObj);
+    ASSERT_EQ(eval.getResult(), 3);
+    ASSERT_EQ(eval.getResult(), 3);
+
+    propObj.setPropertyValue("Lhs", 10);
+    ASSERT_EQ(eval.getResult(), 12);
+
+    propObj.clearPropertyValue("Lhs");
+    ASSERT_EQ(eval.getResult(), 3);
+}
+
+TEST_F(EvalValueTest, MemoizedResultUpdatedOnChildValueWrite)
+{
+    auto child = PropertyObject();
+    child.addProperty(IntProperty("Value", 1));
+
+    auto propObj = PropertyObject();
+    propObj.addProperty(ObjectProperty("Child", child));
+    propObj.addProperty(IntProperty("Factor", 2));
+
+    auto eval = EvalValue("$Child.Value * $Factor").cloneWithOwner(propObj);
+    ASSERT_EQ(eval.getResult(), 2);
+
+    PropertyObjectPtr childObj = propObj.getPropertyValue("Child");
+    childObj.setPropertyValue("Value", 5);
+    ASSERT_EQ(eval.getResult(), 10);
+
+    childObj.clearPropertyValue("Value");
+    ASSERT_EQ(eval.getResult(), 2);
+
+    propObj.setPropertyValue("Factor", 3);
+    ASSERT_EQ(eval.getResult(), 3);
+}
+
+TEST_F(EvalValueTest, MemoizedResultReadFromCache)
+{
+    auto propObj = PropertyObject();
+    propObj.addProperty(FloatProperty("Value", 3.0));
+
+    auto eval = EvalValue("$Value * 1.5").cloneWithOwner(propObj);
+
+    // each evaluation creates a new result object, so a read returning the first object was served from the cache
+    const BaseObjectPtr first = eval.getResult();
+    ASSERT_EQ(first, 4.5);
+    ASSERT_EQ(eval.getResult().getObject(), first.getObject());
+    ASSERT_EQ(eval.getResult().getObject(), first.getObject());
+
+    propObj.setPropertyValue("Value", 4.0);
+    const BaseObjectPtr second = eval.getResult();
+    ASSERT_EQ(second, 6.0);
+    ASSERT_NE(second.getObject(), first.getObject());
+    ASSERT_EQ(eval.getResult().getObject(), second.getObject());
+}
+
+TEST_F(EvalValueTest, MemoizedResultUpdatedBeforeCoreEvent)
+{
+    auto propObj = PropertyObject();
+    propObj.addProperty(IntProperty("Lhs", 1));
+    propObj.addProperty(IntProperty("Rhs", 2));
+
+    auto eval = EvalValue("$Lhs + $Rhs").cloneWithOwner(propObj);
+    ASSERT_EQ(eval.getResult(), 3);
+
+    Int resultInEvent = 0;
+    ProcedurePtr trigger = [&eval, &resultInEvent](const CoreEventArgsPtr&)
+    {
+        resultInEvent = eval.getResult();
+    };
+
+    const auto objInternal = propObj.asPtr<IPropertyObjectInternal>();
+    objInternal.setCoreEventTrigger(trigger);
+    objInternal.enableCoreEventTrigger();
+
+    propObj.setPropertyValue("Lhs", 10);
+    ASSERT_EQ(resultInEvent, 12);
+
+    propObj.clearPropertyValue("Lhs");
+    ASSERT_EQ(resultInEvent, 3);
+}
+
+TEST_F(EvalValueTest, ReadHandlerValueNotMemoized)
+{
+    auto propObj = PropertyObject();
+    propObj.addProperty(IntProperty("Value", 1));
+
+    int counter = 0;
+    propObj.getOnPropertyValueRead("Value") += [&counter](PropertyObjectPtr&, PropertyValueEventArgsPtr& args)
+    {
+        counter++;
+        args.setValue(counter);
+    };
+
+    auto eval = EvalValue("$Value").cloneWithOwner(propObj);
+    ASSERT_EQ(eval.getResult(), 1);
+    ASSERT_EQ(eval.getResult(), 2);
+    ASSERT_EQ(counter, 2);
+}
+
+TEST_F(EvalValueTest, FuncResolverNotMemoized)
+{
+    int counter = 0;
+    auto hasTagFunc = Function([&counter](const BaseObjectPtr& tag)
+    {
+        counter++;
+        return tag == "channel";
+    });
+
+    auto ev = EvalValueFunc("channel", hasTagFunc);
+    Bool tagOk1 = ev;
+    Bool tagOk2 = ev;
+    ASSERT_TRUE(tagOk1 && tagOk2);
+    ASSERT_EQ(counter, 2);
+}
+
+TEST_F(EvalValueTest, MemoizedListResultCopied)
+{
+    auto eval = EvalValue("[1, 2, 3] * 2");
+
+    ListPtr<IBaseObject> list1 = eval.getResult();
+    list1.pushBack(8);
+
+    ListPtr<IBaseObject> list2 = eval.getResult();
+    ASSERT_EQ(list2.getCount(), 3u);
+    ASSERT_EQ(list2.getItemAt(2), 6);
+}
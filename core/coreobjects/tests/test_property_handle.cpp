@@ -0,0 +1,150 @@
+#include <testutils/testutils.h>
+#include <coreobjects/property_object_factory.h>
+#include <coreobjects/property_factory.h>
+#include <coreobjects/eval_value_factory.h>
+#include <coreobjects/property_handle.h>
+
+using namespace daq;
+
+class PropertyHandleTest : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        child = PropertyObject();
+        child.addProperty(IntProperty("Value", 1));
+
+        obj = PropertyObject();
+        obj.addProperty(FloatProperty("Scale", 2.5));
+        obj.addProperty(StringProperty("Name", "foo"));
+        obj.addProperty(ListProperty("List", List<IInteger>(1, 2, 3)));
+        obj.addProperty(ObjectProperty("Child", child));
+    }
+
+    PropertyObjectPtr obj;
+    PropertyObjectPtr child;
+};
+
+TEST_F(PropertyHandleTest, GetValue)
+{
+    PropertyHandle scale(obj, "Scale");
+    PropertyHandle name(obj, "Name");
+
+    ASSERT_EQ(scale.getValueAs<Float>(), 2.5);
+    ASSERT_EQ(name.getValueAs<std::string>(), "foo");
+    ASSERT_EQ(scale.getPath(), "Scale");
+}
+
+TEST_F(PropertyHandleTest, ValueChanged)
+{
+    PropertyHandle scale(obj, "Scale");
+    ASSERT_EQ(scale.getValue(), 2.5);
+
+    obj.setPropertyValue("Scale", 4.0);
+    ASSERT_EQ(scale.getValue(), 4.0);
+
+    obj.clearPropertyValue("Scale");
+    ASSERT_EQ(scale.getValue(), 2.5);
+}
+
+TEST_F(PropertyHandleTest, SetValue)
+{
+    PropertyHandle scale(obj, "Scale");
+    scale.setValue(1.5);
+
+    ASSERT_EQ(obj.getPropertyValue("Scale"), 1.5);
+    ASSERT_EQ(scale.getValue(), 1.5);
+}
+
+TEST_F(PropertyHandleTest, NestedValue)
+{
+    PropertyHandle value(obj, "Child.Value");
+    ASSERT_EQ(value.getValue(), 1);
+
+    obj.setPropertyValue("Child.Value", 5);
+    ASSERT_EQ(value.getValue(), 5);
+
+    value.setValue(7);
+    ASSERT_EQ(obj.getPropertyValue("Child.Value"), 7);
+}
+
+TEST_F(PropertyHandleTest, ListValueCopied)
+{
+    PropertyHandle list(obj, "List");
+
+    ListPtr<IInteger> value = list.getValue();
+    value.pushBack(4);
+
+    ListPtr<IInteger> value2 = list.getValue();
+    ASSERT_EQ(value2.getCount(), 3u);
+}
+
+TEST_F(PropertyHandleTest, ReadEvent)
+{
+    int counter = 0;
+    obj.getOnPropertyValueRead("Scale") += [&counter](PropertyObjectPtr&, PropertyValueEventArgsPtr& args)
+    {
+        counter++;
+        args.setValue(10.0);
+    };
+
+    PropertyHandle scale(obj, "Scale");
+    ASSERT_EQ(scale.getValue(), 10.0);
+    ASSERT_EQ(scale.getValue(), 10.0);
+    ASSERT_EQ(counter, 2);
+}
+
+TEST_F(PropertyHandleTest, PropertyRemoved)
+{
+    PropertyHandle name(obj, "Name");
+    ASSERT_TRUE(name.isValid());
+
+    obj.removeProperty("Name");
+    ASSERT_FALSE(name.isValid());
+    ASSERT_THROW(name.getValue(), NotFoundException);
+
+    obj.addProperty(StringProperty("Name", "bar"));
+    ASSERT_TRUE(name.isValid());
+    ASSERT_EQ(name.getValue(), "bar");
+}
+
+TEST_F(PropertyHandleTest, PropertyAdded)
+{
+    PropertyHandle scale(obj, "Scale");
+    ASSERT_EQ(scale.getValue(), 2.5);
+
+    obj.addProperty(IntProperty("Other", 0));
+    ASSERT_EQ(scale.getValue(), 2.5);
+}
+
+TEST_F(PropertyHandleTest, NotFound)
+{
+    ASSERT_THROW(PropertyHandle(obj, "Missing"), NotFoundException);
+    ASSERT_THROW(PropertyHandle(obj, "Child.Missing"), NotFoundException);
+}
+
+TEST_F(PropertyHandleTest, ReferenceProperty)
+{
+    obj.addProperty(IntProperty("Selector", 0));
+    obj.addProperty(IntProperty("A", 1));
+    obj.addProperty(IntProperty("B", 2));
+    obj.addProperty(ReferenceProperty("Ref", EvalValue("switch($Selector, 0, %A, 1, %B)")));
+
+    PropertyHandle ref(obj, "Ref");
+    ASSERT_EQ(ref.getValue(), 1);
+
+    obj.setPropertyValue("Selector", 1);
+    ASSERT_EQ(ref.getValue(), 2);
+}
+
+TEST_F(PropertyHandleTest, ObjectDestroyed)
+{
+    auto temp = PropertyObject();
+    temp.addProperty(IntProperty("Value", 1));
+
+    PropertyHandle value(temp, "Value");
+    temp.release();
+
+    ASSERT_FALSE(value.isValid());
+    ASSERT_THROW(value.getValue(), InvalidStateException);
+}
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <limits>
 #include <type_traits>
 #include <coretypes/lock_free_stack.h>
 
@@ -29,7 +31,8 @@ class ObjectPool
 //	static_assert(HasNext<T>::value, "T should have next field");
 
 public:
-	ObjectPool(size_t initialCount);
+	// At most maxFreeCount objects are kept in the free list, objects returned to a full free list are deleted
+	ObjectPool(size_t initialCount, size_t maxFreeCount = std::numeric_limits<size_t>::max());
     ~ObjectPool();
 
 	template <class ... Params>
@@ -37,9 +40,12 @@ public:
 	void addToFreeList(T* obj);
 	size_t cleanup();
 	size_t getObjectCount() const;
+	size_t getFreeCount() const;
 
 private:
 	LockFreeStackHandle free_list;
+	const size_t maxFreeCount;
+	std::atomic<size_t> freeCount;
 	
 #ifndef NDEBUG
 	size_t objCount = 0;
@@ -50,8 +56,10 @@ private:
 };
 
 template <class T>
-ObjectPool<T>::ObjectPool(size_t initialCount)
+ObjectPool<T>::ObjectPool(size_t initialCount, size_t maxFreeCount)
 	: free_list(daqLockFreeStackCreate(initialCount))
+	, maxFreeCount(maxFreeCount)
+	, freeCount(0)
 {
 	init(initialCount);
 }
@@ -70,6 +78,7 @@ void ObjectPool<T>::init(size_t initialCount)
 		T* obj = new T(this);
 		daqLockFreeStackPush(free_list, obj);
 	}
+	freeCount = initialCount;
 
 #ifndef NDEBUG
 	objCount = initialCount;
@@ -85,6 +94,7 @@ size_t ObjectPool<T>::cleanupInternal()
 
 	while (T* obj = static_cast<T*>(daqLockFreeStackPop(free_list)))
 	{
+		freeCount.fetch_sub(1, std::memory_order_relaxed);
 		delete obj;
 #ifndef NDEBUG
 		cnt++;
@@ -107,7 +117,11 @@ template <class ... Params>
 T* ObjectPool<T>::get(Params... params)
 {
 	T* obj = static_cast<T*>(daqLockFreeStackPop(free_list));
-	if (!obj)
+	if (obj)
+	{
+		freeCount.fetch_sub(1, std::memory_order_relaxed);
+	}
+	else
 	{
 		obj = new T(this);
 
@@ -125,7 +139,18 @@ T* ObjectPool<T>::get(Params... params)
 template <class T>
 void ObjectPool<T>::addToFreeList(T* obj)
 {
-    daqLockFreeStackPush(free_list, obj);
+	if (freeCount.fetch_add(1, std::memory_order_relaxed) >= maxFreeCount)
+	{
+		freeCount.fetch_sub(1, std::memory_order_relaxed);
+		delete obj;
+
+#ifndef NDEBUG
+		objCount--;
+#endif
+		return;
+	}
+
+	daqLockFreeStackPush(free_list, obj);
 }
 
 template <class T>
@@ -144,4 +169,10 @@ size_t ObjectPool<T>::getObjectCount() const
 #endif 
 }
 
+template <class T>
+size_t ObjectPool<T>::getFreeCount() const
+{
+	return freeCount.load(std::memory_order_relaxed);
+}
+
 }
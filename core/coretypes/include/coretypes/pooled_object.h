@@ -30,7 +30,8 @@ namespace daq::object_pool
  * single instance serves many callers in turn. The pool destroys them when it is cleaned up.
  *
  * A derived type must call markLive() from its reset(), which is what ObjectPool::get() invokes as it
- * hands the object over.
+ * hands the object over. A derived type holding references to other objects releases them in park(),
+ * which is called as the object returns to the pool.
  */
 template <class Derived, class Impl>
 class PooledObject : public Impl
@@ -53,6 +54,7 @@ public:
         assert(newRefCount >= 0);
         if (newRefCount == 0)
         {
+            static_cast<Derived*>(this)->park();
             markParked();
             this->pool->addToFreeList(static_cast<Derived*>(this));
         }
@@ -60,6 +62,11 @@ public:
         return newRefCount;
     }
 
+    /// Called as the object returns to the pool. Hidden by derived types that have state to release.
+    void park()
+    {
+    }
+
 protected:
     /// Counts the object as in use for debug object tracking. Call when handing it to a caller.
     void markLive()
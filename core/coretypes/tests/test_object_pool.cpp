@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <coretypes/object_pool.h>
 #include <stack>
+#include <vector>
 
 using namespace daq::object_pool;
 
@@ -106,6 +107,32 @@ TEST(ObjectPoolTest, Create)
     pool.cleanup();
 }
 
+TEST(ObjectPoolTest, FreeListCapped)
+{
+    ObjectPool<PoolObject> pool(0, 2);
+
+    std::vector<PoolObject*> objects;
+    for (int i = 0; i < 3; ++i)
+    {
+        objects.push_back(pool.get(i));
+        objects.back()->addRef();
+    }
+    ASSERT_EQ(pool.getFreeCount(), 0u);
+
+    // the third released object does not fit in the free list and is deleted
+    for (const auto obj : objects)
+        obj->releaseRef();
+    ASSERT_EQ(pool.getFreeCount(), 2u);
+
+    auto obj = pool.get(42);
+    obj->addRef();
+    ASSERT_EQ(pool.getFreeCount(), 1u);
+    obj->releaseRef();
+
+    pool.cleanup();
+    ASSERT_EQ(pool.getFreeCount(), 0u);
+}
+
 constexpr size_t ObjCount = 1000;
 
 TEST(ObjectPoolTest, SpeedNoPool)
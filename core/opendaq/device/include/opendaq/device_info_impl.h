@@ -139,6 +139,12 @@ public:
     ErrCode INTERFACE_FUNC setPropertyValueNoLock(IString* propertyName, IBaseObject* value) override;
     ErrCode INTERFACE_FUNC setProtectedPropertyValue(IString* propertyName, IBaseObject* value) override;
 
+    // IPropertyValueRevision
+    ErrCode INTERFACE_FUNC getValueRevision(SizeT* revision) override;
+
+    // IPropertyValueSlots
+    ErrCode INTERFACE_FUNC resolveValueSlot(IString* propertyName, SizeT* slot, SizeT* layoutRevision) override;
+
     // IOwnable
     virtual ErrCode INTERFACE_FUNC setOwner(IPropertyObject* newOwner) override;
 
@@ -1140,6 +1146,27 @@ ErrCode DeviceInfoConfigImpl<TInterface, Interfaces...>::setProtectedPropertyVal
     return Super::setProtectedPropertyValue(propertyName, value);
 }
 
+template <typename TInterface, typename ... Interfaces>
+ErrCode DeviceInfoConfigImpl<TInterface, Interfaces...>::getValueRevision(SizeT* revision)
+{
+    OPENDAQ_PARAM_NOT_NULL(revision);
+
+    // Some of the values are stored in the owning device, so changes cannot be tracked by the revision
+    *revision = 0;
+    return OPENDAQ_IGNORED;
+}
+
+template <typename TInterface, typename ... Interfaces>
+ErrCode DeviceInfoConfigImpl<TInterface, Interfaces...>::resolveValueSlot(IString* propertyName, SizeT* slot, SizeT* layoutRevision)
+{
+    OPENDAQ_PARAM_NOT_NULL(propertyName);
+    OPENDAQ_PARAM_NOT_NULL(slot);
+    OPENDAQ_PARAM_NOT_NULL(layoutRevision);
+
+    // Some of the values are stored in the owning device and are read through getPropertyValue
+    return OPENDAQ_IGNORED;
+}
+
 template <typename TInterface, typename ... Interfaces>
 ErrCode DeviceInfoConfigImpl<TInterface, Interfaces...>::setOwner(IPropertyObject* newOwner)
 {
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/logger_component.h>
+#include <opendaq/logger_component_deferred_private.h>
+#include <opendaq/source_location.h>
+#include <coretypes/string_ptr.h>
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/*!
+ * @ingroup opendaq_logger
+ * @addtogroup opendaq_logger_deferred Deferred formatting
+ * @{
+ */
+
+/*
+ * Deferred formatting of log messages (OPENDAQ_LOGGER_DEFERRED_FORMAT).
+ *
+ * Instead of formatting the message on the logging thread, the log macros pass the format string and plain copies
+ * of the arguments to the logger component through `ILoggerComponentDeferredPrivate`. The component copies them
+ * into a record and formats the message on the logger thread pool.
+ *
+ * Only arithmetic values, void pointers and strings are deferred. Messages with other arguments, and messages logged
+ * to components that do not implement the interface, are formatted immediately.
+ */
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace deferred_log
+{
+
+template <typename T>
+constexpr bool IsStringArg = std::is_convertible_v<const T&, std::string_view> && !std::is_same_v<T, StringPtr>;
+
+template <typename T>
+constexpr bool IsDeferrableArg = std::is_same_v<T, bool> || std::is_same_v<T, char> ||
+                                 (std::is_integral_v<T> && !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t> &&
+                                  !std::is_same_v<T, char32_t>) ||
+                                 std::is_same_v<T, float> || std::is_same_v<T, double> ||
+                                 std::is_same_v<T, const void*> || std::is_same_v<T, void*> ||
+                                 std::is_same_v<T, StringPtr> || IsStringArg<T>;
+
+// Returns false if the argument must be formatted immediately.
+template <typename T>
+bool toDeferredArg(const T& value, DeferredLogArg& arg)
+{
+    using U = std::decay_t<T>;
+
+    if constexpr (std::is_same_v<U, bool>)
+    {
+        arg.type = DeferredLogArgType::Bool;
+        arg.boolValue = value;
+    }
+    else if constexpr (std::is_same_v<U, char>)
+    {
+        arg.type = DeferredLogArgType::Char;
+        arg.charValue = value;
+    }
+    else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+    {
+        arg.type = DeferredLogArgType::Int;
+        arg.intValue = static_cast<Int>(value);
+    }
+    else if constexpr (std::is_integral_v<U>)
+    {
+        arg.type = DeferredLogArgType::UInt;
+        arg.uintValue = static_cast<UInt>(value);
+    }
+    else if constexpr (std::is_same_v<U, float>)
+    {
+        arg.type = DeferredLogArgType::Float32;
+        arg.float32Value = value;
+    }
+    else if constexpr (std::is_same_v<U, double>)
+    {
+        arg.type = DeferredLogArgType::Float64;
+        arg.float64Value = value;
+    }
+    else if constexpr (std::is_same_v<U, const void*> || std::is_same_v<U, void*>)
+    {
+        arg.type = DeferredLogArgType::Pointer;
+        arg.pointerValue = value;
+    }
+    else
+    {
+        std::string_view str;
+        if constexpr (std::is_same_v<U, StringPtr>)
+            str = value.assigned() ? value.toView() : std::string_view("<empty>");
+        else if constexpr (std::is_same_v<U, const char*> || std::is_same_v<U, char*>)
+        {
+            const char* chars = value;
+            if (chars == nullptr)
+                return false;
+            str = chars;
+        }
+        else
+            str = std::string_view(value);
+
+        arg.type = DeferredLogArgType::String;
+        arg.stringValue = {str.data(), str.size()};
+    }
+
+    return true;
+}
+
+/*!
+ * @brief Logs a message formatted by `formatter` with `args`. If the component implements
+ * `ILoggerComponentDeferredPrivate` and the arguments can be deferred, the message is formatted by the component
+ * on the logger thread pool.
+ * @param component The logger component.
+ * @param level The log level of the message.
+ * @param format The format string of the message.
+ * @param formatter Captureless generic lambda formatting the message from its arguments on the calling thread.
+ * @param args The arguments of the message.
+ */
+template <typename Component, typename Formatter, typename... Args>
+void logFormatted(const Component& component, LogLevel level, const char* format, Formatter formatter, const Args&... args)
+{
+    if constexpr ((IsDeferrableArg<std::decay_t<Args>> && ...))
+    {
+        ILoggerComponentDeferredPrivate* deferred = nullptr;
+        if (OPENDAQ_SUCCEEDED(component->borrowInterface(ILoggerComponentDeferredPrivate::Id, reinterpret_cast<void**>(&deferred))))
+        {
+            std::array<DeferredLogArg, sizeof...(Args)> deferredArgs{};
+            [[maybe_unused]] SizeT index = 0;
+            if ((toDeferredArg(args, deferredArgs[index++]) && ...))
+            {
+                checkErrorInfo(deferred->logDeferredMessage(format, deferredArgs.data(), deferredArgs.size(), level));
+                return;
+            }
+        }
+    }
+
+    component.logMessage(SourceLocation{nullptr, 0, nullptr}, formatter(args...).data(), level);
+}
+
+}
+
+END_NAMESPACE_OPENDAQ
+
+/*!@}*/
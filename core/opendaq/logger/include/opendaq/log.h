@@ -22,6 +22,10 @@
 
 #include <fmt/format.h>
 
+#if defined(OPENDAQ_LOGGER_DEFERRED_FORMAT) && !defined(OPENDAQ_LOGGER_SYNC)
+    #include <opendaq/deferred_log.h>
+#endif
+
 #if !defined(OPENDAQ_LOG_LEVEL)
     #ifdef NDEBUG
         #define OPENDAQ_LOG_LEVEL OPENDAQ_LOG_LEVEL_INFO
@@ -32,8 +36,14 @@
 
 /// Plain
 
-#define DAQLOG_PLAIN(loggerComponent, message, level) loggerComponent.logMessage(\
-    daq::SourceLocation{nullptr, 0, nullptr}, message, level);
+// The level of the component is checked first, so that the message is not built when it would be discarded.
+
+#define DAQLOG_PLAIN(loggerComponent, message, level)                                                \
+    do                                                                                               \
+    {                                                                                                \
+        if (loggerComponent.shouldLog(level))                                                        \
+            loggerComponent.logMessage(daq::SourceLocation{nullptr, 0, nullptr}, message, level);    \
+    } while (false);
 
 #if (OPENDAQ_LOG_LEVEL <= OPENDAQ_LOG_LEVEL_TRACE)
     #define DAQLOG_T(loggerComponent, message) DAQLOG_PLAIN(loggerComponent, message, daq::LogLevel::Trace);
@@ -73,10 +83,32 @@
 
 /// Format
 
-#define DAQLOG_FORMATTED(loggerComponent, message, logLevel, ...)                                    \
-    loggerComponent.logMessage(daq::SourceLocation{nullptr, 0, nullptr},    \
-                               fmt::format(FMT_STRING(message), ##__VA_ARGS__).data(),               \
-                               logLevel);
+// The arguments are evaluated and the message is formatted only if the level of the component allows it.
+// With OPENDAQ_LOGGER_DEFERRED_FORMAT, the arguments are copied by the logger component and the message is formatted
+// on the logger thread pool (see deferred_log.h).
+
+#if defined(OPENDAQ_LOGGER_DEFERRED_FORMAT) && !defined(OPENDAQ_LOGGER_SYNC)
+    #define DAQLOG_FORMATTED(loggerComponent, message, logLevel, ...)                                \
+        do                                                                                           \
+        {                                                                                            \
+            if (loggerComponent.shouldLog(logLevel))                                                 \
+                daq::deferred_log::logFormatted(                                                     \
+                    loggerComponent,                                                                 \
+                    logLevel,                                                                        \
+                    message,                                                                         \
+                    [](const auto&... formatArgs) { return fmt::format(FMT_STRING(message), formatArgs...); }, \
+                    ##__VA_ARGS__);                                                                  \
+        } while (false);
+#else
+    #define DAQLOG_FORMATTED(loggerComponent, message, logLevel, ...)                                \
+        do                                                                                           \
+        {                                                                                            \
+            if (loggerComponent.shouldLog(logLevel))                                                 \
+                loggerComponent.logMessage(daq::SourceLocation{nullptr, 0, nullptr},                 \
+                                           fmt::format(FMT_STRING(message), ##__VA_ARGS__).data(),   \
+                                           logLevel);                                                \
+        } while (false);
+#endif
 
 #if (OPENDAQ_LOG_LEVEL <= OPENDAQ_LOG_LEVEL_TRACE)
     #define DAQLOGF_T(loggerComponent, message, ...) \
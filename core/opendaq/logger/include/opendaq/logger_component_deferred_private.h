@@ -0,0 +1,85 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+#include <coretypes/baseobject.h>
+#include <opendaq/log_level.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_logger
+ * @addtogroup opendaq_logger_deferred Deferred formatting
+ * @{
+ */
+
+enum class DeferredLogArgType : uint32_t
+{
+    Int = 0,
+    UInt,
+    Float32,
+    Float64,
+    Bool,
+    Char,
+    String,
+    Pointer
+};
+
+struct DeferredLogString
+{
+    ConstCharPtr data;
+    SizeT size;
+};
+
+/*!
+ * @brief A plain copy of a log message argument. The value of a string is referenced and must stay valid
+ * until `logDeferredMessage` returns.
+ */
+struct DeferredLogArg
+{
+    DeferredLogArgType type;
+    union
+    {
+        Int intValue;
+        UInt uintValue;
+        float float32Value;
+        Float float64Value;
+        bool boolValue;
+        char charValue;
+        const void* pointerValue;
+        DeferredLogString stringValue;
+    };
+};
+
+DECLARE_OPENDAQ_INTERFACE(ILoggerComponentDeferredPrivate, IBaseObject)
+{
+    /*!
+     * @brief Logs a message that is formatted from the format string and the arguments by the logger thread pool.
+     * @param format The fmt format string of the message.
+     * @param args The arguments of the message.
+     * @param argCount The number of arguments.
+     * @param level The log level of the message.
+     *
+     * The format string and the arguments are copied before the call returns. Messages that do not fit into a record,
+     * or that are logged while all records of the calling thread are in use, are formatted immediately.
+     */
+    virtual ErrCode INTERFACE_FUNC logDeferredMessage(ConstCharPtr format, const DeferredLogArg* args, SizeT argCount, LogLevel level) = 0;
+};
+
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
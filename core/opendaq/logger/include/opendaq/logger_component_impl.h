@@ -16,19 +16,21 @@
 
 #pragma once
 #include <opendaq/logger_component.h>
+#include <opendaq/logger_component_deferred_private.h>
 #include <opendaq/logger_thread_pool_ptr.h>
 
 #include <coretypes/intfs.h>
 #include <coretypes/listobject_factory.h>
 #include <coretypes/string_ptr.h>
 
+#include <atomic>
 #include <memory>
 
 #include <spdlog/async_logger.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
-class LoggerComponentImpl final : public ImplementationOf<ILoggerComponent>
+class LoggerComponentImpl final : public ImplementationOf<ILoggerComponent, ILoggerComponentDeferredPrivate>
 {
 public:
 #ifdef OPENDAQ_LOGGER_SYNC
@@ -55,10 +57,18 @@ public:
 
     ErrCode INTERFACE_FUNC toString(CharPtr* str) override;
 
+    // ILoggerComponentDeferredPrivate
+    ErrCode INTERFACE_FUNC logDeferredMessage(ConstCharPtr format, const DeferredLogArg* args, SizeT argCount, LogLevel level) override;
+
 private:
     LoggerComponentTypePtr spdlogLogger;
     LoggerThreadPoolPtr threadPool;
 
+    // Messages are filtered by level here, so the spdlog logger lets all messages through.
+    std::atomic<LogLevel> currentLevel;
+
+    bool shouldLogLevel(LogLevel level) const;
+
     LogLevel getDefaultLogLevel();
     LogLevel getLogLevelFromParam(LogLevel logLevel);
 };
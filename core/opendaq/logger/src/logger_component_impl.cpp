@@ -14,6 +14,15 @@
 #include <spdlog/async.h>
 #include <spdlog/spdlog.h>
 
+#include <fmt/args.h>
+#include <fmt/format.h>
+
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <string_view>
+
 BEGIN_NAMESPACE_OPENDAQ
 
 static ILoggerThreadPoolPrivate::ThreadPoolPtr getThreadPool(const LoggerThreadPoolPtr& threadPool)
@@ -25,6 +34,272 @@ static ILoggerThreadPoolPrivate::ThreadPoolPtr getThreadPool(const LoggerThreadP
     return threadPoolImpl;
 }
 
+static std::string formatDeferredMessage(std::string_view format, const DeferredLogArg* args, SizeT argCount)
+{
+    try
+    {
+        fmt::dynamic_format_arg_store<fmt::format_context> store;
+        store.reserve(argCount, 0);
+
+        for (SizeT i = 0; i < argCount; ++i)
+        {
+            const DeferredLogArg& arg = args[i];
+            switch (arg.type)
+            {
+                case DeferredLogArgType::Int:
+                    store.push_back(arg.intValue);
+                    break;
+                case DeferredLogArgType::UInt:
+                    store.push_back(arg.uintValue);
+                    break;
+                case DeferredLogArgType::Float32:
+                    store.push_back(arg.float32Value);
+                    break;
+                case DeferredLogArgType::Float64:
+                    store.push_back(arg.float64Value);
+                    break;
+                case DeferredLogArgType::Bool:
+                    store.push_back(arg.boolValue);
+                    break;
+                case DeferredLogArgType::Char:
+                    store.push_back(arg.charValue);
+                    break;
+                case DeferredLogArgType::String:
+                    store.push_back(fmt::string_view(arg.stringValue.data, arg.stringValue.size));
+                    break;
+                case DeferredLogArgType::Pointer:
+                    store.push_back(arg.pointerValue);
+                    break;
+                default:
+                    return fmt::format("Failed to format log message \"{}\": invalid argument type", format);
+            }
+        }
+
+        return fmt::vformat(fmt::string_view(format.data(), format.size()), store);
+    }
+    catch (const std::exception& e)
+    {
+        return fmt::format("Failed to format log message \"{}\": {}", format, e.what());
+    }
+}
+
+#ifndef OPENDAQ_LOGGER_SYNC
+
+// Deferred log records are taken from a lock-free ring owned by the logging thread. The copied format string and
+// arguments of the message are passed to the spdlog logger in place of the source location, and the message is
+// formatted by DeferredFormatSink on the logger thread pool, after which the record is returned to its ring.
+namespace
+{
+
+constexpr std::size_t RecordRingSize = 128;
+constexpr std::size_t RecordArgsCapacity = 16;
+constexpr std::size_t RecordTextCapacity = 256;
+
+// Source line and function name that mark a record in place of a source location; the tag is compared by address.
+constexpr int RecordLine = -1;
+constexpr char RecordTag[] = "<daq deferred log record>";
+
+struct RecordRing;
+
+struct Record
+{
+    std::atomic<bool> used{false};
+    RecordRing* ring{};
+    std::string_view format;
+    SizeT argCount{};
+    DeferredLogArg args[RecordArgsCapacity];
+    char text[RecordTextCapacity];
+};
+
+// Written only by the owner thread and released by the sink. The ring is kept alive by its owner thread
+// and by every record that has not been released yet.
+struct RecordRing
+{
+    std::atomic<std::size_t> refCount{1};
+    std::size_t head{};
+    Record records[RecordRingSize];
+
+    void release()
+    {
+        if (refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete this;
+    }
+};
+
+class ThreadRecordRing
+{
+public:
+    ~ThreadRecordRing()
+    {
+        if (ring != nullptr)
+            ring->release();
+    }
+
+    RecordRing* get()
+    {
+        if (ring == nullptr)
+            ring = new RecordRing();
+        return ring;
+    }
+
+private:
+    RecordRing* ring{};
+};
+
+Record* acquireRecord()
+{
+    static thread_local ThreadRecordRing threadRing;
+
+    RecordRing* ring = threadRing.get();
+    Record& record = ring->records[ring->head];
+    if (record.used.load(std::memory_order_acquire))
+        return nullptr;
+
+    ring->head = (ring->head + 1) % RecordRingSize;
+    ring->refCount.fetch_add(1, std::memory_order_relaxed);
+    record.used.store(true, std::memory_order_relaxed);
+    record.ring = ring;
+    return &record;
+}
+
+void releaseRecord(Record* record)
+{
+    RecordRing* ring = record->ring;
+    record->used.store(false, std::memory_order_release);
+    ring->release();
+}
+
+// Copies the message into a record. Returns nullptr if the message does not fit or no record is free.
+Record* createRecord(ConstCharPtr format, const DeferredLogArg* args, SizeT argCount)
+{
+    if (argCount > RecordArgsCapacity)
+        return nullptr;
+
+    const std::size_t formatSize = std::strlen(format);
+    std::size_t textSize = formatSize;
+    for (SizeT i = 0; i < argCount; ++i)
+    {
+        if (args[i].type == DeferredLogArgType::String)
+            textSize += args[i].stringValue.size;
+    }
+
+    if (textSize > RecordTextCapacity)
+        return nullptr;
+
+    Record* record = acquireRecord();
+    if (record == nullptr)
+        return nullptr;
+
+    char* text = record->text;
+    std::memcpy(text, format, formatSize);
+    record->format = std::string_view(text, formatSize);
+    text += formatSize;
+
+    for (SizeT i = 0; i < argCount; ++i)
+    {
+        record->args[i] = args[i];
+        if (args[i].type == DeferredLogArgType::String)
+        {
+            std::memcpy(text, args[i].stringValue.data, args[i].stringValue.size);
+            record->args[i].stringValue.data = text;
+            text += args[i].stringValue.size;
+        }
+    }
+    record->argCount = argCount;
+
+    return record;
+}
+
+Record* getRecord(const spdlog::source_loc& source)
+{
+    if (source.line != RecordLine || source.funcname != RecordTag)
+        return nullptr;
+
+    return reinterpret_cast<Record*>(const_cast<char*>(source.filename));
+}
+
+}
+
+// Formats deferred log records on the logger thread pool and forwards the messages to the sinks of the component.
+class DeferredFormatSink final : public spdlog::sinks::sink
+{
+public:
+    explicit DeferredFormatSink(std::vector<spdlog::sink_ptr> sinks)
+        : sinks(std::move(sinks))
+    {
+    }
+
+    void log(const spdlog::details::log_msg& msg) override
+    {
+        Record* record = getRecord(msg.source);
+        if (record == nullptr)
+        {
+            sinkMessage(msg);
+            return;
+        }
+
+        const bool anySinkLogs = std::any_of(sinks.begin(), sinks.end(), [&msg](const spdlog::sink_ptr& sink) { return sink->should_log(msg.level); });
+        if (!anySinkLogs)
+        {
+            releaseRecord(record);
+            return;
+        }
+
+        const std::string payload = formatDeferredMessage(record->format, record->args, record->argCount);
+        releaseRecord(record);
+
+        spdlog::details::log_msg formatted(msg.time, spdlog::source_loc{}, msg.logger_name, msg.level, payload);
+        formatted.thread_id = msg.thread_id;
+        sinkMessage(formatted);
+    }
+
+    void flush() override
+    {
+        for (const auto& sink : sinks)
+            sink->flush();
+    }
+
+    void set_pattern(const std::string& pattern) override
+    {
+        for (const auto& sink : sinks)
+            sink->set_pattern(pattern);
+    }
+
+    void set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter) override
+    {
+        for (const auto& sink : sinks)
+            sink->set_formatter(sinkFormatter->clone());
+    }
+
+private:
+    void sinkMessage(const spdlog::details::log_msg& msg)
+    {
+        std::exception_ptr error;
+        for (const auto& sink : sinks)
+        {
+            if (!sink->should_log(msg.level))
+                continue;
+
+            try
+            {
+                sink->log(msg);
+            }
+            catch (...)
+            {
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    std::vector<spdlog::sink_ptr> sinks;
+};
+
+#endif
+
 LoggerComponentImpl::LoggerComponentImpl(const StringPtr& name, const ListPtr<ILoggerSink>& sinks,
                                          const LoggerThreadPoolPtr& threadPool, LogLevel level)
 #ifdef OPENDAQ_LOGGER_SYNC
@@ -41,13 +316,16 @@ LoggerComponentImpl::LoggerComponentImpl(const StringPtr& name, const ListPtr<IL
     )
 #endif
     , threadPool(std::move(threadPool))
+    , currentLevel(LogLevel::Trace)
 {
-    spdlogLogger->set_level(static_cast<spdlog::level::level_enum>(getLogLevelFromParam(level)));
+    spdlogLogger->set_level(spdlog::level::trace);
+    currentLevel = getLogLevelFromParam(level);
 
     if (!sinks.assigned())
     {
         DAQ_THROW_EXCEPTION(ArgumentNullException, "Sinks List must not be null.");
     }
+    std::vector<spdlog::sink_ptr> sinkImpls;
     for (const ObjectPtr<ILoggerSink>& sink : sinks)
     {
         if(!sink.assigned())
@@ -59,8 +337,14 @@ LoggerComponentImpl::LoggerComponentImpl(const StringPtr& name, const ListPtr<IL
         {
             DAQ_THROW_EXCEPTION(InvalidTypeException, "Sink must have valid type");
         }
-        spdlogLogger->sinks().push_back(sinkPtr.getSinkImpl());
+        sinkImpls.push_back(sinkPtr.getSinkImpl());
     }
+
+#ifndef OPENDAQ_LOGGER_SYNC
+    spdlogLogger->sinks().push_back(std::make_shared<DeferredFormatSink>(std::move(sinkImpls)));
+#else
+    spdlogLogger->sinks() = std::move(sinkImpls);
+#endif
 }
 
 ErrCode LoggerComponentImpl::getName(IString** name)
@@ -78,7 +362,7 @@ ErrCode LoggerComponentImpl::getName(IString** name)
 
 ErrCode LoggerComponentImpl::setLevel(LogLevel level)
 {
-    spdlogLogger->set_level(static_cast<spdlog::level::level_enum>(getLogLevelFromParam(level)));
+    currentLevel = getLogLevelFromParam(level);
     return OPENDAQ_SUCCESS;
 }
 
@@ -88,18 +372,44 @@ ErrCode LoggerComponentImpl::getLevel(LogLevel* level)
     {
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_ARGUMENT_NULL, "Can not return by a null pointer.");
     }
-    *level = (LogLevel) spdlogLogger->level();
+    *level = currentLevel.load(std::memory_order_relaxed);
 
     return OPENDAQ_SUCCESS;
 }
 
 ErrCode LoggerComponentImpl::logMessage(SourceLocation location, ConstCharPtr msg, LogLevel level)
 {
+    if (!shouldLogLevel(level))
+        return OPENDAQ_SUCCESS;
+
     spdlogLogger->log(
         spdlog::source_loc(location.fileName, static_cast<int>(location.line), location.funcName), static_cast<spdlog::level::level_enum>(level), msg);
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode LoggerComponentImpl::logDeferredMessage(ConstCharPtr format, const DeferredLogArg* args, SizeT argCount, LogLevel level)
+{
+    OPENDAQ_PARAM_NOT_NULL(format);
+    if (argCount > 0)
+        OPENDAQ_PARAM_NOT_NULL(args);
+
+    if (!shouldLogLevel(level))
+        return OPENDAQ_SUCCESS;
+
+#ifndef OPENDAQ_LOGGER_SYNC
+    if (Record* record = createRecord(format, args, argCount))
+    {
+        spdlogLogger->log(
+            spdlog::source_loc(reinterpret_cast<const char*>(record), RecordLine, RecordTag), static_cast<spdlog::level::level_enum>(level), "");
+        return OPENDAQ_SUCCESS;
+    }
+#endif
+
+    spdlogLogger->log(
+        spdlog::source_loc{}, static_cast<spdlog::level::level_enum>(level), formatDeferredMessage(format, args, argCount));
+    return OPENDAQ_SUCCESS;
+}
+
 ErrCode LoggerComponentImpl::setPattern(IString* pattern)
 {
     OPENDAQ_PARAM_NOT_NULL(pattern);
@@ -115,7 +425,7 @@ ErrCode LoggerComponentImpl::shouldLog(LogLevel level, Bool* willLog)
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_ARGUMENT_NULL, "Can not return by a null pointer.");
     }
 
-    *willLog = spdlogLogger->should_log(static_cast<spdlog::level::level_enum>(level));
+    *willLog = shouldLogLevel(level);
     return OPENDAQ_SUCCESS;
 }
 
@@ -136,6 +446,11 @@ ErrCode LoggerComponentImpl::toString(CharPtr* str)
     return daqDuplicateCharPtr(spdlogLogger->name().data(), str);
 }
 
+bool LoggerComponentImpl::shouldLogLevel(LogLevel level) const
+{
+    return level >= currentLevel.load(std::memory_order_relaxed);
+}
+
 LogLevel LoggerComponentImpl::getDefaultLogLevel()
 {
     int logLevel = -1;
@@ -0,0 +1,138 @@
+#ifdef OPENDAQ_LOG_LEVEL
+#undef OPENDAQ_LOG_LEVEL
+#endif
+
+#define OPENDAQ_LOG_LEVEL OPENDAQ_LOG_LEVEL_TRACE
+
+// Log macros of this file defer formatting regardless of the OPENDAQ_USE_DEFERRED_LOG_FORMATTING option
+#ifndef OPENDAQ_LOGGER_DEFERRED_FORMAT
+#define OPENDAQ_LOGGER_DEFERRED_FORMAT
+#endif
+
+#include <testutils/testutils.h>
+#include <opendaq/logger_sink_factory.h>
+#include <opendaq/logger_component_factory.h>
+#include <opendaq/logger_thread_pool_factory.h>
+#include <opendaq/logger_component_deferred_private.h>
+
+#include <opendaq/log.h>
+#include <opendaq/custom_log.h>
+#include <opendaq/logger_sink_last_message_private_ptr.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+using namespace daq;
+
+class DeferredLogTest : public testing::Test
+{
+public:
+    void TearDown() override
+    {
+        using namespace std::chrono_literals;
+
+        // Wait for Async logger to flush
+        std::this_thread::sleep_for(100ms);
+    }
+};
+
+TEST_F(DeferredLogTest, ImplementsInterface)
+{
+    auto loggerComponent = LoggerComponent("testDeferred");
+    ASSERT_TRUE(loggerComponent.supportsInterface<ILoggerComponentDeferredPrivate>());
+}
+
+TEST_F(DeferredLogTest, LogDeferredMessage)
+{
+    auto sink = LastMessageLoggerSink();
+    LastMessageLoggerSinkPrivatePtr privateSink = sink;
+    auto loggerComponent = LoggerComponent("testDeferredMessage", {sink}, LoggerThreadPool(), LogLevel::Info);
+    auto deferred = loggerComponent.asPtr<ILoggerComponentDeferredPrivate>();
+
+    std::string format = "{} {} {:.2f} {} {}";
+    std::string str = "string";
+
+    DeferredLogArg args[5];
+    args[0].type = DeferredLogArgType::Int;
+    args[0].intValue = -1;
+    args[1].type = DeferredLogArgType::UInt;
+    args[1].uintValue = 2;
+    args[2].type = DeferredLogArgType::Float64;
+    args[2].float64Value = 0.5;
+    args[3].type = DeferredLogArgType::Bool;
+    args[3].boolValue = true;
+    args[4].type = DeferredLogArgType::String;
+    args[4].stringValue = {str.data(), str.size()};
+
+    ASSERT_EQ(deferred->logDeferredMessage(format.c_str(), args, 5, LogLevel::Info), OPENDAQ_SUCCESS);
+
+    // the format string and the arguments are copied by the component
+    format.assign(format.size(), 'x');
+    str.assign(str.size(), 'x');
+
+    ASSERT_TRUE(privateSink.waitForMessage(1000));
+    ASSERT_EQ(privateSink.getLastMessage(), "-1 2 0.50 true string");
+}
+
+TEST_F(DeferredLogTest, FormattedMessage)
+{
+    auto sink = LastMessageLoggerSink();
+    LastMessageLoggerSinkPrivatePtr privateSink = sink;
+    auto loggerComponent = LoggerComponent("testDeferredFormatted", {sink}, LoggerThreadPool(), LogLevel::Info);
+
+    std::string str = "string";
+    const char* chars = "chars";
+    StringPtr strPtr = "StringPtr";
+    StringPtr emptyPtr;
+    LOG_I("{} {} {} {} {} {:.1f} {} {}", str, chars, strPtr, emptyPtr, 1, 2.5, 0.1f, 'c')
+    str.clear();
+
+    ASSERT_TRUE(privateSink.waitForMessage(1000));
+    ASSERT_EQ(privateSink.getLastMessage(), "string chars StringPtr <empty> 1 2.5 0.1 c");
+}
+
+TEST_F(DeferredLogTest, MessageNotDeferred)
+{
+    auto sink = LastMessageLoggerSink();
+    LastMessageLoggerSinkPrivatePtr privateSink = sink;
+    auto loggerComponent = LoggerComponent("testDeferredNotDeferred", {sink}, LoggerThreadPool(), LogLevel::Info);
+
+    // long double arguments are formatted immediately
+    LOG_I("{} {}", 1.5L, 2)
+
+    ASSERT_TRUE(privateSink.waitForMessage(1000));
+    ASSERT_EQ(privateSink.getLastMessage(), "1.5 2");
+
+    // messages that do not fit into a record are formatted immediately
+    const std::string longString(1000, 'a');
+    LOG_I("{} {}", longString, 3)
+
+    ASSERT_TRUE(privateSink.waitForMessage(1000));
+    ASSERT_EQ(privateSink.getLastMessage(), longString + " 3");
+}
+
+TEST_F(DeferredLogTest, MessagesFromThreads)
+{
+    auto sink = LastMessageLoggerSink();
+    LastMessageLoggerSinkPrivatePtr privateSink = sink;
+    auto loggerComponent = LoggerComponent("testDeferredThreads", {sink}, LoggerThreadPool(), LogLevel::Info);
+
+    // more messages than fit into the record ring of a thread
+    auto func = [loggerComponent](int threadNumber)
+    {
+        for (int i = 0; i < 1000; ++i)
+            LOG_I("thread {} message {}", threadNumber, i)
+    };
+
+    std::thread thread1(func, 1);
+    std::thread thread2(func, 2);
+    thread1.join();
+    thread2.join();
+
+    LOG_I("done {}", 3)
+    loggerComponent.flush();
+
+    ASSERT_TRUE(privateSink.waitForMessage(1000));
+    ASSERT_EQ(privateSink.getLastMessage(), "done 3");
+}
@@ -16,6 +16,7 @@
 #include <coretypes/listobject_factory.h>
 #include <coretypes/impl.h>
 #include <opendaq/logger_sink_ptr.h>
+#include <opendaq/logger_sink_last_message_private_ptr.h>
 
 #include <chrono>
 #include <thread>
@@ -246,6 +247,80 @@ TEST_F(LoggerComponentTest, ShouldLogNullOutput)
     ASSERT_ERROR_CODE_EQ(err, OPENDAQ_ERR_ARGUMENT_NULL);
 }
 
+TEST_F(LoggerComponentTest, DisabledLevelArgumentsNotEvaluated)
+{
+    auto loggerComponent = LoggerComponent("testLazy", {StdErrLoggerSink()}, LoggerThreadPool(), LogLevel::Info);
+
+    int evaluated = 0;
+    auto arg = [&evaluated]
+    {
+        evaluated++;
+        return evaluated;
+    };
+
+    LOG_T("trace {}", arg())
+    LOG_D("debug {}", arg())
+    LOGP_D(std::to_string(arg()).c_str())
+    ASSERT_EQ(evaluated, 0);
+
+    LOG_I("info {}", arg())
+    LOGP_W(std::to_string(arg()).c_str())
+    ASSERT_EQ(evaluated, 2);
+
+    loggerComponent.setLevel(LogLevel::Debug);
+    LOG_D("debug {}", arg())
+    ASSERT_EQ(evaluated, 3);
+
+    loggerComponent.flush();
+}
+
+TEST_F(LoggerComponentTest, FormattedMessage)
+{
+    auto sink = LastMessageLoggerSink();
+    LastMessageLoggerSinkPrivatePtr privateSink = sink;
+    auto loggerComponent = LoggerComponent("testFormatted", {sink}, LoggerThreadPool(), LogLevel::Info);
+
+    std::string str = "string";
+    const char* chars = "chars";
+    StringPtr strPtr = "StringPtr";
+    LOG_I("{} {} {} {} {:.1f}", str, chars, strPtr, 1, 2.5)
+    str.clear();
+
+    ASSERT_TRUE(privateSink.waitForMessage(1000));
+    ASSERT_EQ(privateSink.getLastMessage(), "string chars StringPtr 1 2.5");
+
+    LOG_D("debug")
+    LOG_W("{:>3}", 5)
+
+    ASSERT_TRUE(privateSink.waitForMessage(1000));
+    ASSERT_EQ(privateSink.getLastMessage(), "  5");
+}
+
+TEST_F(LoggerComponentTest, FormattedMessagesFromThreads)
+{
+    auto sink = LastMessageLoggerSink();
+    LastMessageLoggerSinkPrivatePtr privateSink = sink;
+    auto loggerComponent = LoggerComponent("testFormattedThreads", {sink}, LoggerThreadPool(), LogLevel::Info);
+
+    // more messages than fit into the record ring of a thread
+    auto func = [loggerComponent](int threadNumber)
+    {
+        for (int i = 0; i < 1000; ++i)
+            LOG_I("thread {} message {}", threadNumber, i)
+    };
+
+    std::thread thread1(func, 1);
+    std::thread thread2(func, 2);
+    thread1.join();
+    thread2.join();
+
+    LOG_I("done {}", 3)
+    loggerComponent.flush();
+
+    ASSERT_TRUE(privateSink.waitForMessage(1000));
+    ASSERT_EQ(privateSink.getLastMessage(), "done 3");
+}
+
 // Log levels tests
 
 //// Trace
@@ -22,7 +22,13 @@
 #include <opendaq/logger_component_ptr.h>
 #include <opendaq/module_manager.h>
 #include <opendaq/module_ptr.h>
+#include <opendaq/component_type_ptr.h>
 #include <coretypes/common.h>
+#include <coretypes/dictobject_factory.h>
+#include <chrono>
+#include <exception>
+#include <string>
+#include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -33,4 +39,31 @@ struct ModuleLibrary
     StringPtr path;
 };
 
+struct ModuleComponentTypes
+{
+    DictPtr<IString, IComponentType> types;
+    bool failed{};
+    std::string error;
+};
+
+// A module library loaded on a loader thread, before it is added to the module manager.
+struct LoadedModuleLibrary
+{
+    StringPtr path;
+    StringPtr moduleKey;
+    ModuleLibrary library;
+    std::exception_ptr error;
+    std::chrono::steady_clock::duration loadTime{};
+    ModuleComponentTypes deviceTypes;
+    ModuleComponentTypes functionBlockTypes;
+    ModuleComponentTypes serverTypes;
+};
+
+// A module library whose manifest was found in the manifest cache and that is loaded on first use.
+struct PendingModuleLibrary
+{
+    StringPtr path;
+    std::vector<std::string> functionBlockTypeIds;
+};
+
 END_NAMESPACE_OPENDAQ
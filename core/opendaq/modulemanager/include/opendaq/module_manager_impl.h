@@ -26,13 +26,17 @@
 #include <opendaq/mirrored_device_config_ptr.h>
 #include <opendaq/streaming_ptr.h>
 #include <map>
+#include <unordered_set>
 #include <thread>
+#include <mutex>
 #include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/io_context.hpp>
 #include <opendaq/module_ptr.h>
 #include <tsl/ordered_map.h>
 #include <daq_discovery/daq_discovery_client.h>
 #include <opendaq/module_authenticator_ptr.h>
+#include <opendaq/module_manifest_cache.h>
+#include <opendaq/module_library.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 struct ModuleLibrary;
@@ -116,9 +120,17 @@ private:
     void onCompleteCapabilities(const DevicePtr& device, const DeviceInfoPtr& discoveredDeviceInfo);
 
     ErrCode tryLoadAndAddModule(const StringPtr& path, IModule** module);
-    template <typename Functor>
-    void printComponentTypes(Functor func, const std::string& kind);
-    void printAvailableTypes(const ModulePtr& module);
+    ErrCode prepareModuleLoad(const StringPtr& path, IModule** module, StringPtr& moduleKey);
+    void loadModuleLibrary(LoadedModuleLibrary& loaded) const;
+    void loadModuleLibraries(std::vector<LoadedModuleLibrary>& loaded, bool parallel) const;
+    void loadModuleLibrariesUnlocked(std::vector<LoadedModuleLibrary>& loaded, std::unique_lock<std::recursive_mutex>& lock);
+    ErrCode addLoadedModule(LoadedModuleLibrary& loaded, IModule** module);
+    void loadPendingModules(const StringPtr& functionBlockTypeId = nullptr);
+    std::vector<ModulePtr> getLoadedModules() const;
+    bool hasPendingModules() const;
+    void logModuleLoadError();
+    void printComponentTypes(const ModuleComponentTypes& componentTypes, const std::string& kind);
+    void printAvailableTypes(const LoadedModuleLibrary& loaded);
 
     bool authenticatedModulesOnly;
     ModuleAuthenticatorPtr moduleAuthenticator;
@@ -126,7 +138,17 @@ private:
 
     bool modulesLoaded;
     std::vector<std::string> paths;
+    // Guards the libraries and pending modules; recursive as modules can call back into the manager while they are loaded.
+    // It is released while module libraries are loaded by loadModules and loadPendingModules, so that modules loaded on
+    // the loader threads can call back as well. Readers iterate over a copy of the loaded modules returned by getLoadedModules.
+    mutable std::recursive_mutex librariesSync;
+    // The number of times the owning thread holds librariesSync through the module loading entry points
+    std::size_t librariesLockDepth;
+    // Paths of the modules loaded while librariesSync is released
+    std::unordered_set<std::string> loadingModulePaths;
     std::vector<ModuleLibrary> libraries;
+    std::vector<PendingModuleLibrary> pendingModules;
+    ModuleManifestCache manifestCache;
     LoggerPtr logger;
     LoggerComponentPtr loggerComponent;
 
@@ -145,6 +167,7 @@ private:
     std::chrono::time_point<std::chrono::steady_clock> lastScanTime;
     std::chrono::milliseconds rescanTimer;
     Bool safeLoadingMode;
+    Bool parallelLoading;
 };
 
 END_NAMESPACE_OPENDAQ
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <coretypes/common.h>
+#include <coretypes/filesystem.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*
+ * Describes a module library that was loaded successfully. The manifest is valid for as long as
+ * the size and the last write time of the library file match.
+ */
+struct ModuleManifest
+{
+    std::string path;
+    std::uintmax_t fileSize{};
+    std::int64_t lastWriteTime{};
+    std::string moduleId;
+    std::vector<std::string> functionBlockTypeIds;
+};
+
+/*
+ * On-disk cache of module manifests, used to defer loading of module libraries until one of their
+ * component types is requested. The cache is discarded as a whole if it was written by a different SDK version.
+ */
+class ModuleManifestCache
+{
+public:
+    ModuleManifestCache() = default;
+    ModuleManifestCache(std::string cachePath, std::string sdkVersion);
+
+    bool isEnabled() const;
+
+    void load();
+    bool save();
+
+    const ModuleManifest* find(const fs::path& modulePath) const;
+    void update(const fs::path& modulePath, std::string moduleId, std::vector<std::string> functionBlockTypeIds);
+    void remove(const fs::path& modulePath);
+
+private:
+    static bool GetFileStamp(const fs::path& modulePath, std::uintmax_t& fileSize, std::int64_t& lastWriteTime);
+
+    std::string cachePath;
+    std::string sdkVersion;
+    std::unordered_map<std::string, ModuleManifest> manifests;
+    bool modified{};
+};
+
+END_NAMESPACE_OPENDAQ
@@ -13,6 +13,8 @@
 #include <opendaq/device_private.h>
 #include <string>
 #include <future>
+#include <thread>
+#include <atomic>
 #include <boost/algorithm/string.hpp>
 #include <opendaq/search_filter_factory.h>
 #include <coretypes/validation.h>
@@ -51,14 +53,40 @@ static constexpr char getCoreVersionMetadataFunc[] = "getCoreVersionMetadata";
 static void GetModulesPath(std::vector<fs::path>& modulesPath, const LoggerComponentPtr& loggerComponent, std::string searchFolder);
 static ModuleLibrary loadModuleInternal(const LoggerComponentPtr& loggerComponent, const fs::path& path, IContext* context, Bool safeLoadingMode);
 
+namespace
+{
+
+// Counts the nesting of the module loading entry points on the thread holding the libraries lock
+class LibrariesLockDepthGuard
+{
+public:
+    explicit LibrariesLockDepthGuard(std::size_t& depth)
+        : depth(depth)
+    {
+        ++depth;
+    }
+
+    ~LibrariesLockDepthGuard()
+    {
+        --depth;
+    }
+
+private:
+    std::size_t& depth;
+};
+
+}
+
 ModuleManagerImpl::ModuleManagerImpl(const BaseObjectPtr& path)
     : authenticatedModulesOnly(false)
     , moduleAuthenticator(nullptr)
     , moduleKeys(Dict<IString, IString>())
     , modulesLoaded(false)
+    , librariesLockDepth(0)
     , work(ioContext.get_executor())
     , rescanTimer(DefaultrescanTimer)
     , safeLoadingMode(False)
+    , parallelLoading(False)
 {
     if (const StringPtr pathStr = path.asPtrOrNull<IString>(true); pathStr.assigned())
     {
@@ -116,10 +144,12 @@ ErrCode ModuleManagerImpl::getModules(IList** availableModules)
 {
     OPENDAQ_PARAM_NOT_NULL(availableModules);
 
+    loadPendingModules();
+
     auto list = List<IModule>();
-    for (auto& library : libraries)
+    for (const auto& module : getLoadedModules())
     {
-        list.pushBack(library.module);
+        list.pushBack(module);
     }
 
     *availableModules = list.detach();
@@ -135,6 +165,7 @@ ErrCode ModuleManagerImpl::addModule(IModule* module)
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALID_OPERATION, "Cannot add modules directly without verification!");
     }
 
+    std::scoped_lock lock(librariesSync);
     orphanedModules.tryUnload();
 
     const auto found = std::find_if(
@@ -161,6 +192,10 @@ ErrCode ModuleManagerImpl::loadModules(IContext* context)
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALID_OPERATION, "ModuleAuthenticator missing, cannot load modules!");
     }
 
+    std::unique_lock lock(librariesSync);
+    LibrariesLockDepthGuard depthGuard(librariesLockDepth);
+
+    std::string manifestCachePath;
     if (!modulesLoaded)
     {
         this->context = ContextPtr::Borrow(context);
@@ -180,6 +215,14 @@ ErrCode ModuleManagerImpl::loadModules(IContext* context)
             {
                 this->safeLoadingMode = static_cast<bool>(inner.get("SafeLoadingMode"));
             }
+            if (inner.hasKey("ParallelLoading"))
+            {
+                this->parallelLoading = static_cast<bool>(inner.get("ParallelLoading"));
+            }
+            if (inner.hasKey("ManifestCachePath"))
+            {
+                manifestCachePath = static_cast<std::string>(inner.get("ManifestCachePath"));
+            }
         }
 
         loggerComponent = this->logger.getOrAddComponent("ModuleManager");
@@ -198,6 +241,15 @@ ErrCode ModuleManagerImpl::loadModules(IContext* context)
                     OPENDAQ_OPENDAQ_REVISION_HASH);
     LOG_I("Loading modules ... the running SDK core version: \"{}\"", sdkVersionMetadataAsString);
 
+    // Manifests are not used with authenticated modules, as every module must be authenticated before it is loaded
+    if (!manifestCachePath.empty() && !authenticatedModulesOnly)
+    {
+        manifestCache = ModuleManifestCache(manifestCachePath, sdkVersionMetadataAsString);
+        manifestCache.load();
+    }
+
+    const auto loadStart = std::chrono::steady_clock::now();
+
     std::vector<std::string> paths;
     auto envPath = std::getenv("OPENDAQ_MODULES_PATH");
     if (envPath != nullptr)
@@ -247,29 +299,63 @@ ErrCode ModuleManagerImpl::loadModules(IContext* context)
     orphanedModules.tryUnload();
 
     bool newModulesAdded = false;
+    std::vector<LoadedModuleLibrary> modulesToLoad;
+    modulesToLoad.reserve(modulesPath.size());
     for (const auto& modulePath: modulesPath)
     {
         auto path = String(modulePath.string());
-        auto errCode = tryLoadAndAddModule(path, nullptr);
+
+        const auto pendingIt = std::find_if(pendingModules.begin(),
+                                            pendingModules.end(),
+                                            [&path](const PendingModuleLibrary& pending) { return pending.path == path; });
+        if (pendingIt != pendingModules.end())
+            continue;
+
+        LoadedModuleLibrary loadedModule;
+        loadedModule.path = path;
+        const auto errCode = prepareModuleLoad(path, nullptr, loadedModule.moduleKey);
         if (OPENDAQ_FAILED(errCode))
-        {
-            ObjectPtr<IErrorInfo> errorInfo;
-            daqGetErrorInfo(&errorInfo);
-            daqClearErrorInfo();
+            logModuleLoadError();
+        if (errCode != OPENDAQ_SUCCESS)
+            continue;
 
-            StringPtr message;
-            errorInfo->getMessage(&message);
-            if (message.assigned())
-            {
-                LOG_W("{}", message);
-            }
+        // Modules with a valid manifest are loaded once one of their component types is requested
+        if (const auto manifest = manifestCache.find(modulePath))
+        {
+            LOG_D("Deferred loading of module \"{}\" with id \"{}\" found in the manifest cache.", path, manifest->moduleId);
+            pendingModules.push_back({path, manifest->functionBlockTypeIds});
+            newModulesAdded = true;
+            continue;
         }
+
+        modulesToLoad.push_back(std::move(loadedModule));
+    }
+
+    loadModuleLibrariesUnlocked(modulesToLoad, lock);
+
+    std::size_t addedModulesCount = 0;
+    for (auto& loadedModule : modulesToLoad)
+    {
+        auto errCode = addLoadedModule(loadedModule, nullptr);
+        if (OPENDAQ_FAILED(errCode))
+            logModuleLoadError();
         if (errCode == OPENDAQ_SUCCESS)
+        {
             newModulesAdded = true;
+            ++addedModulesCount;
+        }
     }
 
+    if (!manifestCache.save())
+        LOG_W("Failed to write the module manifest cache.");
+
     modulesLoaded = true;
 
+    LOG_I("Loaded {} modules in {} ms, {} modules deferred until first use.",
+          addedModulesCount,
+          std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - loadStart).count(),
+          pendingModules.size());
+
     if (newModulesAdded)
         return OPENDAQ_SUCCESS;
     else
@@ -304,12 +390,35 @@ ErrCode ModuleManagerImpl::loadModule(IString* path, IModule** module)
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALID_OPERATION, "ModuleAuthenticator missing, cannot load modules!");
     }
 
+    std::scoped_lock lock(librariesSync);
+    LibrariesLockDepthGuard depthGuard(librariesLockDepth);
     orphanedModules.tryUnload();
 
-    return tryLoadAndAddModule(pathString, module);
+    pendingModules.erase(std::remove_if(pendingModules.begin(),
+                                        pendingModules.end(),
+                                        [&pathString](const PendingModuleLibrary& pending) { return pending.path == pathString; }),
+                         pendingModules.end());
+
+    const ErrCode errCode = tryLoadAndAddModule(pathString, module);
+    if (!manifestCache.save())
+        LOG_W("Failed to write the module manifest cache.");
+    return errCode;
 }
 
 ErrCode ModuleManagerImpl::tryLoadAndAddModule(const StringPtr& path, IModule** module)
+{
+    LoadedModuleLibrary loadedModule;
+    loadedModule.path = path;
+
+    const ErrCode errCode = prepareModuleLoad(path, module, loadedModule.moduleKey);
+    if (errCode != OPENDAQ_SUCCESS)
+        return errCode;
+
+    loadModuleLibrary(loadedModule);
+    return addLoadedModule(loadedModule, module);
+}
+
+ErrCode ModuleManagerImpl::prepareModuleLoad(const StringPtr& path, IModule** module, StringPtr& moduleKey)
 {
     std::error_code errCode;
     fs::path fileSystemPath(path.toStdString());
@@ -343,23 +452,152 @@ ErrCode ModuleManagerImpl::tryLoadAndAddModule(const StringPtr& path, IModule**
         }
     }
 
-    try
+    if (loadingModulePaths.count(path.toStdString()))
+    {
+        LOG_W(R"(Module is already being loaded from the same path: "{}".)", path);
+        return OPENDAQ_IGNORED;
+    }
+
+    if (authenticatedModulesOnly)
     {
-        StringPtr moduleKey;
-        if (authenticatedModulesOnly)
+        Bool valid = False;
+        moduleAuthenticator->authenticateModuleBinary(&valid, &moduleKey, path);
+
+        if (!valid)
         {
-            Bool valid;
-            moduleAuthenticator->authenticateModuleBinary(&valid, &moduleKey, path);
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_ACCESSDENIED, fmt::format(R"(Module ({}) authentication failed!)", path));
+        }
+    }
 
-            if (!valid)
-            {
-                return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_ACCESSDENIED, fmt::format(R"(Module ({}) authentication failed!)", path));
-            }
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename Functor>
+static ModuleComponentTypes GetModuleComponentTypes(Functor func)
+{
+    ModuleComponentTypes componentTypes;
+    try
+    {
+        componentTypes.types = DictPtr<IString, IComponentType>(func());
+    }
+    catch (const std::exception& e)
+    {
+        componentTypes.failed = true;
+        componentTypes.error = e.what();
+    }
+    catch (...)
+    {
+        componentTypes.failed = true;
+    }
+    return componentTypes;
+}
+
+void ModuleManagerImpl::loadModuleLibrary(LoadedModuleLibrary& loadedModule) const
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    try
+    {
+        loadedModule.library = loadModuleInternal(loggerComponent, fs::path(loadedModule.path.toStdString()), context, safeLoadingMode);
+
+        const ModulePtr& module = loadedModule.library.module;
+        loadedModule.deviceTypes = GetModuleComponentTypes([&module] { return module.getAvailableDeviceTypes(); });
+        loadedModule.functionBlockTypes = GetModuleComponentTypes([&module] { return module.getAvailableFunctionBlockTypes(); });
+        loadedModule.serverTypes = GetModuleComponentTypes([&module] { return module.getAvailableServerTypes(); });
+    }
+    catch (...)
+    {
+        loadedModule.error = std::current_exception();
+    }
+
+    // Errors are reported from the exception when the module is added
+    daqClearErrorInfo();
+
+    loadedModule.loadTime = std::chrono::steady_clock::now() - start;
+}
+
+void ModuleManagerImpl::loadModuleLibraries(std::vector<LoadedModuleLibrary>& loadedModules, bool parallel) const
+{
+    const std::size_t threadCount =
+        parallel ? std::min<std::size_t>(loadedModules.size(), std::max(std::thread::hardware_concurrency(), 1u)) : 1;
+
+    std::atomic<std::size_t> nextModule = 0;
+    const auto loadNextModules = [this, &loadedModules, &nextModule]
+    {
+        for (std::size_t i = nextModule++; i < loadedModules.size(); i = nextModule++)
+            loadModuleLibrary(loadedModules[i]);
+    };
+
+    // The calling thread loads modules alongside the loader threads
+    std::vector<std::future<void>> loaders;
+    for (std::size_t i = 1; i < threadCount; ++i)
+    {
+        try
+        {
+            loaders.push_back(std::async(std::launch::async,
+                                         [&loadNextModules]
+                                         {
+                                             daqNameThread("ModuleLoader");
+                                             loadNextModules();
+                                         }));
         }
+        catch (const std::exception& e)
+        {
+            LOG_W("Failed to start a module loader thread: {}", e.what());
+            break;
+        }
+    }
+
+    loadNextModules();
+
+    for (auto& loader : loaders)
+        loader.wait();
+}
+
+void ModuleManagerImpl::loadModuleLibrariesUnlocked(std::vector<LoadedModuleLibrary>& loadedModules,
+                                                    std::unique_lock<std::recursive_mutex>& lock)
+{
+    // The lock was taken further up the stack of this thread, e.g. by a module calling back into the manager
+    // while it is loaded. It cannot be released here, so the modules are loaded on this thread only, as loader
+    // threads calling back into the manager would wait for the lock forever.
+    if (librariesLockDepth > 1)
+    {
+        loadModuleLibraries(loadedModules, false);
+        return;
+    }
+
+    // Modules are loaded without the lock, so that they can call back into the manager from the loader threads
+    for (const auto& loadedModule : loadedModules)
+        loadingModulePaths.insert(loadedModule.path.toStdString());
+
+    --librariesLockDepth;
+    lock.unlock();
+
+    loadModuleLibraries(loadedModules, parallelLoading);
 
-        auto moduleLibrary = loadModuleInternal(loggerComponent, fileSystemPath, context, safeLoadingMode);
-        const auto loadedModule = moduleLibrary.module;
-        const StringPtr moduleId = loadedModule.getModuleInfo().getId();
+    lock.lock();
+    ++librariesLockDepth;
+
+    for (const auto& loadedModule : loadedModules)
+        loadingModulePaths.erase(loadedModule.path.toStdString());
+}
+
+ErrCode ModuleManagerImpl::addLoadedModule(LoadedModuleLibrary& loadedModule, IModule** module)
+{
+    const StringPtr& path = loadedModule.path;
+    const fs::path fileSystemPath(path.toStdString());
+
+    // The manifest is written again once the module is added
+    manifestCache.remove(fileSystemPath);
+
+    try
+    {
+        if (loadedModule.error)
+            std::rethrow_exception(loadedModule.error);
+
+        auto& moduleLibrary = loadedModule.library;
+        const auto loadedModulePtr = moduleLibrary.module;
+        const StringPtr moduleId = loadedModulePtr.getModuleInfo().getId();
 
         if (moduleId.assigned() && moduleId.getLength() > 0)
         {
@@ -392,32 +630,45 @@ ErrCode ModuleManagerImpl::tryLoadAndAddModule(const StringPtr& path, IModule**
             }
             if (authenticatedModulesOnly)
             {
-                moduleKeys.set(moduleId, moduleKey);
+                moduleKeys.set(moduleId, loadedModule.moduleKey);
             }
         }
 
         if (module != nullptr)
             *module = moduleLibrary.module.addRefAndReturn();
 
-        if (auto version = loadedModule.getModuleInfo().getVersionInfo(); version.assigned())
+        const auto loadTimeMs = std::chrono::duration_cast<std::chrono::milliseconds>(loadedModule.loadTime).count();
+        if (auto version = loadedModulePtr.getModuleInfo().getVersionInfo(); version.assigned())
         {
-            LOG_I("Loaded & added module [v{}.{}.{} \"{}\"] from \"{}\".",
+            LOG_I("Loaded & added module [v{}.{}.{} \"{}\"] from \"{}\" in {} ms.",
                   version.getMajor(),
                   version.getMinor(),
                   version.getPatch(),
-                  loadedModule.getModuleInfo().getName(),
-                  path);
+                  loadedModulePtr.getModuleInfo().getName(),
+                  path,
+                  loadTimeMs);
         }
         else
         {
-            LOG_W("Loaded & added module UNKNOWN VERSION of \"{}\" from \"{}\".", loadedModule.getModuleInfo().getName(), path);
+            LOG_W("Loaded & added module UNKNOWN VERSION of \"{}\" from \"{}\" in {} ms.", loadedModulePtr.getModuleInfo().getName(), path, loadTimeMs);
         }
         if (!moduleId.assigned() || moduleId.getLength() == 0)
         {
-            LOG_W("Empty or missing module id of \"{}\" from \"{}\".", loadedModule.getModuleInfo().getName(), path);
+            LOG_W("Empty or missing module id of \"{}\" from \"{}\".", loadedModulePtr.getModuleInfo().getName(), path);
         }
         printAvailableTypes(loadedModule);
 
+        if (!loadedModule.functionBlockTypes.failed && !authenticatedModulesOnly)
+        {
+            std::vector<std::string> functionBlockTypeIds;
+            if (loadedModule.functionBlockTypes.types.assigned())
+            {
+                for (const auto& [id, _] : loadedModule.functionBlockTypes.types)
+                    functionBlockTypeIds.push_back(id.toStdString());
+            }
+            manifestCache.update(fileSystemPath, moduleId.assigned() ? moduleId.toStdString() : "", std::move(functionBlockTypeIds));
+        }
+
         libraries.push_back(std::move(moduleLibrary));
     }
     catch (const daq::DaqException& e)
@@ -436,6 +687,90 @@ ErrCode ModuleManagerImpl::tryLoadAndAddModule(const StringPtr& path, IModule**
     return OPENDAQ_SUCCESS;
 }
 
+void ModuleManagerImpl::loadPendingModules(const StringPtr& functionBlockTypeId)
+{
+    std::unique_lock lock(librariesSync);
+    LibrariesLockDepthGuard depthGuard(librariesLockDepth);
+    if (pendingModules.empty())
+        return;
+
+    auto toLoadBegin = pendingModules.begin();
+    if (functionBlockTypeId.assigned())
+    {
+        const std::string typeId = functionBlockTypeId.toStdString();
+        toLoadBegin = std::stable_partition(pendingModules.begin(),
+                                            pendingModules.end(),
+                                            [&typeId](const PendingModuleLibrary& pending)
+                                            {
+                                                const auto& ids = pending.functionBlockTypeIds;
+                                                return std::find(ids.begin(), ids.end(), typeId) == ids.end();
+                                            });
+    }
+
+    std::vector<LoadedModuleLibrary> modulesToLoad;
+    for (auto it = toLoadBegin; it != pendingModules.end(); ++it)
+    {
+        LoadedModuleLibrary loadedModule;
+        loadedModule.path = it->path;
+        const ErrCode errCode = prepareModuleLoad(it->path, nullptr, loadedModule.moduleKey);
+        if (OPENDAQ_FAILED(errCode))
+            logModuleLoadError();
+        if (errCode == OPENDAQ_SUCCESS)
+            modulesToLoad.push_back(std::move(loadedModule));
+    }
+    pendingModules.erase(toLoadBegin, pendingModules.end());
+
+    if (modulesToLoad.empty())
+        return;
+
+    LOG_D("Loading {} deferred modules.", modulesToLoad.size());
+    loadModuleLibrariesUnlocked(modulesToLoad, lock);
+
+    for (auto& loadedModule : modulesToLoad)
+    {
+        if (OPENDAQ_FAILED(addLoadedModule(loadedModule, nullptr)))
+            logModuleLoadError();
+    }
+
+    if (!manifestCache.save())
+        LOG_W("Failed to write the module manifest cache.");
+}
+
+std::vector<ModulePtr> ModuleManagerImpl::getLoadedModules() const
+{
+    std::scoped_lock lock(librariesSync);
+
+    std::vector<ModulePtr> modules;
+    modules.reserve(libraries.size());
+    for (const auto& library : libraries)
+        modules.push_back(library.module);
+
+    return modules;
+}
+
+bool ModuleManagerImpl::hasPendingModules() const
+{
+    std::scoped_lock lock(librariesSync);
+    return !pendingModules.empty();
+}
+
+void ModuleManagerImpl::logModuleLoadError()
+{
+    ObjectPtr<IErrorInfo> errorInfo;
+    daqGetErrorInfo(&errorInfo);
+    daqClearErrorInfo();
+
+    if (!errorInfo.assigned())
+        return;
+
+    StringPtr message;
+    errorInfo->getMessage(&message);
+    if (message.assigned())
+    {
+        LOG_W("{}", message);
+    }
+}
+
 ErrCode ModuleManagerImpl::setAuthenticatedOnly(Bool authOnly)
 {
     authenticatedModulesOnly = authOnly;
@@ -588,6 +923,8 @@ void ModuleManagerImpl::setAddressesReachable(const std::map<std::string, Addres
 ErrCode ModuleManagerImpl::getAvailableDevices(IList** availableDevices)
 {
     OPENDAQ_PARAM_NOT_NULL(availableDevices);
+
+    loadPendingModules();
     auto availableDevicesPtr = List<IDeviceInfo>();
 
     using AsyncEnumerationResult = std::future<ListPtr<IDeviceInfo>>;
@@ -599,10 +936,8 @@ ErrCode ModuleManagerImpl::getAvailableDevices(IList** availableDevices)
         return this->discoverDevicesWithIpModification();
     });
 
-    for (const auto& library : libraries)
+    for (const auto& module : getLoadedModules())
     {
-        const auto module = library.module;
-
         try
         {
             // Parallelize the process of each module enumerating/discovering available devices,
@@ -729,12 +1064,12 @@ ErrCode ModuleManagerImpl::getAvailableDeviceTypes(IDict** deviceTypes)
 {
     OPENDAQ_PARAM_NOT_NULL(deviceTypes);
 
+    loadPendingModules();
+
     auto availableTypes = Dict<IString, IDeviceType>();
 
-    for (const auto& library : libraries)
+    for (const auto& module : getLoadedModules())
     {
-        const auto module = library.module;
-
         DictPtr<IString, IDeviceType> moduleDeviceTypes;
 
         try
@@ -767,6 +1102,8 @@ ErrCode ModuleManagerImpl::createDevice(IDevice** device, IString* connectionStr
     OPENDAQ_PARAM_NOT_NULL(device);
     *device = nullptr;
 
+    loadPendingModules();
+
     PropertyObjectPtr inputConfig = PropertyObjectPtr::Borrow(config);
     const ErrCode errCode = daqTry([&]()
     {
@@ -812,9 +1149,9 @@ ErrCode ModuleManagerImpl::createDevice(IDevice** device, IString* connectionStr
             connectionStringPtr = resolveSmartConnectionString(connectionStringPtr, discoveredDeviceInfo, generalConfig, loggerComponent);
         }
 
-        for (const auto& library : libraries)
+        for (const auto& module : getLoadedModules())
         {
-            const auto deviceType = getDeviceTypeFromConnectionString(connectionStringPtr, library.module);
+            const auto deviceType = getDeviceTypeFromConnectionString(connectionStringPtr, module);
 
             // Check if module can create device with given connection string
             if (!deviceType.assigned())
@@ -822,7 +1159,7 @@ ErrCode ModuleManagerImpl::createDevice(IDevice** device, IString* connectionStr
 
             // copy props from input config and connection string to device type config
             const auto deviceTypeConfig = PopulateDeviceTypeConfig(addDeviceConfig, inputConfig, deviceType, connectionStringOptions);
-            auto err = library.module->createDevice(device, connectionStringPtr, parent, deviceTypeConfig);
+            auto err = module->createDevice(device, connectionStringPtr, parent, deviceTypeConfig);
             OPENDAQ_RETURN_IF_FAILED(err);
 
             const auto devicePtr = DevicePtr::Borrow(*device);
@@ -833,7 +1170,7 @@ ErrCode ModuleManagerImpl::createDevice(IDevice** device, IString* connectionStr
                     componentPrivate.setComponentConfig(addDeviceConfig);
 
                 ModuleInfoPtr moduleInfo;
-                err = library.module->getModuleInfo(&moduleInfo);
+                err = module->getModuleInfo(&moduleInfo);
                 OPENDAQ_RETURN_IF_FAILED(err);
 
                 if (auto info = devicePtr.getInfo(); info.assigned())
@@ -869,6 +1206,9 @@ ErrCode ModuleManagerImpl::createDevices(IDict** devices, IDict* connectionArgs,
     if (connectionArgsDictPtr.getCount() == 0)
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "None connection arguments provided");
 
+    // Deferred modules are loaded before the devices are created in parallel
+    loadPendingModules();
+
     auto saveErrCode = [&errCodesDictPtr, &errorResultSync](const StringPtr& connectionString, ErrCode errCode)
     {
         if (errCodesDictPtr.assigned())
@@ -951,12 +1291,12 @@ ErrCode ModuleManagerImpl::getAvailableFunctionBlockTypes(IDict** functionBlockT
 {
     OPENDAQ_PARAM_NOT_NULL(functionBlockTypes);
 
+    loadPendingModules();
+
     auto availableTypes = Dict<IString, IFunctionBlockType>();
 
-    for (const auto& library : libraries)
+    for (const auto& module : getLoadedModules())
     {
-        const auto module = library.module;
-
         DictPtr<IString, IFunctionBlockType> types;
         try
         {
@@ -1064,10 +1404,11 @@ ErrCode ModuleManagerImpl::createFunctionBlock(IFunctionBlock** functionBlock, I
 
     const StringPtr typeId = ConvertIfOldIdFB(StringPtr::Borrow(id));
 
-    for (const auto& library : libraries)
-    {
-        const auto module = library.module;
+    // Only the deferred modules that provide the type according to their manifest are loaded
+    loadPendingModules(typeId);
 
+    for (const auto& module : getLoadedModules())
+    {
         DictPtr<IString, IFunctionBlockType> types;
         try
         {
@@ -1136,7 +1477,7 @@ ErrCode ModuleManagerImpl::createFunctionBlock(IFunctionBlock** functionBlock, I
         if (fbPtr.assigned())
         {
             ModuleInfoPtr moduleInfo;
-            err = library.module->getModuleInfo(&moduleInfo);
+            err = module->getModuleInfo(&moduleInfo);
             OPENDAQ_RETURN_IF_FAILED(err);
 
             auto fbType = fbPtr.getFunctionBlockType();
@@ -1147,6 +1488,12 @@ ErrCode ModuleManagerImpl::createFunctionBlock(IFunctionBlock** functionBlock, I
         return OPENDAQ_SUCCESS;
     }
 
+    if (hasPendingModules())
+    {
+        loadPendingModules();
+        return createFunctionBlock(functionBlock, id, parent, config, localId);
+    }
+
     return DAQ_MAKE_ERROR_INFO(
         OPENDAQ_ERR_NOTFOUND,
         fmt::format(R"(Function block with given uid and config is not available [{}])", typeId)
@@ -1158,6 +1505,8 @@ ErrCode ModuleManagerImpl::createStreaming(IStreaming** streaming, IString* conn
     OPENDAQ_PARAM_NOT_NULL(connectionString);
     OPENDAQ_PARAM_NOT_NULL(streaming);
 
+    loadPendingModules();
+
     StreamingPtr streamingPtr;
     const ErrCode errCode = wrapHandlerReturn(this, &ModuleManagerImpl::onCreateStreaming, streamingPtr, connectionString, config);
     OPENDAQ_RETURN_IF_FAILED(errCode);
@@ -1170,12 +1519,12 @@ ErrCode ModuleManagerImpl::getAvailableStreamingTypes(IDict** streamingTypes)
 {
     OPENDAQ_PARAM_NOT_NULL(streamingTypes);
 
+    loadPendingModules();
+
     auto availableTypes = Dict<IString, IStreamingType>();
 
-    for (const auto& library : libraries)
+    for (const auto& module : getLoadedModules())
     {
-        const auto module = library.module;
-
         DictPtr<IString, IStreamingType> types;
         try
         {
@@ -1239,11 +1588,12 @@ ErrCode ModuleManagerImpl::createServer(IServer** server, IString* serverTypeId,
     OPENDAQ_PARAM_NOT_NULL(server);
     OPENDAQ_PARAM_NOT_NULL(rootDevice);
 
+    loadPendingModules();
+
     auto typeId = ConvertIfOldIdProtocol(StringPtr::Borrow(serverTypeId));
 
-    for (const auto& library : libraries)
+    for (const auto& module : getLoadedModules())
     {
-        const auto module = library.module;
         DictPtr<IString, IServerType> serverTypes;
         try
         {
@@ -1292,6 +1642,8 @@ ErrCode ModuleManagerImpl::completeDeviceCapabilities(IDevice* device)
 {
     OPENDAQ_PARAM_NOT_NULL(device);
 
+    loadPendingModules();
+
     DevicePtr devicePtr = DevicePtr::Borrow(device);
 
     const ErrCode errCode = wrapHandler(this, &ModuleManagerImpl::onCompleteCapabilities, device, nullptr);
@@ -1519,10 +1871,8 @@ StreamingPtr ModuleManagerImpl::onCreateStreaming(const StringPtr& connectionStr
     if (config.assigned())
         checkErrorInfo(config.asPtr<IPropertyObjectInternal>()->clone(&inputConfig));
 
-    for (const auto& library : libraries)
+    for (const auto& module : getLoadedModules())
     {
-        const auto module = library.module;
-
         const std::string prefix = getPrefixFromConnectionString(connectionString);
         DictPtr<IString, IStreamingType> types;
         const ErrCode errCode = module->getAvailableStreamingTypes(&types);
@@ -1583,11 +1933,11 @@ void ModuleManagerImpl::completeServerCapabilities(const DevicePtr& device) cons
     const auto source = configConnectionInfo;
     const auto targetCaps = connectedDeviceInfo.getServerCapabilities();
 
+    const auto modules = getLoadedModules();
     for (const auto& target : targetCaps)
     {
-        for (const auto& library : libraries)
+        for (const auto& module : modules)
         {
-            const auto module = library.module;
             try
             {
                 if (module.completeServerCapability(source, target))
@@ -2008,23 +2358,30 @@ void GetModulesPath(std::vector<fs::path>& modulesPath, const LoggerComponentPtr
 }
 
 
-template <typename Functor>
-void ModuleManagerImpl::printComponentTypes(Functor func, const std::string& kind)
+void ModuleManagerImpl::printComponentTypes(const ModuleComponentTypes& componentTypes, const std::string& kind)
 {
+    if (componentTypes.failed)
+    {
+        if (componentTypes.error.empty())
+            LOG_E("Failed to enumerate module's supported {} types because of unknown exception", kind);
+        else
+            LOG_E("Failed to enumerate module's supported {} types: {}", kind, componentTypes.error);
+        return;
+    }
+
+    if (!componentTypes.types.assigned())
+        return;
+
     try
     {
-        DictPtr<IString, IComponentType> componentTypes = func();
-        if (componentTypes.getCount() > 0)
+        for (const auto& [id, type] : componentTypes.types)
         {
-            for (const auto& [id, type] : componentTypes)
-            {
-                LOG_I("\t{0:<3} [{1}] {2}: \"{3}\"",
-                      kind,
-                      id,
-                      type.getName(),
-                      type.getDescription()
-                );
-            }
+            LOG_I("\t{0:<3} [{1}] {2}: \"{3}\"",
+                  kind,
+                  id,
+                  type.getName(),
+                  type.getDescription()
+            );
         }
     }
     catch (const std::exception& e)
@@ -2037,11 +2394,11 @@ void ModuleManagerImpl::printComponentTypes(Functor func, const std::string& kin
     }
 }
 
-void ModuleManagerImpl::printAvailableTypes(const ModulePtr& module)
+void ModuleManagerImpl::printAvailableTypes(const LoadedModuleLibrary& loadedModule)
 {
-    printComponentTypes([&module]{ return module.getAvailableDeviceTypes(); }, "DEV");
-    printComponentTypes([&module]{ return module.getAvailableFunctionBlockTypes(); }, "FB");
-    printComponentTypes([&module]{ return module.getAvailableServerTypes(); }, "SRV");
+    printComponentTypes(loadedModule.deviceTypes, "DEV");
+    printComponentTypes(loadedModule.functionBlockTypes, "FB");
+    printComponentTypes(loadedModule.serverTypes, "SRV");
 }
 
 static std::string GetMessageFromLibraryErrCode(std::error_code libraryErrCode)
@@ -0,0 +1,174 @@
+#include <opendaq/module_manifest_cache.h>
+#include <fstream>
+#include <sstream>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+static constexpr char manifestCacheHeader[] = "openDAQ module manifest cache 1";
+
+ModuleManifestCache::ModuleManifestCache(std::string cachePath, std::string sdkVersion)
+    : cachePath(std::move(cachePath))
+    , sdkVersion(std::move(sdkVersion))
+{
+}
+
+bool ModuleManifestCache::isEnabled() const
+{
+    return !cachePath.empty();
+}
+
+void ModuleManifestCache::load()
+{
+    manifests.clear();
+    modified = false;
+
+    if (!isEnabled())
+        return;
+
+    std::ifstream file(cachePath);
+    if (!file)
+        return;
+
+    std::string line;
+    if (!std::getline(file, line) || line != manifestCacheHeader)
+        return;
+
+    // manifests written by another SDK version are not reused
+    if (!std::getline(file, line) || line != "sdk " + sdkVersion)
+        return;
+
+    std::unordered_map<std::string, ModuleManifest> loaded;
+    ModuleManifest manifest;
+    bool inModule = false;
+
+    while (std::getline(file, line))
+    {
+        const auto separator = line.find(' ');
+        const std::string key = line.substr(0, separator);
+        const std::string value = separator != std::string::npos ? line.substr(separator + 1) : std::string();
+
+        if (key == "module")
+        {
+            manifest = ModuleManifest{};
+            manifest.path = value;
+            inModule = true;
+        }
+        else if (!inModule)
+        {
+            return;
+        }
+        else if (key == "stamp")
+        {
+            std::istringstream stamp(value);
+            if (!(stamp >> manifest.fileSize >> manifest.lastWriteTime))
+                return;
+        }
+        else if (key == "id")
+        {
+            manifest.moduleId = value;
+        }
+        else if (key == "fb")
+        {
+            manifest.functionBlockTypeIds.push_back(value);
+        }
+        else if (key == "end")
+        {
+            std::string modulePath = manifest.path;
+            loaded[modulePath] = std::move(manifest);
+            inModule = false;
+        }
+        else
+        {
+            return;
+        }
+    }
+
+    manifests = std::move(loaded);
+}
+
+bool ModuleManifestCache::save()
+{
+    if (!isEnabled() || !modified)
+        return true;
+
+    std::ofstream file(cachePath, std::ios::trunc);
+    if (!file)
+        return false;
+
+    file << manifestCacheHeader << '\n';
+    file << "sdk " << sdkVersion << '\n';
+    for (const auto& [_, manifest] : manifests)
+    {
+        file << "module " << manifest.path << '\n';
+        file << "stamp " << manifest.fileSize << ' ' << manifest.lastWriteTime << '\n';
+        file << "id " << manifest.moduleId << '\n';
+        for (const auto& id : manifest.functionBlockTypeIds)
+            file << "fb " << id << '\n';
+        file << "end\n";
+    }
+
+    file.flush();
+    if (!file)
+        return false;
+
+    modified = false;
+    return true;
+}
+
+const ModuleManifest* ModuleManifestCache::find(const fs::path& modulePath) const
+{
+    const auto it = manifests.find(modulePath.string());
+    if (it == manifests.end())
+        return nullptr;
+
+    std::uintmax_t fileSize;
+    std::int64_t lastWriteTime;
+    if (!GetFileStamp(modulePath, fileSize, lastWriteTime))
+        return nullptr;
+
+    if (it->second.fileSize != fileSize || it->second.lastWriteTime != lastWriteTime)
+        return nullptr;
+
+    return &it->second;
+}
+
+void ModuleManifestCache::update(const fs::path& modulePath, std::string moduleId, std::vector<std::string> functionBlockTypeIds)
+{
+    if (!isEnabled())
+        return;
+
+    ModuleManifest manifest;
+    manifest.path = modulePath.string();
+    if (!GetFileStamp(modulePath, manifest.fileSize, manifest.lastWriteTime))
+        return;
+
+    manifest.moduleId = std::move(moduleId);
+    manifest.functionBlockTypeIds = std::move(functionBlockTypeIds);
+
+    const std::string key = manifest.path;
+    manifests[key] = std::move(manifest);
+    modified = true;
+}
+
+void ModuleManifestCache::remove(const fs::path& modulePath)
+{
+    if (manifests.erase(modulePath.string()) > 0)
+        modified = true;
+}
+
+bool ModuleManifestCache::GetFileStamp(const fs::path& modulePath, std::uintmax_t& fileSize, std::int64_t& lastWriteTime)
+{
+    std::error_code errCode;
+    fileSize = fs::file_size(modulePath, errCode);
+    if (errCode)
+        return false;
+
+    const auto writeTime = fs::last_write_time(modulePath, errCode);
+    if (errCode)
+        return false;
+
+    lastWriteTime = static_cast<std::int64_t>(writeTime.time_since_epoch().count());
+    return true;
+}
+
+END_NAMESPACE_OPENDAQ
@@ -5,10 +5,14 @@
 #include <opendaq/context_factory.h>
 #include <opendaq/custom_log.h>
 #include <opendaq/context_internal_ptr.h>
+#include <opendaq/module_manager_utils_ptr.h>
 
 #include <chrono>
+#include <fstream>
+#include <iterator>
 #include <thread>
 #include <opendaq/boost_dll.h>
+#include <opendaq/module_manifest_cache.h>
 
 #include "mock/mock_module.h"
 #include "mock/mock_module_authenticator.h"
@@ -295,3 +299,93 @@ TEST_F(ModuleManagerInternalsTest, TestAuthenticator)
     ASSERT_EQ(manager.getModules().getCount(), 1u);
     ASSERT_EQ(manager.getModules()[0], module);
 }
+
+TEST_F(ModuleManagerInternalsTest, ManifestCacheRoundTrip)
+{
+    const fs::path modulePath = GetMockModulePath(DEPENDENCIES_SUCCEEDED_MODULE_NAME);
+    const fs::path cachePath = fs::temp_directory_path() / "opendaq_manifest_cache_round_trip.txt";
+    fs::remove(cachePath);
+
+    ModuleManifestCache cache(cachePath.string(), "sdk");
+    cache.update(modulePath, "mock_dep", {"MockFb1", "MockFb2"});
+    ASSERT_TRUE(cache.save());
+
+    ModuleManifestCache loadedCache(cachePath.string(), "sdk");
+    loadedCache.load();
+    const auto manifest = loadedCache.find(modulePath);
+    ASSERT_NE(manifest, nullptr);
+    ASSERT_EQ(manifest->moduleId, "mock_dep");
+    ASSERT_EQ(manifest->functionBlockTypeIds, (std::vector<std::string>{"MockFb1", "MockFb2"}));
+
+    ModuleManifestCache otherSdkCache(cachePath.string(), "other sdk");
+    otherSdkCache.load();
+    ASSERT_EQ(otherSdkCache.find(modulePath), nullptr);
+
+    fs::remove(cachePath);
+}
+
+TEST_F(ModuleManagerInternalsTest, LoadModulesSequentially)
+{
+    fs::path modulesPath = exePath / fs::path(MODULE_TEST_DIR);
+    const auto options = Dict<IString, IBaseObject>({{"ModuleManager", Dict<IString, IBaseObject>({{"ParallelLoading", True}})}});
+
+    auto parallelManager = ModuleManager(modulesPath.string());
+    parallelManager.loadModules(NullContext(Logger(), TypeManager(), options));
+
+    auto sequentialManager = ModuleManager(modulesPath.string());
+    sequentialManager.loadModules(NullContext());
+
+    ASSERT_GT(sequentialManager.getModules().getCount(), 0u);
+    ASSERT_EQ(sequentialManager.getModules().getCount(), parallelManager.getModules().getCount());
+}
+
+TEST_F(ModuleManagerInternalsTest, LoadModulesDeferredByManifestCache)
+{
+    const fs::path modulesPath = fs::temp_directory_path() / "opendaq_manifest_cache_deferred_modules";
+    const fs::path cachePath = fs::temp_directory_path() / "opendaq_manifest_cache_deferred.txt";
+    fs::remove_all(modulesPath);
+    fs::remove(cachePath);
+    fs::create_directories(modulesPath);
+    fs::copy_file(GetMockModulePath(DEPENDENCIES_SUCCEEDED_MODULE_NAME), modulesPath / DEPENDENCIES_SUCCEEDED_MODULE_NAME);
+
+    const auto options =
+        Dict<IString, IBaseObject>({{"ModuleManager", Dict<IString, IBaseObject>({{"ManifestCachePath", cachePath.string()}})}});
+
+    {
+        auto manager = ModuleManager(modulesPath.string());
+        manager.loadModules(NullContext(Logger(), TypeManager(), options));
+        ASSERT_EQ(manager.getModules().getCount(), 1u);
+    }
+    ASSERT_TRUE(fs::exists(cachePath));
+
+    const auto readCache = [&cachePath]
+    {
+        std::ifstream file(cachePath);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    };
+
+    // The manifest of a loaded module is rewritten with its actual function block types,
+    // so a type that only the manifest lists shows whether the module was loaded
+    std::string cache = readCache();
+    const auto endPos = cache.rfind("end\n");
+    ASSERT_NE(endPos, std::string::npos);
+    cache.insert(endPos, "fb MockDeferredFb\n");
+    std::ofstream(cachePath, std::ios::trunc) << cache;
+
+    {
+        auto cachedManager = ModuleManager(modulesPath.string());
+        ASSERT_EQ(cachedManager->loadModules(NullContext(Logger(), TypeManager(), options)), OPENDAQ_SUCCESS);
+        ASSERT_NE(readCache().find("fb MockDeferredFb"), std::string::npos);
+
+        // Asking for the type loads the module, which does not provide it
+        auto utils = cachedManager.asPtr<IModuleManagerUtils>();
+        ASSERT_THROW(utils.createFunctionBlock("MockDeferredFb", nullptr), NotFoundException);
+        ASSERT_EQ(readCache().find("fb MockDeferredFb"), std::string::npos);
+        ASSERT_EQ(cachedManager.getModules().getCount(), 1u);
+    }
+
+    // The copied module can still be mapped until its orphaned library is unloaded, so errors are ignored
+    std::error_code errCode;
+    fs::remove_all(modulesPath, errCode);
+    fs::remove(cachePath, errCode);
+}
@@ -81,6 +81,7 @@
 #include <opendaq/time_reader.h>
 
 #include <opendaq/deleter_factory.h>
+#include <opendaq/pool_allocator_factory.h>
 #include <opendaq/binary_data_packet_factory.h>
 
 #include <opendaq/component_factory.h>
@@ -52,8 +52,11 @@ struct MockInputPort : daq::MockGenericComponent<MockInputPort, daq::IInputPortC
     MOCK_METHOD(daq::ErrCode, setCustomData, (daq::IBaseObject* customData), (override MOCK_CALL));
 
     MOCK_METHOD(daq::ErrCode, getGapCheckingEnabled, (daq::Bool* gapCheckingEnabled), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, setPacketQueueMode, (daq::PacketQueueMode mode), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, getPacketQueueMode, (daq::PacketQueueMode* mode), (override MOCK_CALL));
 
     daq::Bool active = true;
+    daq::PacketQueueMode packetQueueMode = daq::PacketQueueMode::Locked;
 
     MockInputPort()
     {
@@ -64,5 +67,9 @@ struct MockInputPort : daq::MockGenericComponent<MockInputPort, daq::IInputPortC
         EXPECT_CALL(*this, getActive)
             .Times(AnyNumber())
             .WillRepeatedly(DoAll(Invoke([&](daq::Bool* active) { *active = this->active; }), Return(OPENDAQ_SUCCESS)));
+
+        EXPECT_CALL(*this, getPacketQueueMode)
+            .Times(AnyNumber())
+            .WillRepeatedly(DoAll(Invoke([&](daq::PacketQueueMode* mode) { *mode = this->packetQueueMode; }), Return(OPENDAQ_SUCCESS)));
     }
 };
@@ -28,6 +28,7 @@ DECLARE_OPENDAQ_INTERFACE(IMockStreaming, daq::IBaseObject)
     virtual void makeSignalUnavailable(const daq::StringPtr& signalStreamingId) = 0;
     virtual void triggerReconnectionStart() = 0;
     virtual void triggerReconnectionCompletion() = 0;
+    virtual void triggerPacket(const daq::StringPtr& signalStreamingId, const daq::PacketPtr& packet) = 0;
 };
 
 struct MockStreaming : daq::StreamingImpl<IMockStreaming>
@@ -69,6 +70,10 @@ struct MockStreaming : daq::StreamingImpl<IMockStreaming>
     {
         updateConnectionStatus(Enumeration("ConnectionStatusType", "Connected", this->context.getTypeManager()), "");
     }
+    void triggerPacket(const daq::StringPtr& signalStreamingId, const daq::PacketPtr& packet) override
+    {
+        onPacket(signalStreamingId, packet);
+    }
 
     daq::MirroredSignalConfigPtr signal;
 
@@ -17,6 +17,8 @@ DictPtr<IString, IBaseObject> InstanceBuilderImpl::GetDefaultOptions()
             {"ModulesPaths", List<IString>("")},
             {"AddDeviceRescanTimer", 5000},
             {"SafeLoadingMode", False},
+            {"ParallelLoading", False},
+            {"ManifestCachePath", ""},
         })},
         {"Scheduler", Dict<IString, IBaseObject>(
         {
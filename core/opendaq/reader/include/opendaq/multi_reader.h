@@ -193,6 +193,38 @@ DECLARE_OPENDAQ_INTERFACE(IMultiReader, ISampleReader)
      * @param unused Output parameter
      */
     virtual ErrCode INTERFACE_FUNC getInputUsed(IString* id, Bool* isUsed) = 0;
+
+    // [arrayArg(samples, count), arrayArg(count, 1)]
+    /*!
+     * @brief Copies at maximum the next `count` samples of all signals into a single buffer, one block per signal.
+     * @param[in] samples The buffer that the samples will be copied to. It must hold `count` samples for each
+     * signal, the samples of the signal at index `i` start at element `i * count`.
+     * E.g: reading the next 3 samples of 2 signals
+     * samples = [s0[0], s0[1], s0[2], s1[0], s1[1], s1[2]]
+     * @param[in,out] count The maximum amount of samples to be read per signal. If the `count` is less than
+     * available the parameter value is set to the actual amount and only the available
+     * samples are returned. The rest of the buffer is not modified or cleared.
+     * @param timeoutMs The maximum amount of time in milliseconds to wait for the requested amount of samples before returning.
+     * @param[out] status Represents the status of the reader, as returned by `read`.
+     * @retval OPENDAQ_ERR_INVALIDSTATE if the value read type has no fixed sample size.
+     */
+    virtual ErrCode INTERFACE_FUNC readPlanar(void* samples, SizeT* count, SizeT timeoutMs = 0, IMultiReaderStatus** status = nullptr) = 0;
+
+    // [arrayArg(samples, count), arrayArg(count, 1)]
+    /*!
+     * @brief Copies at maximum the next `count` samples of all signals into a single buffer, interleaved by signal.
+     * @param[in] samples The buffer that the samples will be copied to. It must hold `count` samples for each
+     * signal, sample `j` of the signal at index `i` is written to element `j * signalCount + i`.
+     * E.g: reading the next 3 samples of 2 signals
+     * samples = [s0[0], s1[0], s0[1], s1[1], s0[2], s1[2]]
+     * @param[in,out] count The maximum amount of samples to be read per signal. If the `count` is less than
+     * available the parameter value is set to the actual amount and only the available
+     * samples are returned. The rest of the buffer is not modified or cleared.
+     * @param timeoutMs The maximum amount of time in milliseconds to wait for the requested amount of samples before returning.
+     * @param[out] status Represents the status of the reader, as returned by `read`.
+     * @retval OPENDAQ_ERR_INVALIDSTATE if the value read type has no fixed sample size or the signals have different sample rates.
+     */
+    virtual ErrCode INTERFACE_FUNC readInterleaved(void* samples, SizeT* count, SizeT timeoutMs = 0, IMultiReaderStatus** status = nullptr) = 0;
 };
 
 /*!@}*/
@@ -22,6 +22,7 @@
 #include <opendaq/reader_factory.h>
 
 #include <list>
+#include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -73,6 +74,8 @@ public:
     ErrCode INTERFACE_FUNC removeInput(IString* id) override;
     ErrCode INTERFACE_FUNC setInputUsed(IString* id, Bool isUsed) override;
     ErrCode INTERFACE_FUNC getInputUsed(IString* id, Bool* isUsed) override;
+    ErrCode INTERFACE_FUNC readPlanar(void* samples, SizeT* count, SizeT timeoutMs, IMultiReaderStatus** status) override;
+    ErrCode INTERFACE_FUNC readInterleaved(void* samples, SizeT* count, SizeT timeoutMs, IMultiReaderStatus** status) override;
 
     // IInputPortNotifications
     ErrCode INTERFACE_FUNC acceptsSignal(IInputPort* port, ISignal* signal, Bool* accept) override;
@@ -120,6 +123,8 @@ private:
     bool eventOrGapInQueue() const;
     bool dataPacketsOrEventReady();
     SizeT getMinSamplesAvailable(bool acrossDescriptorChanges = false) const;
+    // Returns true if all signals are used, synchronized and hold a data packet; `min` is set to the samples readable without events
+    bool getSynchronizedSamplesAvailable(SizeT required, SizeT& min) const;
 
     ErrCode synchronize(SizeT& min, SyncStatus& syncStatus);
     /**
@@ -140,6 +145,7 @@ private:
     // Check for event packets; Synchronize; Skip if event/packet in queue and available samples < minReadCount
     MultiReaderStatusPtr readAndSynchronize(bool zeroDataRead, SizeT& availableSamples, SyncStatus& syncStatus);
     MultiReaderStatusPtr readPackets();
+    ErrCode readInternal(void** samples, SizeT* count, SizeT timeoutMs, IMultiReaderStatus** status);
     DictPtr<IString, IEventPacket> readUntilFirstDataPacketAndGetEvents();
     void updateCommonSampleRateAndDividers();
 
@@ -181,6 +187,10 @@ private:
     void** values{};
     void** domainValues{};
 
+    // Per-signal buffers used when reading into a single planar or interleaved buffer
+    std::vector<void*> bufferPointers;
+    std::vector<uint8_t> interleaveBuffer;
+
     Clock::duration timeout{};
     Clock::time_point startTime;
 
@@ -99,7 +99,7 @@ class ComparableValue : public Comparable
 public:
     explicit ComparableValue(ReadType startingValue, const ReaderDomainInfo& domainInfo, bool log = true)
         : Comparable(domainInfo)
-        , value(static_cast<ReadType>(startingValue * domainInfo.multiplier.getNumerator() / static_cast<double>(domainInfo.multiplier.getDenominator())))
+        , value(static_cast<ReadType>(startingValue * domainInfo.multiplierNumerator / static_cast<double>(domainInfo.multiplierDenominator)))
     {
 
 #if !defined(NDEBUG)
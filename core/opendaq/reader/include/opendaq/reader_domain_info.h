@@ -35,7 +35,10 @@ private:
                 resolution.getDenominator() * maxResolution.getNumerator())
             .simplify();
 
-        LOG_T("Multiplier: {} / {}", multiplier.getNumerator(), multiplier.getDenominator())
+        multiplierNumerator = multiplier.getNumerator();
+        multiplierDenominator = multiplier.getDenominator();
+
+        LOG_T("Multiplier: {} / {}", multiplierNumerator, multiplierDenominator)
     }
 
     void setEpochOffset(std::chrono::system_clock::time_point minEpoch, const RatioPtr& maxResolution)
@@ -73,6 +76,9 @@ public:
 
     RatioPtr resolution{};
     RatioPtr multiplier{};
+    // Resolved from the multiplier when it changes, to avoid interface calls on per-sample paths
+    std::int64_t multiplierNumerator{1};
+    std::int64_t multiplierDenominator{1};
     std::int64_t offset{};
     std::chrono::system_clock::time_point epoch{};
 
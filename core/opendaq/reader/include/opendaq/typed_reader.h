@@ -32,6 +32,7 @@ public:
     virtual ~Reader() = default;
 
     virtual ErrCode readData(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count) = 0;
+    virtual ErrCode readPacketValues(const DataPacketPtr& packet, SizeT offset, void** outputBuffer, SizeT count) = 0;
     virtual std::unique_ptr<Comparable> readStart(void* inputBuffer, SizeT offset, const ReaderDomainInfo& domainInfo) = 0;
     virtual std::unique_ptr<Comparable> readStartLinear(const DataPacketPtr& packet, SizeT offset, const ReaderDomainInfo& domainInfo) = 0;
 
@@ -71,6 +72,11 @@ public:
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE);
     }
 
+    ErrCode readPacketValues(const DataPacketPtr& packet, SizeT offset, void** outputBuffer, SizeT count) override
+    {
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE);
+    }
+
     virtual std::unique_ptr<Comparable> readStart(void* inputBuffer, SizeT offset, const ReaderDomainInfo& domainInfo) override
     {
         DAQ_THROW_EXCEPTION(InvalidStateException);
@@ -122,6 +128,12 @@ public:
     using Reader::Reader;
 
     virtual ErrCode readData(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count) override;
+
+    /*!
+     * @brief Reads the values of a packet starting at sample `offset`. Values of packets with an integer linear data rule
+     * are computed from the rule parameters and the packet offset, without evaluating the rule for the whole packet.
+     */
+    virtual ErrCode readPacketValues(const DataPacketPtr& packet, SizeT offset, void** outputBuffer, SizeT count) override;
     virtual std::unique_ptr<Comparable> readStart(void* inputBuffer, SizeT offset, const ReaderDomainInfo& domainInfo) override;
 
     virtual std::unique_ptr<Comparable> readStartLinear(const DataPacketPtr& packet,
@@ -174,6 +186,11 @@ private:
     SizeT valuesPerSample{1};
 
     SizeT rawSampleSize{0};
+
+    // Parameters of the linear data rule of the current descriptor, including the reference domain offset
+    bool linearRule{false};
+    Int linearDelta{0};
+    Int linearStart{0};
 };
 
 std::unique_ptr<Reader> createReaderForType(SampleType readType, const FunctionPtr& transformFunction);
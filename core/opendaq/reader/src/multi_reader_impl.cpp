@@ -3,6 +3,7 @@
 #include <coretypes/validation.h>
 #include <opendaq/custom_log.h>
 #include <opendaq/data_descriptor_factory.h>
+#include <opendaq/data_packet_private.h>
 #include <opendaq/event_packet_utils.h>
 #include <opendaq/input_port_factory.h>
 #include <opendaq/input_port_private_ptr.h>
@@ -15,6 +16,7 @@
 
 #include <fmt/ostream.h>
 #include <chrono>
+#include <cstring>
 #include <optional>
 #include <set>
 
@@ -32,6 +34,16 @@ BEGIN_NAMESPACE_OPENDAQ
 
 namespace
 {
+template <typename T>
+void interleaveSamples(const uint8_t* planar, void* out, SizeT signalCount, SizeT stride, SizeT count)
+{
+    const auto src = reinterpret_cast<const T*>(planar);
+    auto dst = static_cast<T*>(out);
+    for (SizeT j = 0; j < count; ++j)
+        for (SizeT i = 0; i < signalCount; ++i)
+            *dst++ = src[i * stride + j];
+}
+
 struct ReferenceDomainBin
 {
     StringPtr id;
@@ -824,14 +836,92 @@ ErrCode MultiReaderImpl::read(void* samples, SizeT* count, SizeT timeoutMs, IMul
 {
     OPENDAQ_PARAM_NOT_NULL(count);
     if (*count != 0)
-    {
         OPENDAQ_PARAM_NOT_NULL(samples);
 
-        if (minReadCount > *count)
-            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Count parameter has to be either 0 or larger than minReadCount.");
-    }
+    std::scoped_lock lock(mutex);
+    return readInternal(static_cast<void**>(samples), count, timeoutMs, status);
+}
+
+ErrCode MultiReaderImpl::readPlanar(void* samples, SizeT* count, SizeT timeoutMs, IMultiReaderStatus** status)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+    if (*count != 0)
+        OPENDAQ_PARAM_NOT_NULL(samples);
 
     std::scoped_lock lock(mutex);
+    if (*count == 0)
+        return readInternal(nullptr, count, timeoutMs, status);
+
+    const SizeT sampleSize = getSampleSize(valueReadType);
+    if (sampleSize == 0 || readMode == ReadMode::RawValue)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Reading into a single buffer requires a value read type with a fixed sample size.");
+
+    // The block of each signal is `count` samples long
+    bufferPointers.resize(signals.size());
+    for (SizeT i = 0; i < bufferPointers.size(); ++i)
+        bufferPointers[i] = static_cast<uint8_t*>(samples) + i * *count * sampleSize;
+
+    return readInternal(bufferPointers.data(), count, timeoutMs, status);
+}
+
+ErrCode MultiReaderImpl::readInterleaved(void* samples, SizeT* count, SizeT timeoutMs, IMultiReaderStatus** status)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+    if (*count != 0)
+        OPENDAQ_PARAM_NOT_NULL(samples);
+
+    std::scoped_lock lock(mutex);
+    if (*count == 0)
+        return readInternal(nullptr, count, timeoutMs, status);
+
+    const SizeT sampleSize = getSampleSize(valueReadType);
+    if (sampleSize == 0 || readMode == ReadMode::RawValue)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Reading into a single buffer requires a value read type with a fixed sample size.");
+    if (sampleRateDividerLcm != 1)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Interleaved reading requires all signals to have the same sample rate.");
+
+    // Samples are read per signal into a reused buffer and interleaved afterwards
+    const SizeT signalCount = signals.size();
+    const SizeT capacity = *count;
+    interleaveBuffer.resize(signalCount * capacity * sampleSize);
+    bufferPointers.resize(signalCount);
+    for (SizeT i = 0; i < signalCount; ++i)
+        bufferPointers[i] = interleaveBuffer.data() + i * capacity * sampleSize;
+
+    const ErrCode errCode = readInternal(bufferPointers.data(), count, timeoutMs, status);
+    OPENDAQ_RETURN_IF_FAILED(errCode);
+
+    switch (sampleSize)
+    {
+        case 1:
+            interleaveSamples<uint8_t>(interleaveBuffer.data(), samples, signalCount, capacity, *count);
+            break;
+        case 2:
+            interleaveSamples<uint16_t>(interleaveBuffer.data(), samples, signalCount, capacity, *count);
+            break;
+        case 4:
+            interleaveSamples<uint32_t>(interleaveBuffer.data(), samples, signalCount, capacity, *count);
+            break;
+        case 8:
+            interleaveSamples<uint64_t>(interleaveBuffer.data(), samples, signalCount, capacity, *count);
+            break;
+        default:
+        {
+            auto out = static_cast<uint8_t*>(samples);
+            for (SizeT j = 0; j < *count; ++j)
+                for (SizeT i = 0; i < signalCount; ++i, out += sampleSize)
+                    std::memcpy(out, interleaveBuffer.data() + (i * capacity + j) * sampleSize, sampleSize);
+            break;
+        }
+    }
+
+    return errCode;
+}
+
+ErrCode MultiReaderImpl::readInternal(void** samples, SizeT* count, SizeT timeoutMs, IMultiReaderStatus** status)
+{
+    if (*count != 0 && minReadCount > *count)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Count parameter has to be either 0 or larger than minReadCount.");
 
     MultiReaderStatusPtr earlyReturnStatus;
     if (nextPacketIsEvent)
@@ -853,7 +943,7 @@ ErrCode MultiReaderImpl::read(void* samples, SizeT* count, SizeT timeoutMs, IMul
     }
 
     SizeT samplesToRead = (*count / sampleRateDividerLcm) * sampleRateDividerLcm;
-    prepare(static_cast<void**>(samples), samplesToRead, milliseconds(timeoutMs));
+    prepare(samples, samplesToRead, milliseconds(timeoutMs));
 
     auto statusPtr = readPackets();
     if (status)
@@ -967,6 +1057,26 @@ SizeT MultiReaderImpl::getMinSamplesAvailable(bool acrossDescriptorChanges) cons
     return min;
 }
 
+bool MultiReaderImpl::getSynchronizedSamplesAvailable(SizeT required, SizeT& min) const
+{
+    min = std::numeric_limits<SizeT>::max();
+    for (const auto& signal : signals)
+    {
+        // Unused signals are drained of events by the regular path
+        if (signal.unused || !signal.isSynced() || !signal.info.dataPacket.assigned())
+            return false;
+
+        // The connection is only queried if the current packet does not hold enough samples
+        SizeT available = (signal.info.dataPacket.getSampleCount() - signal.info.prevSampleIndex) * signal.sampleRateDivider;
+        if (available < required)
+            available = signal.getAvailable(false);
+
+        min = std::min(min, available);
+    }
+
+    return !signals.empty() && min > 0;
+}
+
 MultiReaderStatusPtr MultiReaderImpl::createReaderStatus(const DictPtr<IString, IEventPacket>& eventPackets, const NumberPtr& offset) const
 {
     auto mainDescriptor = DataDescriptorChangedEventPacket(descriptorToEventPacketParam(mainValueDescriptor),
@@ -1109,10 +1219,11 @@ NumberPtr MultiReaderImpl::calculateOffset() const
 
     const auto& firstSignal = signals.front();
     auto domainPacket = firstSignal.info.dataPacket.getDomainPacket();
-    if (domainPacket.assigned() && domainPacket.getOffset().assigned())
+    Int domainPacketOffset;
+    if (domainPacket.assigned() && getDataPacketIntOffset(domainPacket, domainPacketOffset))
     {
         Int delta = firstSignal.packetDelta;
-        return domainPacket.getOffset().getIntValue() + (firstSignal.info.prevSampleIndex * delta);
+        return domainPacketOffset + (firstSignal.info.prevSampleIndex * delta);
     }
 
     return 0;
@@ -1158,7 +1269,15 @@ MultiReaderStatusPtr MultiReaderImpl::readPackets()
     SyncStatus syncStatus{};
     const bool zeroDataRead = remainingSamplesToRead == 0;
 
-    if (timeout.count() > 0)
+    // Once all signals are synchronized, reads that can be served from queued data packets need no event handling
+    // or synchronization and go straight to copying the samples.
+    const bool readSynchronized = !zeroDataRead && portsConnected &&
+                                  getSynchronizedSamplesAvailable(remainingSamplesToRead, availableSamples) &&
+                                  (timeout.count() == 0 || availableSamples >= remainingSamplesToRead);
+    if (readSynchronized)
+        syncStatus = SyncStatus::Synchronized;
+
+    if (!readSynchronized && timeout.count() > 0)
     {
         MultiReaderStatusPtr status;
         auto condition = [this, zeroDataRead, &status, &availableSamples, &syncStatus]
@@ -3,6 +3,7 @@
 #include <coreobjects/ownable_ptr.h>
 #include <coreobjects/property_object_factory.h>
 #include <opendaq/data_descriptor_ptr.h>
+#include <opendaq/data_packet_private.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/event_packet_utils.h>
 #include <opendaq/packet_factory.h>
@@ -583,7 +584,8 @@ ReaderStatusPtr StreamReaderImpl::readPackets()
             if (!offset.assigned())
             {
                 const auto domainPacket = info.dataPacket.getDomainPacket();
-                if (domainPacket.assigned() && domainPacket.getOffset().assigned())
+                Int domainPacketOffset;
+                if (domainPacket.assigned() && getDataPacketIntOffset(domainPacket, domainPacketOffset))
                 {
                     Int delta = 0;
                     const auto domainRule = domainPacket.getDataDescriptor().getRule();
@@ -592,7 +594,7 @@ ReaderStatusPtr StreamReaderImpl::readPackets()
                         const auto domainRuleParams = domainRule.getParameters();
                         delta = domainRuleParams.get("delta");
                     }
-                    offset = domainPacket.getOffset().getIntValue() + (info.prevSampleIndex * delta);
+                    offset = domainPacketOffset + (info.prevSampleIndex * delta);
                 }
                 if (!offset.assigned())
                 {
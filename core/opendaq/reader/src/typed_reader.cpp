@@ -1,6 +1,7 @@
 #include <coretypes/validation.h>
 #include <opendaq/logger_component.h>
 #include <opendaq/logger_component_factory.h>
+#include <opendaq/data_packet_private.h>
 #include <opendaq/multi_typed_reader.h>
 #include <opendaq/packet_factory.h>
 #include <opendaq/reader_errors.h>
@@ -16,9 +17,14 @@ BEGIN_NAMESPACE_OPENDAQ
 template <typename T, typename = std::void_t<>>
 struct GreaterEqual
 {
+    static T Multiply(T value, std::int64_t numerator, std::int64_t denominator)
+    {
+        return value * static_cast<T>(numerator) / static_cast<T>(denominator);
+    }
+
     static T Multiply(T& value, const RatioPtr& multiplier)
     {
-        return value * static_cast<T>(multiplier.getNumerator()) / static_cast<T>(multiplier.getDenominator());
+        return Multiply(value, multiplier.getNumerator(), multiplier.getDenominator());
     }
 
     static T Adjust(T value, const RatioPtr& multiplier)
@@ -31,9 +37,9 @@ struct GreaterEqual
         return startValue + static_cast<T>(offset);
     }
 
-    static bool Check(const RatioPtr& multiplier, T readValue, T startValue)
+    static bool Check(std::int64_t numerator, std::int64_t denominator, T readValue, T startValue)
     {
-        return Multiply(readValue, multiplier) >= startValue;
+        return Multiply(readValue, numerator, denominator) >= startValue;
     }
 };
 template <typename T>
@@ -41,9 +47,14 @@ struct GreaterEqual<T, typename std::enable_if_t<daq::IsTemplateOf<T, daq::Range
 {
     using RangeValue = typename T::Type;
 
+    static RangeValue Multiply(RangeValue value, std::int64_t numerator, std::int64_t denominator)
+    {
+        return value * static_cast<RangeValue>(numerator) / static_cast<RangeValue>(denominator);
+    }
+
     static RangeValue Multiply(RangeValue value, const RatioPtr& multiplier)
     {
-        return value * static_cast<RangeValue>(multiplier.getNumerator()) / static_cast<RangeValue>(multiplier.getDenominator());
+        return Multiply(value, multiplier.getNumerator(), multiplier.getDenominator());
     }
 
     static RangeValue Adjust(T value, const RatioPtr& multiplier)
@@ -63,9 +74,9 @@ struct GreaterEqual<T, typename std::enable_if_t<daq::IsTemplateOf<T, daq::Range
         return T(start, end);
     }
 
-    static bool Check(const RatioPtr& multiplier, T readValue, T startValue)
+    static bool Check(std::int64_t numerator, std::int64_t denominator, T readValue, T startValue)
     {
-        return Multiply(readValue.start, multiplier) >= startValue.start;
+        return Multiply(readValue.start, numerator, denominator) >= startValue.start;
     }
 };
 
@@ -87,9 +98,9 @@ struct GreaterEqual<T, typename std::enable_if_t<daq::IsTemplateOf<T, daq::Compl
         DAQ_THROW_EXCEPTION(NotSupportedException);
     }
 
-    static constexpr bool Check(const RatioPtr& multiplier, T readValue, T startValue)
+    static bool Check(std::int64_t numerator, std::int64_t denominator, T readValue, T startValue)
     {
-        return Multiply(readValue, multiplier) >= startValue;
+        DAQ_THROW_EXCEPTION(NotSupportedException);
     }
 };
 
@@ -176,7 +187,8 @@ std::unique_ptr<Comparable> TypedReader<ReadType>::readStartLinear(const DataPac
     }
     else
     {
-        NumberPtr packetOffset = packet.getOffset();
+        Int packetOffset;
+        getDataPacketIntOffset(packet, packetOffset);
         const DataRulePtr linearRule = packet.getDataDescriptor().getRule();
         const auto parameters = linearRule.getParameters();
         ReadType delta, start;
@@ -193,7 +205,7 @@ std::unique_ptr<Comparable> TypedReader<ReadType>::readStartLinear(const DataPac
             }
         }
 
-        ReadType startingTick = start + static_cast<ReadType>(rdOffset) + static_cast<ReadType>(packetOffset.getIntValue()) +
+        ReadType startingTick = start + static_cast<ReadType>(rdOffset) + static_cast<ReadType>(packetOffset) +
                                 delta * static_cast<ReadType>(sampleIndex);
 
         return std::make_unique<ComparableValue<ReadType>>(startingTick, domainInfo);
@@ -247,6 +259,33 @@ ErrCode TypedReader<ReadType>::readData(void* inputBuffer, SizeT offset, void**
     return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALID_SAMPLE_TYPE, "Packet with invalid sample-type samples encountered");
 }
 
+template <typename ReadType>
+ErrCode TypedReader<ReadType>::readPacketValues(const DataPacketPtr& packet, SizeT offset, void** outputBuffer, SizeT count)
+{
+    if constexpr (std::is_integral_v<ReadType>)
+    {
+        if (linearRule && (ignoreTransform || !transformFunction.assigned()))
+        {
+            OPENDAQ_PARAM_NOT_NULL(outputBuffer);
+
+            Int packetOffset;
+            getDataPacketIntOffset(packet, packetOffset);
+            Int value = linearStart + packetOffset + linearDelta * static_cast<Int>(offset);
+
+            auto dataOut = static_cast<ReadType*>(*outputBuffer);
+            for (SizeT i = 0; i < count; ++i, value += linearDelta)
+            {
+                dataOut[i] = static_cast<ReadType>(value);
+            }
+
+            *outputBuffer = dataOut + count;
+            return OPENDAQ_SUCCESS;
+        }
+    }
+
+    return readData(packet.getData(), offset, outputBuffer, count);
+}
+
 template <typename ReadType>
 SizeT TypedReader<ReadType>::getOffsetTo(const ReaderDomainInfo& domainInfo,
                                          const Comparable& start,
@@ -426,57 +465,63 @@ SizeT TypedReader<TReadType>::getOffsetToData(const ReaderDomainInfo& domainInfo
         // Should always be non-negative
         auto startValue = GreaterEqual<TReadType>::ShiftByOffset(startV->getValue(), -domainInfo.offset);
 
-        // std::stringstream ss11;
-        // ss11 << toSysTime(startValue, domainInfo.epoch, domainInfo.readResolution);
-        // std::string s11 = ss11.str();
-        //
-        // std::stringstream eps;
-        // eps << domainInfo.epoch;
-        // std::string epoch = eps.str();
-        //
-        //
-        // [[maybe_unused]]
-        // int a = 5;
-
-        for (std::size_t i = 0; i < size * valuesPerSample; ++i)
+        const std::int64_t numerator = domainInfo.multiplierNumerator;
+        const std::int64_t denominator = domainInfo.multiplierDenominator;
+        const auto reachesStart = [&](SizeT i)
         {
-            // debug
-            // [[maybe_unused]] auto packetValue = dataStart[i];
-            // [[maybe_unused]] auto readValue = static_cast<TReadType>(packetValue);
-            // [[maybe_unused]] auto adjusted = GreaterEqual<TReadType>::Adjust(readValue, domainInfo.multiplier);
-            //
-            // std::stringstream ss1;
-            // ss1 << toSysTime(adjusted, domainInfo.epoch, domainInfo.readResolution);
-            // std::string s1 = ss1.str();
-
             TReadType readValue = static_cast<TReadType>(dataStart[i]);  // C4244 - possible data loss due to conversion
-            if (GreaterEqual<TReadType>::Check(domainInfo.multiplier, readValue, startValue))
+            return GreaterEqual<TReadType>::Check(numerator, denominator, readValue, startValue);
+        };
+
+        const SizeT valueCount = size * valuesPerSample;
+        SizeT index = valueCount;
+        if (valuesPerSample == 1)
+        {
+            // Domain values increase monotonically, so the first value at or after the start is found with a binary search
+            SizeT low = 0;
+            while (low < index)
+            {
+                const SizeT mid = low + (index - low) / 2;
+                if (reachesStart(mid))
+                    index = mid;
+                else
+                    low = mid + 1;
+            }
+        }
+        else
+        {
+            for (SizeT i = 0; i < valueCount; ++i)
+            {
+                if (reachesStart(i))
+                {
+                    index = i;
+                    break;
+                }
+            }
+        }
+
+        if (index < valueCount)
+        {
+            if (absoluteTimestamp)
             {
-                if (absoluteTimestamp)
+                TReadType readValue = static_cast<TReadType>(dataStart[index]);
+                if constexpr (IsTemplateOf<TReadType, daq::RangeType>::value)
+                {
+                    auto readValueSysTime = reader::toSysTime(readValue.start, domainInfo.epoch, domainInfo.resolution);
+                    *absoluteTimestamp = readValueSysTime.time_since_epoch().count();
+                }
+                else if constexpr (!IsTemplateOf<TReadType, daq::Complex_Number>::value)
                 {
-                    if constexpr (IsTemplateOf<TReadType, daq::RangeType>::value)
-                    {
-                        auto readValueSysTime = reader::toSysTime(readValue.start, domainInfo.epoch, domainInfo.resolution);
-                        *absoluteTimestamp =
-                            readValueSysTime.time_since_epoch().count();  // adjustedValueSysTime.time_since_epoch().count();
-                    }
-                    else if constexpr (!IsTemplateOf<TReadType, daq::Complex_Number>::value)
-                    {
-                        auto readValueSysTime = reader::toSysTime(readValue, domainInfo.epoch, domainInfo.resolution);
-                        *absoluteTimestamp = readValueSysTime.time_since_epoch().count();
-                    }
-                    else
-                    {
-                        DAQ_THROW_EXCEPTION(NotSupportedException);
-                    }
+                    auto readValueSysTime = reader::toSysTime(readValue, domainInfo.epoch, domainInfo.resolution);
+                    *absoluteTimestamp = readValueSysTime.time_since_epoch().count();
+                }
+                else
+                {
+                    DAQ_THROW_EXCEPTION(NotSupportedException);
                 }
-                return i / valuesPerSample;
             }
+            return index / valuesPerSample;
         }
-        // debug
-        // [[maybe_unused]] auto packetValue = dataStart[size - 1];
-        // [[maybe_unused]] auto readValue = static_cast<TReadType>(packetValue);
-        // [[maybe_unused]] auto adjusted = GreaterEqual<TReadType>::Adjust(readValue, domainInfo.multiplier);
 
         return static_cast<SizeT>(-1);
     }
@@ -524,10 +569,11 @@ SizeT TypedReader<ReadType>::getOffsetToDataLinear(const ReaderDomainInfo& domai
 
         ReadType ruleDelta, ruleStart;
         extractDeltaStart(parameters, ruleDelta, ruleStart);
-        NumberPtr packetOffset = packet.getOffset();
+        Int packetOffset;
+        getDataPacketIntOffset(packet, packetOffset);
 
         // Total packet offset in signal resolution ticks.
-        const ReadType startTick = ruleStart + static_cast<ReadType>(rdOffset) + static_cast<ReadType>(packetOffset.getIntValue());
+        const ReadType startTick = ruleStart + static_cast<ReadType>(rdOffset) + static_cast<ReadType>(packetOffset);
         const ReadType previousEndTick = startTick - ruleDelta;
         // In max resolution ticks since min epoch.
         auto comparablePreviousEndTick = std::make_unique<ComparableValue<ReadType>>(previousEndTick, domainInfo);
@@ -555,8 +601,8 @@ SizeT TypedReader<ReadType>::getOffsetToDataLinear(const ReaderDomainInfo& domai
         const auto* targetValue = dynamic_cast<const ComparableValue<ReadType>*>(&target);
         // Ticks from the end of the previous packet's end.
         ReadType ticksToTarget = targetValue->getValue() - comparablePreviousEndTick->getValue();
-        ReadType comparableDelta = static_cast<ReadType>(ruleDelta * domainInfo.multiplier.getNumerator() /
-                                                         static_cast<double>(domainInfo.multiplier.getDenominator()));
+        ReadType comparableDelta = static_cast<ReadType>(ruleDelta * domainInfo.multiplierNumerator /
+                                                         static_cast<double>(domainInfo.multiplierDenominator));
         // Minus one due to calculation from the previous packet end tick.
         SizeT index = static_cast<SizeT>((ticksToTarget + comparableDelta - 1) / comparableDelta) - 1;
 
@@ -744,6 +790,27 @@ bool TypedReader<ReadType>::handleDescriptorChanged(DataDescriptorPtr& descripto
             valuesPerSample = count;
         }
 
+        // Only 64-bit integer rules are evaluated directly, narrower types would have to wrap around like the packet data
+        linearRule = false;
+        const auto rule = descriptor.getRule();
+        if (rule.assigned() && rule.getType() == DataRuleType::Linear && valuesPerSample == 1 &&
+            (dataSampleType == SampleType::Int64 || dataSampleType == SampleType::UInt64))
+        {
+            const auto parameters = rule.getParameters();
+            linearDelta = parameters.get("delta");
+            linearStart = parameters.get("start");
+
+            const auto refDomainInfo = descriptor.getReferenceDomainInfo();
+            if (refDomainInfo.assigned())
+            {
+                const IntPtr referenceDomainOffset = refDomainInfo.getReferenceDomainOffset();
+                if (referenceDomainOffset.assigned())
+                    linearStart += static_cast<Int>(referenceDomainOffset);
+            }
+
+            linearRule = true;
+        }
+
         dataDescriptor = descriptor;
     }
 
@@ -1,6 +1,7 @@
 #include <opendaq/custom_log.h>
 #include <opendaq/event_packet_params.h>
 #include <opendaq/input_port_factory.h>
+#include <opendaq/multi_typed_reader.h>
 #include <opendaq/reader_config_ptr.h>
 #include <opendaq/reader_domain_info.h>
 #include <opendaq/reader_exceptions.h>
@@ -386,6 +387,33 @@ TEST_F(MultiReaderTest, SignalStartDomainFrom0SkipSamples)
     ASSERT_EQ(available, 0u);
 }
 
+TEST_F(MultiReaderTest, OffsetToExplicitDomain)
+{
+    DataDescriptorPtr descriptor = createDomainDescriptor("", nullptr, ExplicitDataRule());
+    auto domainReader = createReaderForType(SampleType::Int64, nullptr);
+    ASSERT_TRUE(domainReader->handleDescriptorChanged(descriptor, ReadMode::Scaled));
+
+    ReaderDomainInfo domainInfo(nullptr);
+    domainInfo.resolution = descriptor.getTickResolution();
+    domainInfo.adjustToCommonEpochResolution(domainInfo.epoch, Ratio(1, 2000));
+
+    // Ticks are in 1/1000 s while the common resolution is 1/2000 s
+    std::array<ClockTick, 9> ticks{0, 2, 3, 7, 8, 10, 15, 21, 22};
+
+    const auto offsetTo = [&](ClockTick startTick)
+    {
+        ComparableValue<ClockTick> start(startTick, domainInfo, false);
+        return domainReader->getOffsetTo(domainInfo, start, ticks.data(), ticks.size());
+    };
+
+    ASSERT_EQ(offsetTo(0), 0u);
+    ASSERT_EQ(offsetTo(3), 2u);
+    ASSERT_EQ(offsetTo(4), 3u);
+    ASSERT_EQ(offsetTo(9), 5u);
+    ASSERT_EQ(offsetTo(22), 8u);
+    ASSERT_EQ(offsetTo(23), static_cast<SizeT>(-1));
+}
+
 TEST_F(MultiReaderTest, IsSynchronized)
 {
     constexpr const auto NUM_SIGNALS = 3;
@@ -5234,3 +5262,130 @@ TEST_F(MultiReaderTest, UsedUnusedInput)
         ASSERT_TRUE(status.getValid());
     }
 }
+
+TEST_F(MultiReaderTest, ReadInterleavedAndPlanar)
+{
+    constexpr const auto NUM_SIGNALS = 3;
+
+    // prevent vector from re-allocating, so we have "stable" pointers
+    readSignals.reserve(NUM_SIGNALS);
+
+    auto& sig0 = addSignal(0, 10, createDomainSignal());
+    auto& sig1 = addSignal(0, 10, createDomainSignal());
+    auto& sig2 = addSignal(0, 10, createDomainSignal());
+
+    auto multi = MultiReaderBuilder().setInputPortNotificationMethod(PacketReadyNotification::SameThread).addSignals(signalsToList()).build();
+
+    {
+        SizeT count{0};
+        auto status = multi.read(nullptr, &count);
+        ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+    }
+
+    for (Int i = 0; i < 2; ++i)
+    {
+        sig0.createAndSendPacket(i);
+        sig1.createAndSendPacket(i);
+        sig2.createAndSendPacket(i);
+    }
+
+    std::array<double, NUM_SIGNALS * 10> samples{};
+
+    // Interleaved read of the first 6 samples
+    SizeT count{6};
+    auto status = multi.readInterleaved(samples.data(), &count);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Ok);
+    ASSERT_EQ(count, 6u);
+    for (SizeT j = 0; j < count; ++j)
+        for (SizeT i = 0; i < NUM_SIGNALS; ++i)
+            ASSERT_EQ(samples[j * NUM_SIGNALS + i], static_cast<double>(j));
+
+    // Interleaved read across the packet boundary
+    count = 10;
+    status = multi.readInterleaved(samples.data(), &count);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Ok);
+    ASSERT_EQ(count, 10u);
+    for (SizeT j = 0; j < count; ++j)
+        for (SizeT i = 0; i < NUM_SIGNALS; ++i)
+            ASSERT_EQ(samples[j * NUM_SIGNALS + i], static_cast<double>(6 + j));
+
+    // Planar read of the remaining samples
+    count = 10;
+    status = multi.readPlanar(samples.data(), &count);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Ok);
+    ASSERT_EQ(count, 4u);
+    for (SizeT i = 0; i < NUM_SIGNALS; ++i)
+        for (SizeT j = 0; j < count; ++j)
+            ASSERT_EQ(samples[i * 10 + j], static_cast<double>(16 + j));
+}
+
+TEST_F(MultiReaderTest, ReadInterleavedDifferentRates)
+{
+    readSignals.reserve(2);
+
+    auto& sig0 = addSignal(0, 10, createDomainSignal());
+    auto& sig1 = addSignal(0, 20, createDomainSignal("", nullptr, LinearDataRule(2, 0)));
+
+    auto multi = MultiReaderBuilder().setInputPortNotificationMethod(PacketReadyNotification::SameThread).addSignals(signalsToList()).build();
+
+    {
+        SizeT count{0};
+        multi.read(nullptr, &count);
+    }
+
+    sig0.createAndSendPacket(0);
+    sig1.createAndSendPacket(0);
+
+    std::array<double, 40> samples{};
+    SizeT count{10};
+    ASSERT_THROW(multi.readInterleaved(samples.data(), &count), InvalidStateException);
+}
+
+TEST_F(MultiReaderTest, ImplicitDomainConsecutiveReads)
+{
+    constexpr const auto NUM_SIGNALS = 2;
+    constexpr const SizeT SAMPLES = 3u;
+
+    readSignals.reserve(NUM_SIGNALS);
+
+    auto& sig0 = addSignal(0, 10, createDomainSignal());
+    auto& sig1 = addSignal(0, 10, createDomainSignal());
+
+    auto multi = MultiReaderBuilder().setInputPortNotificationMethod(PacketReadyNotification::SameThread).addSignals(signalsToList()).build();
+
+    {
+        SizeT count{0};
+        multi.read(nullptr, &count);
+    }
+
+    for (Int i = 0; i < 3; ++i)
+    {
+        sig0.createAndSendPacket(i);
+        sig1.createAndSendPacket(i);
+    }
+
+    std::array<double[SAMPLES], NUM_SIGNALS> values{};
+    std::array<ClockTick[SAMPLES], NUM_SIGNALS> domain{};
+
+    void* valuesPerSignal[NUM_SIGNALS]{values[0], values[1]};
+    void* domainPerSignal[NUM_SIGNALS]{domain[0], domain[1]};
+
+    // The domain is generated from the linear rule; it has to stay continuous over packet boundaries
+    for (SizeT read = 0; read < 10; ++read)
+    {
+        SizeT count{SAMPLES};
+        auto status = multi.readWithDomain(valuesPerSignal, domainPerSignal, &count);
+        ASSERT_EQ(status.getReadStatus(), ReadStatus::Ok);
+        ASSERT_EQ(count, SAMPLES);
+
+        for (SizeT i = 0; i < NUM_SIGNALS; ++i)
+        {
+            for (SizeT j = 0; j < SAMPLES; ++j)
+            {
+                const auto expected = static_cast<ClockTick>(read * SAMPLES + j);
+                ASSERT_EQ(domain[i][j], expected);
+                ASSERT_EQ(values[i][j], static_cast<double>(expected));
+            }
+        }
+    }
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/scheduler_ptr.h>
+#include <opendaq/work_factory.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_scheduler
+ * @addtogroup opendaq_scheduler_strand Scheduler strand
+ * @{
+ */
+
+/*!
+ * @brief A serial, coalescing execution queue on top of a scheduler.
+ *
+ * Each call to `post` records one pending request. While requests are pending, exactly one work item of the
+ * strand is scheduled, so the handler never runs concurrently with itself. A run hands the handler the number of
+ * requests posted since the previous run, which allows it to process all of them at once instead of scheduling
+ * a task per request. Requests posted while the handler runs are picked up by a follow-up run, which is
+ * scheduled anew so that a busy strand does not keep a worker thread to itself.
+ *
+ * The strand may be destroyed while a run is scheduled; the run then still executes the handler.
+ */
+class SchedulerStrand
+{
+public:
+    using Handler = std::function<void(SizeT requestCount)>;
+
+    SchedulerStrand(SchedulerPtr scheduler, Handler handler)
+        : state(std::make_shared<State>(std::move(scheduler), std::move(handler)))
+    {
+    }
+
+    /*!
+     * @brief Records a request and schedules a run of the handler if none is pending yet.
+     * @retval OPENDAQ_ERR_SCHEDULER_STOPPED when the scheduler already stopped and is not accepting any more work.
+     */
+    ErrCode post()
+    {
+        state->postCount.fetch_add(1, std::memory_order_relaxed);
+        if (state->pendingCount.fetch_add(1, std::memory_order_acq_rel) == 0)
+            return schedule(state);
+        return OPENDAQ_SUCCESS;
+    }
+
+    /*!
+     * @brief Gets the number of requests posted to the strand.
+     */
+    SizeT getPostCount() const
+    {
+        return state->postCount.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * @brief Gets the number of handler runs scheduled on the scheduler.
+     */
+    SizeT getScheduledRunCount() const
+    {
+        return state->scheduledRunCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct State
+    {
+        State(SchedulerPtr scheduler, Handler handler)
+            : scheduler(std::move(scheduler))
+            , handler(std::move(handler))
+        {
+        }
+
+        SchedulerPtr scheduler;
+        Handler handler;
+        std::atomic<SizeT> pendingCount{0};
+        std::atomic<SizeT> postCount{0};
+        std::atomic<SizeT> scheduledRunCount{0};
+    };
+
+    std::shared_ptr<State> state;
+
+    static ErrCode schedule(const std::shared_ptr<State>& state)
+    {
+        state->scheduledRunCount.fetch_add(1, std::memory_order_relaxed);
+
+        const ErrCode errCode = state->scheduler->scheduleWork(Work([state] { run(state); }));
+        if (OPENDAQ_FAILED(errCode))
+            state->pendingCount.store(0, std::memory_order_release);
+        return errCode;
+    }
+
+    static void run(const std::shared_ptr<State>& state)
+    {
+        const SizeT requestCount = state->pendingCount.load(std::memory_order_acquire);
+
+        try
+        {
+            state->handler(requestCount);
+        }
+        catch (...)
+        {
+            // the handler is responsible for reporting its errors; the strand must keep accepting requests
+        }
+
+        if (state->pendingCount.fetch_sub(requestCount, std::memory_order_acq_rel) != requestCount)
+        {
+            const ErrCode errCode = schedule(state);
+            if (OPENDAQ_FAILED(errCode))
+                daqClearErrorInfo();
+        }
+    }
+};
+
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
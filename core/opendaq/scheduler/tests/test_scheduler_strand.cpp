@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <opendaq/scheduler_factory.h>
+#include <opendaq/scheduler_strand.h>
+#include <opendaq/logger_factory.h>
+#include <atomic>
+#include <thread>
+
+using namespace daq;
+
+using SchedulerStrandTest = testing::Test;
+
+TEST_F(SchedulerStrandTest, CoalescesRequests)
+{
+    const auto scheduler = Scheduler(Logger(), 4);
+
+    std::atomic<bool> blocked{true};
+    std::atomic<SizeT> handledCount{0};
+    std::atomic<int> concurrentRuns{0};
+    std::atomic<bool> overlapped{false};
+
+    SchedulerStrand strand(scheduler,
+                           [&](SizeT requestCount)
+                           {
+                               if (concurrentRuns.fetch_add(1) != 0)
+                                   overlapped = true;
+                               while (blocked)
+                                   std::this_thread::yield();
+                               handledCount += requestCount;
+                               concurrentRuns.fetch_sub(1);
+                           });
+
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(strand.post(), OPENDAQ_SUCCESS);
+
+    blocked = false;
+    scheduler.waitAll();
+
+    ASSERT_FALSE(overlapped);
+    ASSERT_EQ(handledCount, 1000u);
+    ASSERT_EQ(strand.getPostCount(), 1000u);
+    ASSERT_LE(strand.getScheduledRunCount(), 2u);
+}
+
+TEST_F(SchedulerStrandTest, SerializesConcurrentPosts)
+{
+    const auto scheduler = Scheduler(Logger(), 4);
+
+    std::atomic<SizeT> handledCount{0};
+    std::atomic<int> concurrentRuns{0};
+    std::atomic<bool> overlapped{false};
+
+    SchedulerStrand strand(scheduler,
+                           [&](SizeT requestCount)
+                           {
+                               if (concurrentRuns.fetch_add(1) != 0)
+                                   overlapped = true;
+                               handledCount += requestCount;
+                               concurrentRuns.fetch_sub(1);
+                           });
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+        threads.emplace_back([&strand] {
+            for (int j = 0; j < 1000; ++j)
+                strand.post();
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    scheduler.waitAll();
+
+    ASSERT_FALSE(overlapped);
+    ASSERT_EQ(handledCount, 4000u);
+    ASSERT_LE(strand.getScheduledRunCount(), strand.getPostCount());
+}
+
+TEST_F(SchedulerStrandTest, StoppedScheduler)
+{
+    const auto scheduler = Scheduler(Logger(), 1);
+    scheduler.stop();
+
+    SchedulerStrand strand(scheduler, [](SizeT) {});
+
+    ASSERT_EQ(strand.post(), OPENDAQ_ERR_SCHEDULER_STOPPED);
+    daqClearErrorInfo();
+
+    // a failed schedule does not leave the strand waiting for a run that never happens
+    ASSERT_EQ(strand.post(), OPENDAQ_ERR_SCHEDULER_STOPPED);
+    daqClearErrorInfo();
+}
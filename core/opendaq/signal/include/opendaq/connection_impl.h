@@ -23,11 +23,11 @@
 #include <coretypes/weakrefobj.h>
 #include <opendaq/event_packet_ptr.h>
 #include <opendaq/data_packet_ptr.h>
+#include <opendaq/packet_ring_buffer.h>
 
-#ifdef OPENDAQ_THREAD_SAFE
-    #include <mutex>
-#endif
-
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <queue>
 
 BEGIN_NAMESPACE_OPENDAQ
@@ -69,8 +69,11 @@ public:
     // IConnectionInternal
     ErrCode INTERFACE_FUNC enqueueLastDescriptor() override;
 
+    // In lock-free mode, only packets already moved out of the ring buffer are returned.
     [[nodiscard]] const std::deque<PacketPtr>& getPackets() const noexcept;
 
+    static constexpr SizeT LockFreeQueueCapacity = 1024;
+
 #ifdef OPENDAQ_THREAD_SAFE
     template <typename Func>
     auto withLock(Func&& func) const
@@ -98,7 +101,8 @@ private:
     InputPortConfigPtr port;
     WeakRefPtr<ISignal> signalRef;
     ContextPtr context;
-    bool queueEmpty;
+    std::atomic<bool> queueEmpty;
+    PacketQueueMode queueMode;
     GapCheckState gapCheckState;
     DomainValue nextExpectedPacketOffset;
     DomainValue delta;
@@ -112,21 +116,49 @@ private:
     mutable std::mutex mutex;
 #endif
 
+    // Lock-free mode. Producers push into the ring buffer and, if it is full, into the overflow
+    // queue. All consumer state, including the packet counters and the `packets` queue holding
+    // packets already taken out of the ring, is guarded by the consumer mutex only.
+    std::unique_ptr<PacketRingBuffer> ringBuffer;
+    std::deque<PacketPtr> overflow;
+    std::atomic<bool> overflowPending;
+    SizeT ringAccountedPosition;
+    SizeT overflowAccountedCount;
+    // set on construction; read by the consumer, which must not read gapCheckState written by the producer
+    bool gapPacketsGenerated;
+    std::mutex overflowMutex;
+    std::mutex producerMutex;
+    std::mutex consumerMutex;
+
     void onPacketEnqueued(const PacketPtr& packet);
     void onPacketDequeued(const PacketPtr& packet);
 
-    void checkForGaps(const PacketPtr& packet);
-    void enqueueGapPacket(const DomainValue& diff);
+    PacketPtr checkForGaps(const PacketPtr& packet);
+    PacketPtr createGapPacket(const DomainValue& diff);
     void beginGapCheck(const DataPacketPtr& domainPacket);
     bool doGapCheck(const DataPacketPtr& domainPacket, DomainValue& diff);
     void initGapCheck(const EventPacketPtr& packet);
     void countPackets();
 
-    DomainValue numberToDomainValue(const NumberPtr& number);
+    DomainValue packetOffsetToDomainValue(const DataPacketPtr& packet);
 
     template <class P, class F>
     ErrCode enqueueInternal(P&& packet, const F& f);
 
+    template <typename Func>
+    auto withConsumerLock(Func&& func);
+    template <class F>
+    bool enqueueLockFree(const F& pushPackets);
+    void pushLockFree(PacketPtr&& packet);
+    void accountPublishedLockFree();
+    void accountEnqueuedLockFree(const PacketPtr& packet);
+    bool moveOverflowLockFree();
+    bool popLockFree(PacketPtr& packet);
+    IPacket* frontLockFree();
+    SizeT getPacketCountLockFree() const;
+    template <class F>
+    void forEachQueued(F&& f);
+
 #if _MSC_VER < 1920
     ErrCode enqueueMultipleInternal(const ListPtr<IPacket>& packets);
     ErrCode enqueueMultipleInternal(ListPtr<IPacket>&& packets);
@@ -244,6 +244,24 @@ OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
     INumber*, offset
 )
 
+/*!
+ * @brief Creates a Data packet with a given descriptor, sample count, an optional domain packet
+ * and an integer packet offset.
+ * @param domainPacket The Data packet carrying domain data. Can be null.
+ * @param descriptor The descriptor of the signal sending the data.
+ * @param sampleCount The number of samples in the packet.
+ * @param offset Packet offset, used to calculate the data of the packet if the Data rule of the Signal descriptor is not explicit.
+ *
+ * The offset is stored by value. A Number object is only created for it if the offset is requested with `getOffset`.
+ */
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, DataPacketWithIntOffset, IDataPacket,
+    IDataPacket*, domainPacket,
+    IDataDescriptor*, descriptor,
+    SizeT, sampleCount,
+    Int, offset
+)
+
 /*!
  * @brief Creates a Data packet with a given constat rule descriptor, initial constant value,
  * and other constant values.
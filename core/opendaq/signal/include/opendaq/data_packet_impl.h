@@ -19,6 +19,8 @@
 #include <opendaq/data_descriptor_ptr.h>
 #include <opendaq/data_rule_calc_private.h>
 #include <opendaq/deleter_ptr.h>
+#include <opendaq/allocator_ptr.h>
+#include <opendaq/data_packet_private.h>
 #include <opendaq/generic_data_packet_impl.h>
 #include <opendaq/range_factory.h>
 #include <opendaq/reference_domain_offset_adder.h>
@@ -251,13 +253,17 @@ struct CreatePacketNoMemoryTag
 {
 };
 
+struct InlineOffsetTag
+{
+};
+
 }
 
 template <typename TInterface = IDataPacket, typename ... TInterfaces>
-class DataPacketImpl : public GenericDataPacketImpl<TInterface, IReusableDataPacket, TInterfaces ...>
+class DataPacketImpl : public GenericDataPacketImpl<TInterface, IReusableDataPacket, IDataPacketPrivate, TInterfaces ...>
 {
 public:
-    using Super = GenericDataPacketImpl<TInterface, IReusableDataPacket, TInterfaces ...>;
+    using Super = GenericDataPacketImpl<TInterface, IReusableDataPacket, IDataPacketPrivate, TInterfaces ...>;
 
     explicit DataPacketImpl(IDataPacket* domainPacket,
                             IDataDescriptor* descriptor,
@@ -266,6 +272,12 @@ public:
 
     explicit DataPacketImpl(IDataDescriptor* descriptor, SizeT sampleCount, INumber* offset);
 
+    explicit DataPacketImpl(PacketDetails::InlineOffsetTag,
+                            IDataPacket* domainPacket,
+                            IDataDescriptor* descriptor,
+                            SizeT sampleCount,
+                            Int offset);
+
     explicit DataPacketImpl(PacketDetails::CreatePacketNoMemoryTag,
                             IDataPacket* domainPacket,
                             IDataDescriptor* descriptor,
@@ -311,17 +323,38 @@ public:
                                  Bool canReallocMemory,
                                  Bool* success) override;
 
+    // IDataPacketPrivate
+    Bool INTERFACE_FUNC getIntOffset(Int* offset) const override;
+    Bool INTERFACE_FUNC getFloatOffset(Float* offset) const override;
+
 protected:
+    // Creates an empty packet that is initialized later with initPooled; used by the packet pool.
+    DataPacketImpl();
+
+    // The packet has no offset if neither offset nor intOffset is set.
+    void initPooled(IDataPacket* domainPacket, IDataDescriptor* descriptor, SizeT sampleCount, INumber* offset, const Int* intOffset);
+    void releasePooled();
+
     void internalDispose([[maybe_unused]] bool disposing) override;
     bool isDataEqual(const DataPacketPtr& dataPacket) const;
     void freeMemory();
     void freeScaledData();
+    void* allocateScaledData(SizeT size);
     void initPacket();
     void updateCalcFlags();
+    void setOffset(INumber* number);
+    void setOffset(Int value);
+    const NumberPtr& getOffsetObject();
+    bool offsetEquals(const NumberPtr& other) const;
 
     DeleterPtr deleter;
     DataDescriptorPtr descriptor;
+    // The offset is kept by value. The Number object is only created once requested through getOffset,
+    // unless the packet was created with one.
     NumberPtr offset = nullptr;
+    Int intOffset = 0;
+    Float floatOffset = 0.0;
+    CoreType offsetType = ctUndefined;
     uint32_t sampleCount;
     uint32_t sampleSize, dataSize;
     uint32_t rawSampleSize, rawDataSize;
@@ -334,6 +367,10 @@ protected:
     // larger one is needed, so recomputing does not reallocate.
     uint32_t scaledDataCapacity = 0;
 
+    // Borrowed from the deleter if it is also an allocator (e.g. a pool allocator), in which case
+    // the scaled data buffer is allocated from it as well.
+    IAllocator* scaledDataAllocator = nullptr;
+
     std::mutex readLock;
 
     bool hasScalingCalc;
@@ -376,7 +413,6 @@ DataPacketImpl<TInterface, TInterfaces...>::DataPacketImpl(IDataPacket* domainPa
                                                            INumber* offset)
     : Super(domainPacket)
     , descriptor(descriptor)
-    , offset(offset)
     , sampleCount(static_cast<uint32_t>(sampleCount))
     , hasScalingCalc(false)
     , hasDataRuleCalc(false)
@@ -404,6 +440,7 @@ DataPacketImpl<TInterface, TInterfaces...>::DataPacketImpl(IDataPacket* domainPa
     }
     memorySize = rawDataSize;
 
+    setOffset(offset);
     initPacket();
 }
 
@@ -418,7 +455,6 @@ DataPacketImpl<TInterface, TInterfaces...>::DataPacketImpl(IDataPacket* domainPa
     : Super(domainPacket)
     , deleter(deleter)
     , descriptor(descriptor)
-    , offset(offset)
     , sampleCount(static_cast<uint32_t>(sampleCount))
     , hasScalingCalc(false)
     , hasDataRuleCalc(false)
@@ -445,6 +481,10 @@ DataPacketImpl<TInterface, TInterfaces...>::DataPacketImpl(IDataPacket* domainPa
     memorySize = rawDataSize;
     data = externalMemory;
 
+    if (this->deleter.assigned())
+        scaledDataAllocator = this->deleter.template asPtrOrNull<IAllocator>(true).getObject();
+
+    setOffset(offset);
     initPacket();
 }
 
@@ -454,6 +494,142 @@ DataPacketImpl<TInterface, TInterfaces...>::DataPacketImpl(IDataDescriptor* desc
 {
 }
 
+template <typename TInterface, typename... TInterfaces>
+DataPacketImpl<TInterface, TInterfaces...>::DataPacketImpl(PacketDetails::InlineOffsetTag,
+                                                           IDataPacket* domainPacket,
+                                                           IDataDescriptor* descriptor,
+                                                           SizeT sampleCount,
+                                                           Int offset)
+    : DataPacketImpl<TInterface, TInterfaces...>(domainPacket, descriptor, sampleCount, nullptr)
+{
+    setOffset(offset);
+}
+
+template <typename TInterface, typename... TInterfaces>
+DataPacketImpl<TInterface, TInterfaces...>::DataPacketImpl()
+    : Super(nullptr)
+    , sampleCount(0)
+    , sampleSize(0)
+    , dataSize(0)
+    , rawSampleSize(0)
+    , rawDataSize(0)
+    , memorySize(0)
+    , data(nullptr)
+    , scaledData(nullptr)
+    , hasScalingCalc(false)
+    , hasDataRuleCalc(false)
+    , hasRawDataOnly(true)
+    , externalMemory(false)
+    , hasReferenceDomainOffset(false)
+{
+}
+
+template <typename TInterface, typename... TInterfaces>
+void DataPacketImpl<TInterface, TInterfaces...>::initPooled(
+    IDataPacket* domainPacket, IDataDescriptor* descriptor, SizeT sampleCount, INumber* offset, const Int* intOffset)
+{
+    if (descriptor == nullptr)
+        DAQ_THROW_EXCEPTION(ArgumentNullException, "Data descriptor in packet is null.");
+
+    this->descriptor = descriptor;
+    this->domainPacket = domainPacket;
+    this->packetId = daqGeneratePacketId();
+    this->sampleCount = static_cast<uint32_t>(sampleCount);
+
+    sampleSize = static_cast<uint32_t>(this->descriptor.getSampleSize());
+    rawSampleSize = static_cast<uint32_t>(this->descriptor.getRawSampleSize());
+    dataSize = this->sampleCount * sampleSize;
+    rawDataSize = this->sampleCount * rawSampleSize;
+
+    // The memory of the previous use is kept and only grown when needed
+    if (rawDataSize > memorySize)
+    {
+        std::free(data);
+        data = std::malloc(rawDataSize);
+        memorySize = data != nullptr ? rawDataSize : 0;
+
+        if (data == nullptr)
+            DAQ_THROW_EXCEPTION(NoMemoryException);
+    }
+
+    if (intOffset != nullptr)
+        setOffset(*intOffset);
+    else
+        setOffset(offset);
+
+    initPacket();
+    scaledDataValid = false;
+}
+
+template <typename TInterface, typename... TInterfaces>
+void DataPacketImpl<TInterface, TInterfaces...>::releasePooled()
+{
+    // Same notifications and references as on destruction, but the data buffers are kept for the next use
+    this->callDestructCallbacks();
+
+    this->domainPacket.release();
+    descriptor.release();
+    offset.release();
+    offsetType = ctUndefined;
+}
+
+template <typename TInterface, typename... TInterfaces>
+void DataPacketImpl<TInterface, TInterfaces...>::setOffset(INumber* number)
+{
+    offset = number;
+    if (!offset.assigned())
+    {
+        offsetType = ctUndefined;
+        return;
+    }
+
+    if (offset.getCoreType() == ctFloat)
+    {
+        offsetType = ctFloat;
+        floatOffset = offset.getFloatValue();
+    }
+    else
+    {
+        offsetType = ctInt;
+        intOffset = offset.getIntValue();
+    }
+}
+
+template <typename TInterface, typename... TInterfaces>
+void DataPacketImpl<TInterface, TInterfaces...>::setOffset(Int value)
+{
+    offset.release();
+    offsetType = ctInt;
+    intOffset = value;
+}
+
+template <typename TInterface, typename... TInterfaces>
+const NumberPtr& DataPacketImpl<TInterface, TInterfaces...>::getOffsetObject()
+{
+    if (!offset.assigned())
+    {
+        if (offsetType == ctInt)
+            offset = IntegerFromPool(intOffset).template asPtr<INumber>();
+        else if (offsetType == ctFloat)
+            offset = FloatingFromPool(floatOffset).template asPtr<INumber>();
+    }
+
+    return offset;
+}
+
+template <typename TInterface, typename... TInterfaces>
+bool DataPacketImpl<TInterface, TInterfaces...>::offsetEquals(const NumberPtr& other) const
+{
+    if (!other.assigned())
+        return offsetType == ctUndefined;
+
+    if (offsetType == ctInt)
+        return other.getCoreType() != ctFloat && other.getIntValue() == intOffset;
+    if (offsetType == ctFloat)
+        return other.getCoreType() == ctFloat && other.getFloatValue() == floatOffset;
+    return false;
+}
+
 template <typename TInterface, typename... TInterfaces>
 DataPacketImpl<TInterface, TInterfaces...>::DataPacketImpl(PacketDetails::CreatePacketNoMemoryTag,
                                                            IDataPacket* domainPacket,
@@ -462,7 +638,6 @@ DataPacketImpl<TInterface, TInterfaces...>::DataPacketImpl(PacketDetails::Create
                                                            INumber* offset)
     : Super(domainPacket)
     , descriptor(descriptor)
-    , offset(offset)
     , sampleCount(static_cast<uint32_t>(sampleCount))
     , hasScalingCalc(false)
     , hasDataRuleCalc(false)
@@ -484,6 +659,7 @@ DataPacketImpl<TInterface, TInterfaces...>::DataPacketImpl(PacketDetails::Create
     memorySize = rawDataSize;
     externalMemory = true;
 
+    setOffset(offset);
     initPacket();
 }
 
@@ -559,8 +735,28 @@ ErrCode DataPacketImpl<TInterface, TInterfaces...>::getOffset(INumber** offset)
 {
     OPENDAQ_PARAM_NOT_NULL(offset);
 
-    *offset = this->offset.addRefAndReturn();
-    return OPENDAQ_SUCCESS;
+    if (offsetType == ctUndefined)
+    {
+        *offset = nullptr;
+        return OPENDAQ_SUCCESS;
+    }
+
+    std::lock_guard lock{readLock};
+    return daqTry([this, &offset] { *offset = getOffsetObject().addRefAndReturn(); });
+}
+
+template <typename TInterface, typename... TInterfaces>
+Bool DataPacketImpl<TInterface, TInterfaces...>::getIntOffset(Int* offset) const
+{
+    *offset = offsetType == ctFloat ? static_cast<Int>(floatOffset) : intOffset;
+    return offsetType != ctUndefined;
+}
+
+template <typename TInterface, typename... TInterfaces>
+Bool DataPacketImpl<TInterface, TInterfaces...>::getFloatOffset(Float* offset) const
+{
+    *offset = offsetType == ctFloat ? floatOffset : static_cast<Float>(intOffset);
+    return offsetType != ctUndefined;
 }
 
 template <typename TInterface, typename... TInterfaces>
@@ -602,10 +798,11 @@ ErrCode DataPacketImpl<TInterface, TInterfaces...>::getData(void** address)
         {
             if (scaledDataCapacity < dataSize)
             {
-                std::free(scaledData);
+                freeScaledData();
+                scaledData = nullptr;
                 scaledDataCapacity = 0;
 
-                scaledData = std::malloc(dataSize);
+                scaledData = allocateScaledData(dataSize);
                 if (scaledData == nullptr)
                     DAQ_THROW_EXCEPTION(NoMemoryException);
 
@@ -620,7 +817,7 @@ ErrCode DataPacketImpl<TInterface, TInterfaces...>::getData(void** address)
             }
             else if (hasDataRuleCalc)
             {
-                descriptor.asPtr<IDataRuleCalcPrivate>(true)->calculateRule(offset, sampleCount, data, rawDataSize, &scaledData);
+                descriptor.asPtr<IDataRuleCalcPrivate>(true)->calculateRule(getOffsetObject(), sampleCount, data, rawDataSize, &scaledData);
             }
             else
             {
@@ -691,7 +888,7 @@ ErrCode INTERFACE_FUNC DataPacketImpl<TInterface, TInterfaces...>::equals(IBaseO
             return errCode;
         if (this->sampleCount != packetOther.getSampleCount())
             return errCode;
-        if (this->offset != packetOther.getOffset())
+        if (!this->offsetEquals(packetOther.getOffset()))
             return errCode;
         if (!this->isDataEqual(packetOther))
             return errCode;
@@ -749,9 +946,9 @@ ErrCode DataPacketImpl<TInterface, TInterfaces...>::getRawValueByIndex(void** va
         else if (hasDataRuleCalc)
         {
             if (sampleIndex == sampleCount - 1)
-                descriptor.asPtr<IDataRuleCalcPrivate>(true)->calculateLastSample(offset, sampleCount, data, rawDataSize, value);
+                descriptor.asPtr<IDataRuleCalcPrivate>(true)->calculateLastSample(getOffsetObject(), sampleCount, data, rawDataSize, value);
             else
-                descriptor.asPtr<IDataRuleCalcPrivate>(true)->calculateSample(offset, sampleIndex, data, rawDataSize, value);
+                descriptor.asPtr<IDataRuleCalcPrivate>(true)->calculateSample(getOffsetObject(), sampleIndex, data, rawDataSize, value);
         }
     });
     OPENDAQ_RETURN_IF_FAILED(errCode);
@@ -838,7 +1035,7 @@ ErrCode DataPacketImpl<TInterface, TInterfaces...>::reuse(IDataDescriptor* newDe
     if (newDescriptorPtr.assigned())
         descriptor = newDescriptorPtr;
     if (newOffset != nullptr)
-        offset = newOffset;
+        setOffset(newOffset);
     if (newDomainPacket != nullptr)
         this->domainPacket = newDomainPacket;
 
@@ -866,7 +1063,21 @@ void DataPacketImpl<TInterface, TInterfaces...>::internalDispose(bool disposing)
 template <typename TInterface, typename... TInterfaces>
 void DataPacketImpl<TInterface, TInterfaces...>::freeScaledData()
 {
-    std::free(scaledData);
+    if (scaledDataAllocator != nullptr)
+        scaledDataAllocator->free(scaledData);
+    else
+        std::free(scaledData);
+}
+
+template <typename TInterface, typename... TInterfaces>
+void* DataPacketImpl<TInterface, TInterfaces...>::allocateScaledData(SizeT size)
+{
+    if (scaledDataAllocator == nullptr)
+        return std::malloc(size);
+
+    void* address = nullptr;
+    checkErrorInfo(scaledDataAllocator->allocate(descriptor, size, 0, &address));
+    return address;
 }
 
 template <typename TInterface, typename... TInterfaces>
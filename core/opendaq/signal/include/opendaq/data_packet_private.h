@@ -0,0 +1,84 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/baseobject.h>
+#include <coretypes/number_ptr.h>
+#include <opendaq/data_packet_ptr.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_packets
+ * @addtogroup opendaq_data_packet Data packet
+ * @{
+ */
+
+/*!
+ * @brief Internal functions used by openDAQ core. This interface should never be used in
+ * client SDK or module code.
+ *
+ * Gives access to the packet offset without creating a Number object for it.
+ */
+DECLARE_OPENDAQ_INTERFACE(IDataPacketPrivate, IBaseObject)
+{
+    /*!
+     * @brief Gets the packet offset as an integer. Floating point offsets are truncated.
+     * @param[out] offset The packet offset, or 0 if the packet has none.
+     * @returns True if the packet has an offset; false otherwise.
+     */
+    virtual Bool INTERFACE_FUNC getIntOffset(Int* offset) const = 0;
+
+    /*!
+     * @brief Gets the packet offset as a floating point value.
+     * @param[out] offset The packet offset, or 0 if the packet has none.
+     * @returns True if the packet has an offset; false otherwise.
+     */
+    virtual Bool INTERFACE_FUNC getFloatOffset(Float* offset) const = 0;
+};
+/*!@}*/
+
+/*!
+ * @brief Gets the integer offset of a data packet. Packets that do not implement IDataPacketPrivate
+ * are queried through getOffset.
+ * @returns False if the packet has no offset, in which case `offset` is set to 0.
+ */
+inline bool getDataPacketIntOffset(const DataPacketPtr& packet, Int& offset)
+{
+    if (const auto packetPrivate = packet.asPtrOrNull<IDataPacketPrivate>(true); packetPrivate.assigned())
+        return packetPrivate->getIntOffset(&offset);
+
+    const NumberPtr number = packet.getOffset();
+    offset = number.assigned() ? number.getIntValue() : 0;
+    return number.assigned();
+}
+
+/*!
+ * @brief Gets the floating point offset of a data packet. Packets that do not implement IDataPacketPrivate
+ * are queried through getOffset.
+ * @returns False if the packet has no offset, in which case `offset` is set to 0.
+ */
+inline bool getDataPacketFloatOffset(const DataPacketPtr& packet, Float& offset)
+{
+    if (const auto packetPrivate = packet.asPtrOrNull<IDataPacketPrivate>(true); packetPrivate.assigned())
+        return packetPrivate->getFloatOffset(&offset);
+
+    const NumberPtr number = packet.getOffset();
+    offset = number.assigned() ? number.getFloatValue() : 0.0;
+    return number.assigned();
+}
+
+END_NAMESPACE_OPENDAQ
@@ -19,6 +19,7 @@
 #include <opendaq/signal_exceptions.h>
 #include <opendaq/range_type.h>
 #include <opendaq/sample_type_traits.h>
+#include <opendaq/scaling_kernels.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -85,14 +86,21 @@ private:
     void calculateLastConstantSample(const SizeT sampleCount, void* input, SizeT inputSize, void** output);
 
     DataRuleType type;
-    std::vector<T> parameters;
+    T delta{};
+    T start{};
 };
 
 template <typename T>
 DataRuleCalcTyped<T>::DataRuleCalcTyped(const DataRulePtr& rule)
 {
     type = rule.getType();
-    parameters = ParseRuleParameters(rule.getParameters(), type);
+
+    const auto parameters = ParseRuleParameters(rule.getParameters(), type);
+    if (parameters.size() == 2)
+    {
+        delta = parameters[0];
+        start = parameters[1];
+    }
 }
 
 template <typename T>
@@ -262,18 +270,15 @@ inline void DataRuleCalcTyped<ClockRange>::calculateLinearRule(const NumberPtr&
     for (SizeT i = 0; i < sampleCount; ++i)
     {
         outputTyped[i] = ClockRange(packetOffset);
-        outputTyped[i].start += i * parameters[0].start + parameters[1].start;
+        outputTyped[i].start += i * delta.start + start.start;
     }
 }
 
 template <typename T>
 void DataRuleCalcTyped<T>::calculateLinearRule(const NumberPtr& packetOffset, SizeT sampleCount, void** output) const
 {
-    T* outputTyped = static_cast<T*>(*output);
-    const T scale = parameters[0];
-    const T offset = static_cast<T>(packetOffset) + parameters[1];
-    for (SizeT i = 0; i < sampleCount; ++i)
-        outputTyped[i] = scale * static_cast<T>(i) + offset;
+    const T offset = static_cast<T>(packetOffset) + start;
+    kernels::linearRule(static_cast<T*>(*output), sampleCount, delta, offset);
 }
 
 template <typename T>
@@ -341,17 +346,16 @@ inline void DataRuleCalcTyped<ClockRange>::calculateLinearSample(const NumberPtr
     auto* outputTyped = static_cast<ClockRange*>(*output);
     *outputTyped = ClockRange(packetOffset);
 
-    outputTyped->start = parameters[0].start * sampleIndex + (parameters[1].start + packetOffset.getIntValue());
+    outputTyped->start = delta.start * sampleIndex + (start.start + packetOffset.getIntValue());
 }
 
 template <typename T>
 inline void DataRuleCalcTyped<T>::calculateLinearSample(const NumberPtr& packetOffset, const SizeT sampleIndex, void** output) const
 {
     T* outputTyped = static_cast<T*>(*output);
-    const T scale = parameters[0];
-    const T offset = static_cast<T>(packetOffset) + parameters[1];
+    const T offset = static_cast<T>(packetOffset) + start;
 
-    *outputTyped = scale * static_cast<T>(sampleIndex) + offset;
+    *outputTyped = delta * static_cast<T>(sampleIndex) + offset;
 }
 
 template <typename T>
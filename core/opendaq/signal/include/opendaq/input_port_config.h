@@ -37,6 +37,20 @@ enum class PacketReadyNotification : EnumType
     Unspecified = 99            ///< Invalid state for ports, used by readers when asked to preserve port notification mechanism
 };
 
+/*!
+ * @brief Represents the packet queue implementation used by connections of an input port.
+ *
+ * The lock-free modes store packets in a bounded single-producer/single-consumer ring buffer,
+ * so that enqueueing a packet never waits for the reader that dequeues it. Packets that do not fit
+ * into the ring are kept in an overflow queue and are never dropped.
+ */
+enum class PacketQueueMode : EnumType
+{
+    Locked = 0,                 ///< Packets are stored in a mutex protected queue.
+    LockFreeSingleProducer,     ///< Lock-free ring buffer. Packets must be enqueued from one thread at a time.
+    LockFreeMultiProducer       ///< Lock-free ring buffer. Producers are serialized among themselves, but never with the consumer.
+};
+
  /*!
  * @ingroup opendaq_signal_path
  * @addtogroup opendaq_input_port Input port
@@ -117,6 +131,21 @@ DECLARE_OPENDAQ_INTERFACE(IInputPortConfig, IInputPort)
      * @brief Gets the object receiving input-port related events and notifications.
      */
     virtual ErrCode INTERFACE_FUNC getListener(IInputPortNotifications** port) = 0;
+
+    /*!
+     * @brief Sets the packet queue implementation used by connections of the input port.
+     * @param mode The packet queue mode.
+     *
+     * The mode is applied when a signal is connected to the input port. An already established
+     * connection keeps its queue implementation until the signal is reconnected.
+     */
+    virtual ErrCode INTERFACE_FUNC setPacketQueueMode(PacketQueueMode mode) = 0;
+
+    /*!
+     * @brief Gets the packet queue implementation used by connections of the input port.
+     * @param[out] mode The packet queue mode.
+     */
+    virtual ErrCode INTERFACE_FUNC getPacketQueueMode(PacketQueueMode* mode) = 0;
 };
 /*!@}*/
 
@@ -28,13 +28,15 @@
 #include <opendaq/signal_events_ptr.h>
 #include <opendaq/signal_factory.h>
 #include <opendaq/signal_private_ptr.h>
-#include <opendaq/work_factory.h>
 #include <opendaq/scheduler_errors.h>
+#include <opendaq/scheduler_strand.h>
 #include <opendaq/component_update_context_ptr.h>
 #include <opendaq/cyclic_ref_check.h>
 
 #include "opendaq/errors.h"
 
+#include <memory>
+
 BEGIN_NAMESPACE_OPENDAQ
 
 // https://developercommunity.visualstudio.com/t/inline-static-destructors-are-called-multiple-time/1157794
@@ -85,10 +87,14 @@ public:
     ErrCode INTERFACE_FUNC setRequiresSignal(Bool requiresSignal) override;
 
     ErrCode INTERFACE_FUNC getGapCheckingEnabled(Bool* gapCheckingEnabled) override;
+    ErrCode INTERFACE_FUNC setPacketQueueMode(PacketQueueMode mode) override;
+    ErrCode INTERFACE_FUNC getPacketQueueMode(PacketQueueMode* mode) override;
 
     // IInputPortPrivate
     ErrCode INTERFACE_FUNC disconnectWithoutSignalNotification() override;
     ErrCode INTERFACE_FUNC connectSignalSchedulerNotification(ISignal* signal) override;
+    ErrCode INTERFACE_FUNC getSchedulerNotificationRequestCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getSchedulerNotificationRunCount(SizeT* count) override;
 
     // IOwnable
     ErrCode INTERFACE_FUNC setOwner(IPropertyObject* owner) override;
@@ -134,10 +140,12 @@ private:
     const bool gapCheckingEnabled;
     BaseObjectPtr customData;
     PacketReadyNotification notifyMethod{};
+    PacketQueueMode packetQueueMode{};
 
     WeakRefPtr<IInputPortNotifications> listenerRef;
     WeakRefPtr<IConnection> connectionRef{};
-    WorkPtr notifySchedulerCallback;
+    // Replaced under the config lock and read with atomic loads on the packet path
+    std::shared_ptr<SchedulerStrand> notifySchedulerStrand;
 
     LoggerComponentPtr loggerComponent;
     SchedulerPtr scheduler;
@@ -167,6 +175,7 @@ GenericInputPortImpl<TInterface, Interfaces...>::GenericInputPortImpl(const Cont
     , isPublic(true)
     , gapCheckingEnabled(gapCheckingEnabled)
     , notifyMethod(PacketReadyNotification::None)
+    , packetQueueMode(PacketQueueMode::Locked)
     , listenerRef(nullptr)
     , connectionRef(nullptr)
 {
@@ -381,7 +390,11 @@ void GenericInputPortImpl<TInterface, Interfaces...>::notifyPacketEnqueuedSameTh
 template <typename TInterface, typename...  Interfaces>
 void GenericInputPortImpl<TInterface, Interfaces...>::notifyPacketEnqueuedScheduler()
 {
-    const auto errCode = scheduler->scheduleWork(notifySchedulerCallback);
+    const auto strand = std::atomic_load(&notifySchedulerStrand);
+    if (!strand)
+        return;
+
+    const auto errCode = strand->post();
     if (OPENDAQ_FAILED(errCode) && (errCode != OPENDAQ_ERR_SCHEDULER_STOPPED))
         checkErrorInfo(errCode);
 }
@@ -472,28 +485,44 @@ ErrCode GenericInputPortImpl<TInterface, Interfaces...>::setListener(IInputPortN
     }
 
     listenerRef = port;
-    if (listenerRef.assigned())
+    if (listenerRef.assigned() && scheduler.assigned())
     {
+        // Notifications of a port are serialized and coalesced: while one is scheduled, further enqueued
+        // packets only increase the request count of the pending run instead of scheduling more work.
         auto portRef = this->template getWeakRefInternal<IInputPort>();
-        notifySchedulerCallback = Work([notifyRef = listenerRef, portRef = portRef, loggerComponent = loggerComponent]
-        {
-            auto notify = notifyRef.getRef();
-            auto port = portRef.getRef();
-            if (notify.assigned() && port.assigned())
+        auto strand = std::make_shared<SchedulerStrand>(
+            scheduler,
+            [notifyRef = listenerRef, portRef = portRef, loggerComponent = loggerComponent](SizeT requestCount)
             {
-                try
+                auto notify = notifyRef.getRef();
+                auto port = portRef.getRef();
+                if (!notify.assigned() || !port.assigned())
+                    return;
+
+                // Listeners that dequeue a single packet per notification are notified once per request,
+                // those that drain the queue only once.
+                for (SizeT i = 0; i < requestCount; ++i)
                 {
-                    notify.packetReceived(port);
-                }
-                catch (const std::exception& e)
-                {
-                    LOG_E("Input port notification failed: {}", e.what());
+                    try
+                    {
+                        if (i > 0)
+                        {
+                            const auto connection = port.getConnection();
+                            if (!connection.assigned() || connection.getPacketCount() == 0)
+                                break;
+                        }
+                        notify.packetReceived(port);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        LOG_E("Input port notification failed: {}", e.what());
+                    }
                 }
-            }
-        });
+            });
+        std::atomic_store(&notifySchedulerStrand, std::move(strand));
     }
     else
-        notifySchedulerCallback.release();
+        std::atomic_store(&notifySchedulerStrand, std::shared_ptr<SchedulerStrand>());
 
     return OPENDAQ_SUCCESS;
 }
@@ -565,6 +594,26 @@ ErrCode GenericInputPortImpl<TInterface, Interfaces...>::connectSignalSchedulerN
     return connectInternal(signal, true);
 }
 
+template <typename TInterface, typename...  Interfaces>
+ErrCode GenericInputPortImpl<TInterface, Interfaces...>::getSchedulerNotificationRequestCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    const auto strand = std::atomic_load(&notifySchedulerStrand);
+    *count = strand ? strand->getPostCount() : 0;
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename TInterface, typename...  Interfaces>
+ErrCode GenericInputPortImpl<TInterface, Interfaces...>::getSchedulerNotificationRunCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    const auto strand = std::atomic_load(&notifySchedulerStrand);
+    *count = strand ? strand->getScheduledRunCount() : 0;
+    return OPENDAQ_SUCCESS;
+}
+
 template <typename TInterface, typename...  Interfaces>
 void GenericInputPortImpl<TInterface, Interfaces...>::finishUpdate()
 {
@@ -913,6 +962,29 @@ ErrCode GenericInputPortImpl<TInterface, Interfaces...>::getGapCheckingEnabled(B
     return OPENDAQ_SUCCESS;
 }
 
+template <typename TInterface, typename...  Interfaces>
+ErrCode GenericInputPortImpl<TInterface, Interfaces...>::setPacketQueueMode(PacketQueueMode mode)
+{
+    if (mode != PacketQueueMode::Locked && mode != PacketQueueMode::LockFreeSingleProducer && mode != PacketQueueMode::LockFreeMultiProducer)
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Invalid packet queue mode");
+
+    auto lock = this->getRecursiveConfigLock2();
+    packetQueueMode = mode;
+
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename TInterface, typename...  Interfaces>
+ErrCode GenericInputPortImpl<TInterface, Interfaces...>::getPacketQueueMode(PacketQueueMode* mode)
+{
+    OPENDAQ_PARAM_NOT_NULL(mode);
+
+    auto lock = this->getRecursiveConfigLock2();
+    *mode = packetQueueMode;
+
+    return OPENDAQ_SUCCESS;
+}
+
 OPENDAQ_REGISTER_DESERIALIZE_FACTORY(InputPortImpl)
 
 END_NAMESPACE_OPENDAQ
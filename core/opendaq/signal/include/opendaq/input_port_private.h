@@ -47,6 +47,21 @@ DECLARE_OPENDAQ_INTERFACE(IInputPortPrivate, IBaseObject)
      * `onPacketReceived` notification instead of invoking it on the same thread.
      */
     virtual ErrCode INTERFACE_FUNC connectSignalSchedulerNotification(ISignal* signal) = 0;
+
+    /*!
+     * @brief Gets the number of packet notifications requested from the scheduler since the current listener was set.
+     * @param[out] count The number of requested notifications.
+     */
+    virtual ErrCode INTERFACE_FUNC getSchedulerNotificationRequestCount(SizeT* count) = 0;
+
+    /*!
+     * @brief Gets the number of notification runs scheduled on the scheduler since the current listener was set.
+     * @param[out] count The number of scheduled runs.
+     *
+     * Notifications requested while a run is pending are coalesced into it, so the count is at most
+     * the number of requested notifications.
+     */
+    virtual ErrCode INTERFACE_FUNC getSchedulerNotificationRunCount(SizeT* count) = 0;
 };
 /*!@}*/
 
@@ -20,6 +20,10 @@
 #include <opendaq/allocator_ptr.h>
 #include <opendaq/deleter_ptr.h>
 #include <opendaq/external_allocator_factory.h>
+#include <opendaq/deleter_factory.h>
+#include <opendaq/signal_ptr.h>
+#include <opendaq/signal_packet_allocator_ptr.h>
+#include <type_traits>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -63,6 +67,39 @@ inline DataPacketPtr DataPacketWithDomain(const DataPacketPtr& domainPacket,
     return obj;
 }
 
+/*!
+ * @brief Creates a Data packet with a given descriptor, sample count and an integer packet offset.
+ * @param descriptor The descriptor of the signal sending the data.
+ * @param sampleCount The number of samples in the packet.
+ * @param offset Packet offset, used to calculate the data of the packet if the Data rule of the Signal descriptor is not explicit.
+ *
+ * The offset is stored in the packet by value, without creating a Number object for it.
+ */
+template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+DataPacketPtr DataPacket(const DataDescriptorPtr& descriptor, uint64_t sampleCount, T offset)
+{
+    DataPacketPtr obj(DataPacketWithIntOffset_Create(nullptr, descriptor, static_cast<SizeT>(sampleCount), static_cast<Int>(offset)));
+    return obj;
+}
+
+/*!
+ * @brief Creates a Data packet with a given descriptor, sample count, a reference to a packet that
+ * describes the domain (time) data, and an integer packet offset.
+ * @param domainPacket The Data packet carrying domain data.
+ * @param descriptor The descriptor of the signal sending the data.
+ * @param sampleCount The number of samples in the packet.
+ * @param offset Packet offset, used to calculate the data of the packet if the Data rule of the Signal descriptor is not explicit.
+ *
+ * The offset is stored in the packet by value, without creating a Number object for it.
+ */
+template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+DataPacketPtr DataPacketWithDomain(const DataPacketPtr& domainPacket, const DataDescriptorPtr& descriptor, uint64_t sampleCount, T offset)
+{
+    DataPacketPtr obj(
+        DataPacketWithIntOffset_Create(domainPacket, descriptor, static_cast<SizeT>(sampleCount), static_cast<Int>(offset)));
+    return obj;
+}
+
 #pragma pack(push, 1)
 template <class T>
 struct ConstantPosAndValue
@@ -134,6 +171,76 @@ inline DataPacketPtr DataPacketWithExternalMemory(const DataPacketPtr& domainPac
     return obj;
 }
 
+/*!
+ * @brief Creates a Data packet with a given descriptor, sample count,
+ * a reference to a packet that describes the domain (time) data, and an optional packet offset,
+ * with the memory of the packet allocated by the given allocator.
+ *
+ * The memory is returned to the allocator when the packet is destroyed. If the allocator also
+ * implements `IDeleter`, as the pool allocator does, it is used as the deleter of the packet directly
+ * and the scaled data of the packet is allocated from it as well.
+ *
+ * @param domainPacket The Data packet carrying domain data.
+ * @param descriptor The descriptor of the signal sending the data.
+ * @param sampleCount The number of samples in the packet.
+ * @param allocator The allocator used to allocate the memory of the packet.
+ * @param offset Optional packet offset parameter, used to calculate the data of the packet
+ * if the Data rule of the Signal descriptor is not explicit.
+ */
+inline DataPacketPtr DataPacketWithAllocator(const DataPacketPtr& domainPacket,
+                                             const DataDescriptorPtr& descriptor,
+                                             uint64_t sampleCount,
+                                             const AllocatorPtr& allocator,
+                                             NumberPtr offset = nullptr)
+{
+    auto deleter = allocator.asPtrOrNull<IDeleter>();
+    if (!deleter.assigned())
+        deleter = Deleter([allocator](void* address) { allocator.free(address); });
+
+    const SizeT rawDataSize = static_cast<SizeT>(sampleCount) * descriptor.getRawSampleSize();
+    void* data = rawDataSize > 0 ? allocator.allocate(descriptor, rawDataSize, 0) : nullptr;
+    if (rawDataSize > 0 && data == nullptr)
+        DAQ_THROW_EXCEPTION(NoMemoryException);
+
+    try
+    {
+        return DataPacketWithExternalMemory(domainPacket, descriptor, sampleCount, data, deleter, offset);
+    }
+    catch (...)
+    {
+        allocator.free(data);
+        throw;
+    }
+}
+
+/*!
+ * @brief Creates a Data packet for the given signal, using the signal's descriptor.
+ *
+ * If an allocator is attached to the signal via `ISignalPacketAllocator`, the memory of the packet is
+ * allocated with it, otherwise the packet is allocated by the default allocator.
+ *
+ * @param signal The signal sending the data.
+ * @param domainPacket The Data packet carrying domain data.
+ * @param sampleCount The number of samples in the packet.
+ * @param offset Optional packet offset parameter, used to calculate the data of the packet
+ * if the Data rule of the Signal descriptor is not explicit.
+ */
+inline DataPacketPtr DataPacketForSignal(const SignalPtr& signal,
+                                         const DataPacketPtr& domainPacket,
+                                         uint64_t sampleCount,
+                                         NumberPtr offset = nullptr)
+{
+    const auto descriptor = signal.getDescriptor();
+
+    if (const auto allocatorSlot = signal.asPtrOrNull<ISignalPacketAllocator>(true); allocatorSlot.assigned())
+    {
+        if (const auto allocator = allocatorSlot.getPacketAllocator(); allocator.assigned())
+            return DataPacketWithAllocator(domainPacket, descriptor, sampleCount, allocator, std::move(offset));
+    }
+
+    return DataPacketWithDomain(domainPacket, descriptor, sampleCount, std::move(offset));
+}
+
 /*!
  * @brief Creates and Event packet with a given id and parameter dictionary.
  * @param id The ID of the event.
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/packet.h>
+#include <atomic>
+#include <cassert>
+#include <memory>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Bounded single-producer/single-consumer ring buffer of packets.
+ *
+ * The ring owns one reference to every packet stored in it. Positions are monotonic and are
+ * mapped to slots with a power-of-two mask, so the consumer can address any published packet
+ * between `readPosition()` and `writePosition()` without removing it.
+ */
+class PacketRingBuffer
+{
+public:
+    explicit PacketRingBuffer(SizeT minCapacity)
+        : capacity(roundUpToPowerOfTwo(minCapacity))
+        , mask(capacity - 1)
+        , slots(std::make_unique<IPacket*[]>(capacity))
+    {
+    }
+
+    ~PacketRingBuffer()
+    {
+        IPacket* packet;
+        while ((packet = tryPop()) != nullptr)
+            packet->releaseRef();
+    }
+
+    PacketRingBuffer(const PacketRingBuffer&) = delete;
+    PacketRingBuffer& operator=(const PacketRingBuffer&) = delete;
+
+    // Producer side. Takes over the reference on success.
+    bool tryPush(IPacket* packet)
+    {
+        const SizeT pos = tail.value.load(std::memory_order_relaxed);
+        if (pos - cachedHead >= capacity)
+        {
+            cachedHead = head.value.load(std::memory_order_acquire);
+            if (pos - cachedHead >= capacity)
+                return false;
+        }
+
+        slots[pos & mask] = packet;
+        tail.value.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns an owned reference or nullptr if the ring is empty.
+    IPacket* tryPop()
+    {
+        const SizeT pos = head.value.load(std::memory_order_relaxed);
+        if (pos == cachedTail)
+        {
+            cachedTail = tail.value.load(std::memory_order_acquire);
+            if (pos == cachedTail)
+                return nullptr;
+        }
+
+        IPacket* packet = slots[pos & mask];
+        slots[pos & mask] = nullptr;
+        head.value.store(pos + 1, std::memory_order_release);
+        return packet;
+    }
+
+    // Consumer side. The position must be in the range [readPosition(), writePosition()).
+    IPacket* at(SizeT pos) const
+    {
+        assert(pos - readPosition() < capacity);
+        return slots[pos & mask];
+    }
+
+    SizeT readPosition() const
+    {
+        return head.value.load(std::memory_order_relaxed);
+    }
+
+    SizeT writePosition() const
+    {
+        return tail.value.load(std::memory_order_acquire);
+    }
+
+    SizeT getCapacity() const
+    {
+        return capacity;
+    }
+
+private:
+    // Keeps the producer and consumer positions on separate cache lines.
+    struct alignas(64) Position
+    {
+        std::atomic<SizeT> value{0};
+    };
+
+    static SizeT roundUpToPowerOfTwo(SizeT value)
+    {
+        SizeT result = 2;
+        while (result < value)
+            result <<= 1;
+        return result;
+    }
+
+    const SizeT capacity;
+    const SizeT mask;
+    std::unique_ptr<IPacket*[]> slots;
+
+    Position head;
+    SizeT cachedTail{0};
+
+    Position tail;
+    SizeT cachedHead{0};
+};
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/allocator.h>
+#include <coreobjects/property_object.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_utility
+ * @addtogroup opendaq_allocator Allocator
+ * @{
+ */
+
+/*!
+ * @brief An allocator that recycles memory blocks through size-class pools.
+ *
+ * Allocations up to the largest size class are rounded up to a power of two and served from lock-free
+ * free lists. Each thread prefers its own shard of a size class when allocating and freeing, so threads
+ * producing and releasing packets rarely touch the same free list. Larger allocations are passed to `malloc`.
+ *
+ * The pool allocator also implements `IDeleter`, so it can be passed directly as the deleter of packets
+ * created with memory allocated by it. Such packets keep the allocator alive and allocate their scaled
+ * data buffers from it as well. Devices typically create one pool allocator per signal or per group of signals
+ * with similar packet sizes.
+ */
+DECLARE_OPENDAQ_INTERFACE(IPoolAllocator, IAllocator)
+{
+    /*!
+     * @brief Gets a snapshot of the allocator statistics.
+     * @param[out] statistics The property object with the following read-only properties:
+     * - "AllocationCount": The number of allocations made.
+     * - "PoolHitCount": The number of allocations served by recycled blocks.
+     * - "HitRate": The ratio of pool hits to all allocations.
+     * - "BytesLive": The number of bytes currently allocated.
+     * - "HighWaterMark": The largest value of "BytesLive" observed.
+     * - "CachedBytes": The number of bytes held in the free lists.
+     */
+    virtual ErrCode INTERFACE_FUNC getStatistics(IPropertyObject** statistics) = 0;
+};
+/*!@}*/
+
+/*!
+ * @brief Creates a pool allocator.
+ * @param maxCachedBytesPerSizeClass The upper bound of memory held by the free blocks of a single size class.
+ */
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, PoolAllocator,
+    IPoolAllocator,
+    SizeT, maxCachedBytesPerSizeClass
+)
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,40 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/pool_allocator_ptr.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_allocator
+ * @addtogroup opendaq_allocator_factories Factories
+ * @{
+ */
+
+/*!
+ * @brief Creates a pool allocator.
+ * @param maxCachedBytesPerSizeClass The upper bound of memory held by the free blocks of a single size class.
+ */
+inline PoolAllocatorPtr PoolAllocator(SizeT maxCachedBytesPerSizeClass = 4 * 1024 * 1024)
+{
+    PoolAllocatorPtr obj(PoolAllocator_Create(maxCachedBytesPerSizeClass));
+    return obj;
+}
+
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/pool_allocator.h>
+#include <opendaq/deleter.h>
+#include <coretypes/intfs.h>
+#include <coretypes/lock_free_stack.h>
+#include <array>
+#include <atomic>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+class PoolAllocatorImpl : public ImplementationOf<IPoolAllocator, IDeleter>
+{
+public:
+    static constexpr size_t MinBlockSizeShift = 6;
+    static constexpr size_t MaxBlockSizeShift = 20;
+    static constexpr size_t SizeClassCount = MaxBlockSizeShift - MinBlockSizeShift + 1;
+    static constexpr size_t ShardCount = 8;
+
+    explicit PoolAllocatorImpl(SizeT maxCachedBytesPerSizeClass);
+    ~PoolAllocatorImpl() override;
+
+    ErrCode INTERFACE_FUNC allocate(
+        const IDataDescriptor *descriptor,
+        daq::SizeT bytes,
+        daq::SizeT align,
+        VoidPtr* address) override;
+
+    ErrCode INTERFACE_FUNC free(VoidPtr address) override;
+
+    ErrCode INTERFACE_FUNC getStatistics(IPropertyObject** statistics) override;
+
+    // IDeleter
+    ErrCode INTERFACE_FUNC deleteMemory(void* address) override;
+
+private:
+    struct SizeClass
+    {
+        std::array<LockFreeStackHandle, ShardCount> shards;
+        std::atomic<size_t> freeBlockCount{0};
+        size_t maxFreeBlockCount{0};
+    };
+
+    void* allocateBlock(size_t blockSize, uint32_t sizeClassIndex, bool& poolHit);
+    void freeBlock(void* block, uint32_t sizeClassIndex);
+    void updateHighWaterMark(size_t bytesLive);
+
+    static uint32_t getSizeClassIndex(size_t blockSize);
+    static size_t getShardIndex();
+
+    std::array<SizeClass, SizeClassCount> sizeClasses;
+
+    std::atomic<size_t> allocationCount{0};
+    std::atomic<size_t> poolHitCount{0};
+    std::atomic<size_t> bytesLive{0};
+    std::atomic<size_t> highWaterMark{0};
+};
+
+END_NAMESPACE_OPENDAQ
@@ -18,6 +18,7 @@
 #include <opendaq/scaling_ptr.h>
 #include <opendaq/signal_exceptions.h>
 #include <opendaq/sample_type_traits.h>
+#include <opendaq/scaling_kernels.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -54,7 +55,8 @@ private:
     void scaleLinear(void* data, SizeT sampleCount, void** output);
 
     ScalingType type;
-    std::vector<U> params;
+    U scale{};
+    U offset{};
 };
 
 template <typename T, typename U>
@@ -63,10 +65,8 @@ ScalingCalcTyped<T, U>::ScalingCalcTyped(const ScalingPtr& scaling)
     type = scaling.getType();
     if (type == ScalingType::Linear)
     {
-        U scale = scaling.getParameters().get("scale");
-        U offset = scaling.getParameters().get("offset");
-        params.push_back(scale);
-        params.push_back(offset);
+        scale = scaling.getParameters().get("scale");
+        offset = scaling.getParameters().get("offset");
     }
 }
 
@@ -105,12 +105,7 @@ void* ScalingCalcTyped<T, U>::scaleLinear(void* data, SizeT sampleCount)
 template <typename T, typename U>
 void ScalingCalcTyped<T, U>::scaleLinear(void* data, SizeT sampleCount, void** output)
 {
-    T* rawData = static_cast<T*>(data);
-    U* scaledData = static_cast<U*>(*output);
-    const U scale = params[0];
-    const U offset = params[1];
-    for (SizeT i = 0; i < sampleCount; ++i)
-        scaledData[i] = scale * static_cast<U>(rawData[i]) + offset;
+    kernels::scaleLinear(static_cast<const T*>(data), static_cast<U*>(*output), sampleCount, scale, offset);
 }
 
 static ScalingCalc* createScalingCalcTyped(const ScalingPtr& scaling)
@@ -0,0 +1,636 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(_M_ARM64EC)
+    #define OPENDAQ_KERNELS_AVX2
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define OPENDAQ_KERNELS_NEON
+    #include <arm_neon.h>
+#endif
+
+#if defined(OPENDAQ_KERNELS_AVX2) && (defined(__GNUC__) || defined(__clang__))
+    #define OPENDAQ_KERNELS_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define OPENDAQ_KERNELS_TARGET_AVX2
+#endif
+
+/*
+ * Kernels used by the scaling and data rule calculators to produce the scaled / implicit
+ * sample values of data packets.
+ *
+ * On x86-64 the AVX2 kernels are selected at runtime, on AArch64 the NEON kernels are always
+ * available. Type combinations without a vector kernel use the scalar loop. The vector kernels
+ * multiply and add in separate steps (fused on AArch64, as the compilers do for the scalar
+ * code there), so the results are identical to the scalar implementation.
+ */
+
+namespace daq::kernels
+{
+
+template <typename T, typename U>
+void scaleLinearScalar(const T* input, U* output, size_t count, U scale, U offset)
+{
+    for (size_t i = 0; i < count; ++i)
+        output[i] = scale * static_cast<U>(input[i]) + offset;
+}
+
+// Integer "delta * index + offset" with two's complement wrap-around. Computed in unsigned arithmetic
+// of at least int width, so that the integer promotion of narrow types cannot overflow.
+template <typename T>
+std::make_unsigned_t<T> integerLinearValue(T delta, size_t index, T offset)
+{
+    using Unsigned = std::make_unsigned_t<T>;
+    using Wide = std::common_type_t<Unsigned, unsigned>;
+
+    const auto wideDelta = static_cast<Wide>(static_cast<Unsigned>(delta));
+    const auto wideIndex = static_cast<Wide>(static_cast<Unsigned>(index));
+    const auto wideOffset = static_cast<Wide>(static_cast<Unsigned>(offset));
+    return static_cast<Unsigned>(wideDelta * wideIndex + wideOffset);
+}
+
+template <typename T>
+void linearRuleScalar(T* output, size_t first, size_t count, T delta, T offset)
+{
+    if constexpr (std::is_integral_v<T>)
+    {
+        for (size_t i = first; i < count; ++i)
+            output[i] = static_cast<T>(integerLinearValue(delta, i, offset));
+    }
+    else
+    {
+        for (size_t i = first; i < count; ++i)
+            output[i] = delta * static_cast<T>(i) + offset;
+    }
+}
+
+#if defined(OPENDAQ_KERNELS_AVX2)
+
+inline bool cpuSupportsAvx2()
+{
+    static const bool supported = []
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+            return false;
+
+        __cpuid(info, 1);
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx = (info[2] & (1 << 28)) != 0;
+        if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+            return false;
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2") != 0;
+#endif
+    }();
+
+    return supported;
+}
+
+namespace avx2
+{
+
+// Loads a full vector worth of input samples converted to the output type.
+template <typename T, typename U>
+struct Loader
+{
+    static constexpr bool Supported = false;
+};
+
+template <typename T>
+struct LoaderBase
+{
+    static constexpr bool Supported = true;
+
+    template <typename P>
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m128i loadBytes(const P* ptr, size_t bytes)
+    {
+        if (bytes == 16)
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+        if (bytes == 8)
+            return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr));
+
+        int32_t value;
+        std::memcpy(&value, ptr, sizeof(value));
+        return _mm_cvtsi32_si128(value);
+    }
+};
+
+template <>
+struct Loader<float, float> : LoaderBase<float>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256 load(const float* ptr) { return _mm256_loadu_ps(ptr); }
+};
+
+template <>
+struct Loader<double, float> : LoaderBase<double>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256 load(const double* ptr)
+    {
+        const __m128 low = _mm256_cvtpd_ps(_mm256_loadu_pd(ptr));
+        const __m128 high = _mm256_cvtpd_ps(_mm256_loadu_pd(ptr + 4));
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+    }
+};
+
+template <>
+struct Loader<int8_t, float> : LoaderBase<int8_t>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256 load(const int8_t* ptr) { return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(loadBytes(ptr, 8))); }
+};
+
+template <>
+struct Loader<uint8_t, float> : LoaderBase<uint8_t>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256 load(const uint8_t* ptr) { return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(loadBytes(ptr, 8))); }
+};
+
+template <>
+struct Loader<int16_t, float> : LoaderBase<int16_t>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256 load(const int16_t* ptr) { return _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(loadBytes(ptr, 16))); }
+};
+
+template <>
+struct Loader<uint16_t, float> : LoaderBase<uint16_t>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256 load(const uint16_t* ptr) { return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(loadBytes(ptr, 16))); }
+};
+
+template <>
+struct Loader<int32_t, float> : LoaderBase<int32_t>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256 load(const int32_t* ptr)
+    {
+        return _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr)));
+    }
+};
+
+template <>
+struct Loader<float, double> : LoaderBase<float>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256d load(const float* ptr) { return _mm256_cvtps_pd(_mm_loadu_ps(ptr)); }
+};
+
+template <>
+struct Loader<double, double> : LoaderBase<double>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256d load(const double* ptr) { return _mm256_loadu_pd(ptr); }
+};
+
+template <>
+struct Loader<int8_t, double> : LoaderBase<int8_t>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256d load(const int8_t* ptr) { return _mm256_cvtepi32_pd(_mm_cvtepi8_epi32(loadBytes(ptr, 4))); }
+};
+
+template <>
+struct Loader<uint8_t, double> : LoaderBase<uint8_t>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256d load(const uint8_t* ptr) { return _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(loadBytes(ptr, 4))); }
+};
+
+template <>
+struct Loader<int16_t, double> : LoaderBase<int16_t>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256d load(const int16_t* ptr) { return _mm256_cvtepi32_pd(_mm_cvtepi16_epi32(loadBytes(ptr, 8))); }
+};
+
+template <>
+struct Loader<uint16_t, double> : LoaderBase<uint16_t>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256d load(const uint16_t* ptr) { return _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(loadBytes(ptr, 8))); }
+};
+
+template <>
+struct Loader<int32_t, double> : LoaderBase<int32_t>
+{
+    OPENDAQ_KERNELS_TARGET_AVX2 static __m256d load(const int32_t* ptr) { return _mm256_cvtepi32_pd(loadBytes(ptr, 16)); }
+};
+
+template <typename T>
+OPENDAQ_KERNELS_TARGET_AVX2 void scaleLinear(const T* input, float* output, size_t count, float scale, float offset)
+{
+    const __m256 scaleVec = _mm256_set1_ps(scale);
+    const __m256 offsetVec = _mm256_set1_ps(offset);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 value = Loader<T, float>::load(input + i);
+        _mm256_storeu_ps(output + i, _mm256_add_ps(_mm256_mul_ps(scaleVec, value), offsetVec));
+    }
+
+    scaleLinearScalar(input + i, output + i, count - i, scale, offset);
+}
+
+template <typename T>
+OPENDAQ_KERNELS_TARGET_AVX2 void scaleLinear(const T* input, double* output, size_t count, double scale, double offset)
+{
+    const __m256d scaleVec = _mm256_set1_pd(scale);
+    const __m256d offsetVec = _mm256_set1_pd(offset);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m256d value = Loader<T, double>::load(input + i);
+        _mm256_storeu_pd(output + i, _mm256_add_pd(_mm256_mul_pd(scaleVec, value), offsetVec));
+    }
+
+    scaleLinearScalar(input + i, output + i, count - i, scale, offset);
+}
+
+// Index vectors are converted from 32-bit integers, which is exact only up to INT32_MAX.
+inline size_t vectorizableIndexCount(size_t count)
+{
+    constexpr size_t maxIndex = static_cast<size_t>(std::numeric_limits<int32_t>::max());
+    return count < maxIndex ? count : maxIndex;
+}
+
+OPENDAQ_KERNELS_TARGET_AVX2 inline size_t linearRule(float* output, size_t count, float delta, float offset)
+{
+    const size_t vectorCount = vectorizableIndexCount(count);
+    const __m256 deltaVec = _mm256_set1_ps(delta);
+    const __m256 offsetVec = _mm256_set1_ps(offset);
+    const __m256i step = _mm256_set1_epi32(8);
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    size_t i = 0;
+    for (; i + 8 <= vectorCount; i += 8)
+    {
+        _mm256_storeu_ps(output + i, _mm256_add_ps(_mm256_mul_ps(deltaVec, _mm256_cvtepi32_ps(index)), offsetVec));
+        index = _mm256_add_epi32(index, step);
+    }
+
+    return i;
+}
+
+OPENDAQ_KERNELS_TARGET_AVX2 inline size_t linearRule(double* output, size_t count, double delta, double offset)
+{
+    const size_t vectorCount = vectorizableIndexCount(count);
+    const __m256d deltaVec = _mm256_set1_pd(delta);
+    const __m256d offsetVec = _mm256_set1_pd(offset);
+    const __m128i step = _mm_set1_epi32(4);
+    __m128i index = _mm_setr_epi32(0, 1, 2, 3);
+
+    size_t i = 0;
+    for (; i + 4 <= vectorCount; i += 4)
+    {
+        _mm256_storeu_pd(output + i, _mm256_add_pd(_mm256_mul_pd(deltaVec, _mm256_cvtepi32_pd(index)), offsetVec));
+        index = _mm_add_epi32(index, step);
+    }
+
+    return i;
+}
+
+template <typename T>
+OPENDAQ_KERNELS_TARGET_AVX2 size_t linearRule(T* output, size_t count, T delta, T offset)
+{
+    static_assert(std::is_integral_v<T>);
+    using Unsigned = std::make_unsigned_t<T>;
+    constexpr size_t lanes = 32 / sizeof(T);
+
+    alignas(32) Unsigned initial[lanes];
+    for (size_t lane = 0; lane < lanes; ++lane)
+        initial[lane] = integerLinearValue(delta, lane, offset);
+
+    const Unsigned laneStep = integerLinearValue(delta, lanes, T{0});
+    __m256i value = _mm256_load_si256(reinterpret_cast<const __m256i*>(initial));
+    __m256i step;
+    if constexpr (sizeof(T) == 1)
+        step = _mm256_set1_epi8(static_cast<char>(laneStep));
+    else if constexpr (sizeof(T) == 2)
+        step = _mm256_set1_epi16(static_cast<short>(laneStep));
+    else if constexpr (sizeof(T) == 4)
+        step = _mm256_set1_epi32(static_cast<int>(laneStep));
+    else
+        step = _mm256_set1_epi64x(static_cast<long long>(laneStep));
+
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), value);
+        if constexpr (sizeof(T) == 1)
+            value = _mm256_add_epi8(value, step);
+        else if constexpr (sizeof(T) == 2)
+            value = _mm256_add_epi16(value, step);
+        else if constexpr (sizeof(T) == 4)
+            value = _mm256_add_epi32(value, step);
+        else
+            value = _mm256_add_epi64(value, step);
+    }
+
+    return i;
+}
+
+}
+
+#elif defined(OPENDAQ_KERNELS_NEON)
+
+namespace neon
+{
+
+template <typename T, typename U>
+struct Loader
+{
+    static constexpr bool Supported = false;
+};
+
+template <typename T>
+struct LoaderBase
+{
+    static constexpr bool Supported = true;
+
+    static uint64_t loadBits(const T* ptr, size_t bytes)
+    {
+        uint64_t value = 0;
+        std::memcpy(&value, ptr, bytes);
+        return value;
+    }
+};
+
+template <>
+struct Loader<float, float> : LoaderBase<float>
+{
+    static float32x4_t load(const float* ptr) { return vld1q_f32(ptr); }
+};
+
+template <>
+struct Loader<double, float> : LoaderBase<double>
+{
+    static float32x4_t load(const double* ptr) { return vcombine_f32(vcvt_f32_f64(vld1q_f64(ptr)), vcvt_f32_f64(vld1q_f64(ptr + 2))); }
+};
+
+template <>
+struct Loader<int8_t, float> : LoaderBase<int8_t>
+{
+    static float32x4_t load(const int8_t* ptr)
+    {
+        const int16x8_t wide = vmovl_s8(vcreate_s8(loadBits(ptr, 4)));
+        return vcvtq_f32_s32(vmovl_s16(vget_low_s16(wide)));
+    }
+};
+
+template <>
+struct Loader<uint8_t, float> : LoaderBase<uint8_t>
+{
+    static float32x4_t load(const uint8_t* ptr)
+    {
+        const uint16x8_t wide = vmovl_u8(vcreate_u8(loadBits(ptr, 4)));
+        return vcvtq_f32_u32(vmovl_u16(vget_low_u16(wide)));
+    }
+};
+
+template <>
+struct Loader<int16_t, float> : LoaderBase<int16_t>
+{
+    static float32x4_t load(const int16_t* ptr) { return vcvtq_f32_s32(vmovl_s16(vld1_s16(ptr))); }
+};
+
+template <>
+struct Loader<uint16_t, float> : LoaderBase<uint16_t>
+{
+    static float32x4_t load(const uint16_t* ptr) { return vcvtq_f32_u32(vmovl_u16(vld1_u16(ptr))); }
+};
+
+template <>
+struct Loader<int32_t, float> : LoaderBase<int32_t>
+{
+    static float32x4_t load(const int32_t* ptr) { return vcvtq_f32_s32(vld1q_s32(ptr)); }
+};
+
+template <>
+struct Loader<uint32_t, float> : LoaderBase<uint32_t>
+{
+    static float32x4_t load(const uint32_t* ptr) { return vcvtq_f32_u32(vld1q_u32(ptr)); }
+};
+
+template <>
+struct Loader<float, double> : LoaderBase<float>
+{
+    static float64x2_t load(const float* ptr) { return vcvt_f64_f32(vld1_f32(ptr)); }
+};
+
+template <>
+struct Loader<double, double> : LoaderBase<double>
+{
+    static float64x2_t load(const double* ptr) { return vld1q_f64(ptr); }
+};
+
+template <>
+struct Loader<int8_t, double> : LoaderBase<int8_t>
+{
+    static float64x2_t load(const int8_t* ptr)
+    {
+        const int16x8_t wide = vmovl_s8(vcreate_s8(loadBits(ptr, 2)));
+        return vcvtq_f64_s64(vmovl_s32(vget_low_s32(vmovl_s16(vget_low_s16(wide)))));
+    }
+};
+
+template <>
+struct Loader<uint8_t, double> : LoaderBase<uint8_t>
+{
+    static float64x2_t load(const uint8_t* ptr)
+    {
+        const uint16x8_t wide = vmovl_u8(vcreate_u8(loadBits(ptr, 2)));
+        return vcvtq_f64_u64(vmovl_u32(vget_low_u32(vmovl_u16(vget_low_u16(wide)))));
+    }
+};
+
+template <>
+struct Loader<int16_t, double> : LoaderBase<int16_t>
+{
+    static float64x2_t load(const int16_t* ptr)
+    {
+        return vcvtq_f64_s64(vmovl_s32(vget_low_s32(vmovl_s16(vcreate_s16(loadBits(ptr, 4))))));
+    }
+};
+
+template <>
+struct Loader<uint16_t, double> : LoaderBase<uint16_t>
+{
+    static float64x2_t load(const uint16_t* ptr)
+    {
+        return vcvtq_f64_u64(vmovl_u32(vget_low_u32(vmovl_u16(vcreate_u16(loadBits(ptr, 4))))));
+    }
+};
+
+template <>
+struct Loader<int32_t, double> : LoaderBase<int32_t>
+{
+    static float64x2_t load(const int32_t* ptr) { return vcvtq_f64_s64(vmovl_s32(vld1_s32(ptr))); }
+};
+
+template <>
+struct Loader<uint32_t, double> : LoaderBase<uint32_t>
+{
+    static float64x2_t load(const uint32_t* ptr) { return vcvtq_f64_u64(vmovl_u32(vld1_u32(ptr))); }
+};
+
+template <>
+struct Loader<int64_t, double> : LoaderBase<int64_t>
+{
+    static float64x2_t load(const int64_t* ptr) { return vcvtq_f64_s64(vld1q_s64(ptr)); }
+};
+
+template <>
+struct Loader<uint64_t, double> : LoaderBase<uint64_t>
+{
+    static float64x2_t load(const uint64_t* ptr) { return vcvtq_f64_u64(vld1q_u64(ptr)); }
+};
+
+template <typename T>
+void scaleLinear(const T* input, float* output, size_t count, float scale, float offset)
+{
+    const float32x4_t scaleVec = vdupq_n_f32(scale);
+    const float32x4_t offsetVec = vdupq_n_f32(offset);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(output + i, vfmaq_f32(offsetVec, scaleVec, Loader<T, float>::load(input + i)));
+
+    scaleLinearScalar(input + i, output + i, count - i, scale, offset);
+}
+
+template <typename T>
+void scaleLinear(const T* input, double* output, size_t count, double scale, double offset)
+{
+    const float64x2_t scaleVec = vdupq_n_f64(scale);
+    const float64x2_t offsetVec = vdupq_n_f64(offset);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+        vst1q_f64(output + i, vfmaq_f64(offsetVec, scaleVec, Loader<T, double>::load(input + i)));
+
+    scaleLinearScalar(input + i, output + i, count - i, scale, offset);
+}
+
+template <typename T>
+size_t linearRule(T* output, size_t count, T delta, T offset)
+{
+    static_assert(std::is_integral_v<T>);
+    using Unsigned = std::make_unsigned_t<T>;
+    constexpr size_t lanes = 16 / sizeof(T);
+
+    Unsigned initial[lanes];
+    for (size_t lane = 0; lane < lanes; ++lane)
+        initial[lane] = integerLinearValue(delta, lane, offset);
+
+    const Unsigned laneStep = integerLinearValue(delta, lanes, T{0});
+    auto* out = reinterpret_cast<Unsigned*>(output);
+
+    size_t i = 0;
+    if constexpr (sizeof(T) == 1)
+    {
+        uint8x16_t value = vld1q_u8(initial);
+        const uint8x16_t step = vdupq_n_u8(laneStep);
+        for (; i + lanes <= count; i += lanes, value = vaddq_u8(value, step))
+            vst1q_u8(out + i, value);
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        uint16x8_t value = vld1q_u16(initial);
+        const uint16x8_t step = vdupq_n_u16(laneStep);
+        for (; i + lanes <= count; i += lanes, value = vaddq_u16(value, step))
+            vst1q_u16(out + i, value);
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        uint32x4_t value = vld1q_u32(initial);
+        const uint32x4_t step = vdupq_n_u32(laneStep);
+        for (; i + lanes <= count; i += lanes, value = vaddq_u32(value, step))
+            vst1q_u32(out + i, value);
+    }
+    else
+    {
+        uint64x2_t value = vld1q_u64(initial);
+        const uint64x2_t step = vdupq_n_u64(laneStep);
+        for (; i + lanes <= count; i += lanes, value = vaddq_u64(value, step))
+            vst1q_u64(out + i, value);
+    }
+
+    return i;
+}
+
+}
+
+#endif
+
+/*!
+ * @brief Computes `output[i] = scale * input[i] + offset` for `count` samples.
+ */
+template <typename T, typename U>
+void scaleLinear(const T* input, U* output, size_t count, U scale, U offset)
+{
+#if defined(OPENDAQ_KERNELS_AVX2)
+    if constexpr (avx2::Loader<T, U>::Supported)
+    {
+        if (cpuSupportsAvx2())
+        {
+            avx2::scaleLinear(input, output, count, scale, offset);
+            return;
+        }
+    }
+#elif defined(OPENDAQ_KERNELS_NEON)
+    if constexpr (neon::Loader<T, U>::Supported)
+    {
+        neon::scaleLinear(input, output, count, scale, offset);
+        return;
+    }
+#endif
+
+    scaleLinearScalar(input, output, count, scale, offset);
+}
+
+/*!
+ * @brief Computes `output[i] = delta * i + offset` for `count` samples.
+ */
+template <typename T>
+void linearRule(T* output, size_t count, T delta, T offset)
+{
+    size_t done = 0;
+
+#if defined(OPENDAQ_KERNELS_AVX2)
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        if (cpuSupportsAvx2())
+            done = avx2::linearRule(output, count, delta, offset);
+    }
+#elif defined(OPENDAQ_KERNELS_NEON)
+    // Floating point rules are left to the scalar loop, as the index conversion is not cheaper than the scalar code
+    if constexpr (std::is_integral_v<T>)
+        done = neon::linearRule(output, count, delta, offset);
+#endif
+
+    linearRuleScalar(output, done, count, delta, offset);
+}
+
+}
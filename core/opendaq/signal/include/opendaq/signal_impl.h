@@ -27,7 +27,6 @@
 #include <opendaq/event_packet_utils.h>
 #include <opendaq/input_port_private_ptr.h>
 #include <opendaq/last_value_cache.h>
-#include <opendaq/mem_pool_allocator.h>
 #include <opendaq/packet_factory.h>
 #include <opendaq/signal.h>
 #include <opendaq/signal_config.h>
@@ -35,8 +34,11 @@
 #include <opendaq/signal_errors.h>
 #include <opendaq/signal_events.h>
 #include <opendaq/signal_events_ptr.h>
+#include <opendaq/signal_packet_allocator.h>
+#include <opendaq/allocator_ptr.h>
 #include <opendaq/signal_exceptions.h>
 #include <opendaq/signal_private_ptr.h>
+#include <memory>
 #include <utility>
 
 BEGIN_NAMESPACE_OPENDAQ
@@ -55,15 +57,15 @@ class SignalBase;
 
 using SignalImpl = SignalBase<ISignalConfig>;
 
-using TempConnectionsAllocator = details::MemPoolAllocator<ConnectionPtr>;
-using TempConnectionsMemPool = details::StaticMemPool<ConnectionPtr, 8>;
-using TempConnections = std::vector<ConnectionPtr, TempConnectionsAllocator>;
+// Immutable copy of the signal's connection list. A new snapshot is published whenever a
+// listener connects or disconnects, so senders only copy the pointer while holding the lock.
+using ConnectionsSnapshot = std::shared_ptr<const std::vector<ConnectionPtr>>;
 
 template <typename TInterface, typename... Interfaces>
-class SignalBase : public ComponentImpl<TInterface, ISignalEvents, ISignalPrivate, Interfaces...>
+class SignalBase : public ComponentImpl<TInterface, ISignalEvents, ISignalPrivate, ISignalPacketAllocator, Interfaces...>
 {
 public:
-    using Super = ComponentImpl<TInterface, ISignalEvents, ISignalPrivate, Interfaces...>;
+    using Super = ComponentImpl<TInterface, ISignalEvents, ISignalPrivate, ISignalPacketAllocator, Interfaces...>;
     using Self = SignalBase<TInterface, Interfaces...>;
 
     SignalBase(const ContextPtr& context,
@@ -113,6 +115,10 @@ public:
     ErrCode INTERFACE_FUNC getKeepLastValue(Bool* keepLastValue) override;
     ErrCode INTERFACE_FUNC sendPacketRecursiveLock(IPacket* packet) override;
 
+    // ISignalPacketAllocator
+    ErrCode INTERFACE_FUNC setPacketAllocator(IAllocator* allocator) override;
+    ErrCode INTERFACE_FUNC getPacketAllocator(IAllocator** allocator) override;
+
     // ISerializable
     ErrCode INTERFACE_FUNC getSerializeId(ConstCharPtr* id) const override;
 
@@ -152,11 +158,13 @@ private:
     std::vector<SignalPtr> relatedSignals;
     SignalPtr domainSignal;
     std::vector<ConnectionPtr> connections;
+    ConnectionsSnapshot connectionsSnapshot;
     std::vector<ConnectionPtr> remoteConnections;
     std::vector<WeakRefPtr<ISignalConfig>> domainSignalReferences;
     bool keepLastPacket;
     bool keepLastValue;
     TypeManagerPtr typeManager;
+    AllocatorPtr packetAllocator;
 
     ErrCode listenerConnectedInternal(IConnection* connection, bool schedule);
     ErrCode sendPacketInner(IPacket* packet, bool recursiveLock);
@@ -168,15 +176,15 @@ private:
     void setKeepLastPacket();
     TypePtr addToTypeManagerRecursively(const TypeManagerPtr& typeManager,
                                         const DataDescriptorPtr& descriptor) const;
-    void buildTempConnections(TempConnections& tempConnections);
+    void updateConnectionsSnapshot();
     void checkKeepLastPacket(const PacketPtr& packet);
-    void enqueuePacketToConnections(const PacketPtr& packet, const TempConnections& tempConnections);
-    void enqueuePacketToConnections(PacketPtr&& packet, const TempConnections& tempConnections);
-    void enqueuePacketsToConnections(const ListPtr<IPacket>& packets, const TempConnections& tempConnections);
-    void enqueuePacketsToConnections(ListPtr<IPacket>&& packets, const TempConnections& tempConnections);
+    static void enqueuePacketToConnections(const PacketPtr& packet, const std::vector<ConnectionPtr>& targets);
+    static void enqueuePacketToConnections(PacketPtr&& packet, const std::vector<ConnectionPtr>& targets);
+    static void enqueuePacketsToConnections(const ListPtr<IPacket>& packets, const std::vector<ConnectionPtr>& targets);
+    static void enqueuePacketsToConnections(ListPtr<IPacket>&& packets, const std::vector<ConnectionPtr>& targets);
     
     template <class Packet>
-    bool checkKeepLastPacketAndBuildConnections(Packet&& packet, TempConnections& tempConnections);
+    bool checkKeepLastPacketAndGetConnections(Packet&& packet, ConnectionsSnapshot& snapshot);
     template <class Packet>
     bool keepLastPacketAndEnqueue(Packet&& packet, bool recursiveLock = false);
 
@@ -664,11 +672,12 @@ ErrCode SignalBase<TInterface, Interfaces...>::getConnections(IList** connection
 }
 
 template <typename TInterface, typename... Interfaces>
-void SignalBase<TInterface, Interfaces...>::buildTempConnections(TempConnections& tempConnections)
+void SignalBase<TInterface, Interfaces...>::updateConnectionsSnapshot()
 {
-    tempConnections.reserve(connections.size());
-    for (const auto& connection : connections)
-        tempConnections.push_back(connection);
+    if (connections.empty())
+        connectionsSnapshot.reset();
+    else
+        connectionsSnapshot = std::make_shared<const std::vector<ConnectionPtr>>(connections);
 }
 
 template <typename TInterface, typename... Interfaces>
@@ -685,20 +694,20 @@ void SignalBase<TInterface, Interfaces...>::checkKeepLastPacket(const PacketPtr&
 }
 
 template <typename TInterface, typename... Interfaces>
-void SignalBase<TInterface, Interfaces...>::enqueuePacketToConnections(const PacketPtr& packet, const TempConnections& tempConnections)
+void SignalBase<TInterface, Interfaces...>::enqueuePacketToConnections(const PacketPtr& packet, const std::vector<ConnectionPtr>& targets)
 {
-    for (const auto& connection : tempConnections)
+    for (const auto& connection : targets)
         connection.enqueue(packet);
 }
 
 template <typename TInterface, typename... Interfaces>
-void SignalBase<TInterface, Interfaces...>::enqueuePacketToConnections(PacketPtr&& packet, const TempConnections& tempConnections)
+void SignalBase<TInterface, Interfaces...>::enqueuePacketToConnections(PacketPtr&& packet, const std::vector<ConnectionPtr>& targets)
 {
-    if (tempConnections.empty())
+    if (targets.empty())
         return;
 
-    auto startIt = tempConnections.begin();
-    const auto endIt = std::prev(tempConnections.end());
+    auto startIt = targets.begin();
+    const auto endIt = std::prev(targets.end());
 
     while (startIt != endIt)
         startIt++->enqueue(packet);
@@ -709,22 +718,22 @@ void SignalBase<TInterface, Interfaces...>::enqueuePacketToConnections(PacketPtr
 template <typename TInterface, typename... Interfaces>
 void SignalBase<TInterface, Interfaces...>::enqueuePacketsToConnections(
     const ListPtr<IPacket>& packets,
-    const TempConnections& tempConnections)
+    const std::vector<ConnectionPtr>& targets)
 {
-    for (const auto& connection : tempConnections)
+    for (const auto& connection : targets)
         connection.enqueueMultiple(packets);
 }
 
 template <typename TInterface, typename... Interfaces>
 void SignalBase<TInterface, Interfaces...>::enqueuePacketsToConnections(
     ListPtr<IPacket>&& packets,
-    const TempConnections& tempConnections)
+    const std::vector<ConnectionPtr>& targets)
 {
-    if (tempConnections.empty())
+    if (targets.empty())
         return;
 
-    auto startIt = tempConnections.begin();
-    const auto endIt = std::prev(tempConnections.end());
+    auto startIt = targets.begin();
+    const auto endIt = std::prev(targets.end());
 
     while (startIt != endIt)
         startIt++->enqueueMultiple(packets);
@@ -734,13 +743,13 @@ void SignalBase<TInterface, Interfaces...>::enqueuePacketsToConnections(
 
 template <typename TInterface, typename ... Interfaces>
 template <class Packet>
-bool SignalBase<TInterface, Interfaces...>::checkKeepLastPacketAndBuildConnections(Packet&& packet, TempConnections& tempConnections)
+bool SignalBase<TInterface, Interfaces...>::checkKeepLastPacketAndGetConnections(Packet&& packet, ConnectionsSnapshot& snapshot)
 {
     if (!this->active)
         return false;
 
     checkKeepLastPacket(packet);
-    buildTempConnections(tempConnections);
+    snapshot = connectionsSnapshot;
     return true;
 }
 
@@ -748,23 +757,24 @@ template <typename TInterface, typename... Interfaces>
 template <class Packet>
 bool SignalBase<TInterface, Interfaces...>::keepLastPacketAndEnqueue(Packet&& packet, bool recursiveLock)
 {
-    TempConnectionsMemPool memPool;
-    TempConnections tempConnections{TempConnectionsAllocator(memPool)};
+    // Only the snapshot pointer is copied under the lock; the per-connection work happens outside of it
+    ConnectionsSnapshot snapshot;
 
     if (!recursiveLock)
     {
         auto lock = this->getAcquisitionLock2();
-        if (!checkKeepLastPacketAndBuildConnections(packet, tempConnections))
+        if (!checkKeepLastPacketAndGetConnections(packet, snapshot))
             return false;
     }
     else
     {
         auto lock = this->getRecursiveConfigLock2();
-        if (!checkKeepLastPacketAndBuildConnections(packet, tempConnections))
+        if (!checkKeepLastPacketAndGetConnections(packet, snapshot))
             return false;
     }
 
-    enqueuePacketToConnections(std::forward<Packet>(packet), tempConnections);
+    if (snapshot)
+        enqueuePacketToConnections(std::forward<Packet>(packet), *snapshot);
 
     return true;
 }
@@ -773,8 +783,7 @@ template <typename TInterface, typename... Interfaces>
 template <class ListOfPackets>
 bool SignalBase<TInterface, Interfaces...>::keepLastPacketAndEnqueueMultiple(ListOfPackets&& packets)
 {
-    TempConnectionsMemPool memPool;
-    TempConnections tempConnections{TempConnectionsAllocator(memPool)};
+    ConnectionsSnapshot snapshot;
 
     {
         size_t cnt = packets.getCount();
@@ -785,10 +794,11 @@ bool SignalBase<TInterface, Interfaces...>::keepLastPacketAndEnqueueMultiple(Lis
             return false;
 
         checkKeepLastPacket(packets[cnt - 1]);
-        buildTempConnections(tempConnections);
+        snapshot = connectionsSnapshot;
     }
 
-    enqueuePacketsToConnections(std::forward<ListOfPackets>(packets), tempConnections);
+    if (snapshot)
+        enqueuePacketsToConnections(std::forward<ListOfPackets>(packets), *snapshot);
 
     return true;
 }
@@ -894,6 +904,7 @@ ErrCode SignalBase<TInterface, Interfaces...>::listenerConnectedInternal(IConnec
     }
 
     connections.push_back(connectionPtr);
+    updateConnectionsSnapshot();
 
     if (!schedule)
         connectionPtr.enqueueOnThisThread(packet);
@@ -1016,6 +1027,7 @@ ErrCode SignalBase<TInterface, Interfaces...>::listenerDisconnected(IConnection*
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOTFOUND);
 
     connections.erase(it);
+    updateConnectionsSnapshot();
 
     if (connections.empty())
     {
@@ -1190,6 +1202,7 @@ template <typename TInterface, typename... Interfaces>
 void SignalBase<TInterface, Interfaces...>::removed()
 {
     clearConnections(connections);
+    updateConnectionsSnapshot();
     clearConnections(remoteConnections);
 
     for (auto it = begin(domainSignalReferences); it != end(domainSignalReferences); ++it)
@@ -1329,6 +1342,26 @@ ErrCode SignalBase<TInterface, Interfaces...>::sendPacketRecursiveLock(IPacket*
     return sendPacketInner(packet, true);
 }
 
+template <typename TInterface, typename ... Interfaces>
+ErrCode SignalBase<TInterface, Interfaces...>::setPacketAllocator(IAllocator* allocator)
+{
+    auto lock = this->getRecursiveConfigLock2();
+
+    this->packetAllocator = allocator;
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename TInterface, typename ... Interfaces>
+ErrCode SignalBase<TInterface, Interfaces...>::getPacketAllocator(IAllocator** allocator)
+{
+    OPENDAQ_PARAM_NOT_NULL(allocator);
+
+    auto lock = this->getRecursiveConfigLock2();
+
+    *allocator = this->packetAllocator.addRefAndReturn();
+    return OPENDAQ_SUCCESS;
+}
+
 template <typename TInterface, typename... Interfaces>
 void SignalBase<TInterface, Interfaces...>::visibleChanged()
 {
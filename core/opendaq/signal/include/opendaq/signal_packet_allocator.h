@@ -0,0 +1,52 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/allocator.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_signals
+ * @addtogroup opendaq_signal Signal
+ * @{
+ */
+
+/*!
+ * @brief Allows the owner of a signal to attach an allocator to it. The memory of data packets created
+ * for the signal with the `DataPacketForSignal` factory is allocated by the attached allocator.
+ *
+ * Devices and function blocks can attach a pool allocator once, instead of passing it to every created packet.
+ */
+DECLARE_OPENDAQ_INTERFACE(ISignalPacketAllocator, IBaseObject)
+{
+    // [templateType(allocator, IAllocator)]
+    /*!
+     * @brief Sets the allocator of the data packets of the signal.
+     * @param allocator The allocator. If null, packets are allocated by the default allocator.
+     */
+    virtual ErrCode INTERFACE_FUNC setPacketAllocator(IAllocator* allocator) = 0;
+
+    // [templateType(allocator, IAllocator)]
+    /*!
+     * @brief Gets the allocator of the data packets of the signal.
+     * @param[out] allocator The allocator, or null if none is set.
+     */
+    virtual ErrCode INTERFACE_FUNC getPacketAllocator(IAllocator** allocator) = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
@@ -1,6 +1,7 @@
 #include <coretypes/validation.h>
 #include <opendaq/connection_impl.h>
 #include <opendaq/data_packet_ptr.h>
+#include <opendaq/data_packet_private.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/event_packet_ptr.h>
 #include <opendaq/event_packet_params.h>
@@ -17,12 +18,18 @@ ConnectionImpl::ConnectionImpl(const InputPortPtr& port, const SignalPtr& signal
     , signalRef(signal)
     , context(std::move(context))
     , queueEmpty(true)
+    , queueMode(PacketQueueMode::Locked)
     , loggerComponent(this->context.getLogger().getOrAddComponent("daq_connection"))
+    , overflowPending(false)
+    , ringAccountedPosition(0)
+    , overflowAccountedCount(0)
+    , gapPacketsGenerated(false)
 {
     const auto portConfig = port.asPtrOrNull<IInputPortConfig>(true);
     if (portConfig.assigned() && portConfig.getGapCheckingEnabled())
     {
         gapCheckState = GapCheckState::uninitialized;
+        gapPacketsGenerated = true;
         LOGP_D("Gap checking enabled.")
     }
     else
@@ -30,6 +37,60 @@ ConnectionImpl::ConnectionImpl(const InputPortPtr& port, const SignalPtr& signal
         gapCheckState = GapCheckState::disabled;
         LOGP_T("Gap checking disabled.")
     }
+
+    if (portConfig.assigned())
+        queueMode = portConfig.getPacketQueueMode();
+
+    if (queueMode != PacketQueueMode::Locked)
+    {
+        ringBuffer = std::make_unique<PacketRingBuffer>(LockFreeQueueCapacity);
+        LOGP_D("Lock-free packet queue enabled.")
+    }
+}
+
+template <typename Func>
+auto ConnectionImpl::withConsumerLock(Func&& func)
+{
+    if (ringBuffer)
+    {
+        std::lock_guard guard(consumerMutex);
+        accountPublishedLockFree();
+        return func();
+    }
+
+    return withLock(std::forward<Func>(func));
+}
+
+template <class F>
+bool ConnectionImpl::enqueueLockFree(const F& pushPackets)
+{
+    std::unique_lock<std::mutex> producerLock;
+    if (queueMode == PacketQueueMode::LockFreeMultiProducer)
+        producerLock = std::unique_lock<std::mutex>(producerMutex);
+
+    pushPackets();
+
+    // pairs with the fence in popLockFree; either the consumer sees the new packet,
+    // or the producer sees the empty flag and notifies the port
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return queueEmpty.exchange(false);
+}
+
+void ConnectionImpl::pushLockFree(PacketPtr&& packet)
+{
+    // while the overflow queue holds packets, new packets must be placed behind them
+    if (!overflowPending.load(std::memory_order_acquire))
+    {
+        IPacket* rawPacket = packet.detach();
+        if (ringBuffer->tryPush(rawPacket))
+            return;
+
+        packet = PacketPtr::Adopt(rawPacket);
+    }
+
+    std::lock_guard guard(overflowMutex);
+    overflow.push_back(std::move(packet));
+    overflowPending.store(true, std::memory_order_release);
 }
 
 template <class P, class F>
@@ -47,18 +108,43 @@ ErrCode ConnectionImpl::enqueueInternal(P&& packet, const F& f)
 
         bool queueWasEmpty;
 
-        withLock(
-            [&packet, &queueWasEmpty, this]()
-            {
-                queueWasEmpty = queueEmpty;
-                if (gapCheckState != GapCheckState::disabled)
-                    checkForGaps(packet);
+        if (ringBuffer)
+        {
+            queueWasEmpty = enqueueLockFree(
+                [&packet, this]()
+                {
+                    if (gapCheckState != GapCheckState::disabled)
+                    {
+                        if (auto gapPacket = checkForGaps(packet); gapPacket.assigned())
+                            pushLockFree(std::move(gapPacket));
+                    }
 
-                onPacketEnqueued(packet);
-                packets.emplace_back(std::forward<P>(packet));
-                queueEmpty = false;
-                LOGP_T("Packet enqueued.")
-            });
+                    pushLockFree(PacketPtr(std::forward<P>(packet)));
+                });
+            LOGP_T("Packet enqueued.")
+        }
+        else
+        {
+            withLock(
+                [&packet, &queueWasEmpty, this]()
+                {
+                    queueWasEmpty = queueEmpty;
+                    if (gapCheckState != GapCheckState::disabled)
+                    {
+                        if (auto gapPacket = checkForGaps(packet); gapPacket.assigned())
+                        {
+                            gapPacketsCnt += 1;
+                            packets.emplace_back(std::move(gapPacket));
+                            LOGP_T("Gap packet enqueued.")
+                        }
+                    }
+
+                    onPacketEnqueued(packet);
+                    packets.emplace_back(std::forward<P>(packet));
+                    queueEmpty = false;
+                    LOGP_T("Packet enqueued.")
+                });
+        }
 
         f(queueWasEmpty);
         return OPENDAQ_SUCCESS;
@@ -105,18 +191,30 @@ ErrCode ConnectionImpl::enqueueMultipleInternal(const ListPtr<IPacket>& packets)
 
         bool queueWasEmpty;
 
-        withLock([&packets, &queueWasEmpty, this]()
+        if (ringBuffer)
         {
-            queueWasEmpty = queueEmpty;
-            const size_t cnt = packets.getCount();
-            for (size_t i = 0; i < cnt; ++i)
+            queueWasEmpty = enqueueLockFree([&packets, this]()
             {
-                auto packet = packets.getItemAt(i);
-                onPacketEnqueued(packet);
-                this->packets.push_back(packet);
-            }
-            queueEmpty = false;
-        });
+                const size_t cnt = packets.getCount();
+                for (size_t i = 0; i < cnt; ++i)
+                    pushLockFree(packets.getItemAt(i));
+            });
+        }
+        else
+        {
+            withLock([&packets, &queueWasEmpty, this]()
+            {
+                queueWasEmpty = queueEmpty;
+                const size_t cnt = packets.getCount();
+                for (size_t i = 0; i < cnt; ++i)
+                {
+                    auto packet = packets.getItemAt(i);
+                    onPacketEnqueued(packet);
+                    this->packets.push_back(packet);
+                }
+                queueEmpty = false;
+            });
+        }
 
         port.notifyPacketEnqueued(queueWasEmpty);
         return OPENDAQ_SUCCESS;
@@ -134,17 +232,29 @@ ErrCode ConnectionImpl::enqueueMultipleInternal(ListPtr<IPacket>&& packets)
 
         bool queueWasEmpty;
 
-        withLock([&packets, &queueWasEmpty, this]() {
-            queueWasEmpty = queueEmpty;
-            const size_t cnt = packets.getCount();
-            for (size_t i = 0; i < cnt; ++i)
+        if (ringBuffer)
+        {
+            queueWasEmpty = enqueueLockFree([&packets, this]()
             {
-                auto packet = packets.popFront();
-                onPacketEnqueued(packet);
-                this->packets.push_back(packet);
-            }
-            queueEmpty = false;
-        });
+                const size_t cnt = packets.getCount();
+                for (size_t i = 0; i < cnt; ++i)
+                    pushLockFree(packets.popFront());
+            });
+        }
+        else
+        {
+            withLock([&packets, &queueWasEmpty, this]() {
+                queueWasEmpty = queueEmpty;
+                const size_t cnt = packets.getCount();
+                for (size_t i = 0; i < cnt; ++i)
+                {
+                    auto packet = packets.popFront();
+                    onPacketEnqueued(packet);
+                    this->packets.push_back(packet);
+                }
+                queueEmpty = false;
+            });
+        }
 
         port.notifyPacketEnqueued(queueWasEmpty);
         return OPENDAQ_SUCCESS;
@@ -165,27 +275,45 @@ ErrCode ConnectionImpl::enqueueMultipleInternal(P&& packets)
 
         bool queueWasEmpty;
 
-        withLock(
-            [&packets, &queueWasEmpty, this]()
-            {
-                queueWasEmpty = queueEmpty;
-                const size_t cnt = packets.getCount();
-                for (size_t i = 0; i < cnt; ++i)
+        if (ringBuffer)
+        {
+            queueWasEmpty = enqueueLockFree(
+                [&packets, this]()
                 {
-                    PacketPtr packet;
-                    if constexpr (std::is_rvalue_reference_v<P&&>)
+                    const size_t cnt = packets.getCount();
+                    for (size_t i = 0; i < cnt; ++i)
                     {
-                        packet = packets.popFront();
+                        if constexpr (std::is_rvalue_reference_v<P&&>)
+                            pushLockFree(packets.popFront());
+                        else
+                            pushLockFree(packets.getItemAt(i));
                     }
-                    else
+                });
+        }
+        else
+        {
+            withLock(
+                [&packets, &queueWasEmpty, this]()
+                {
+                    queueWasEmpty = queueEmpty;
+                    const size_t cnt = packets.getCount();
+                    for (size_t i = 0; i < cnt; ++i)
                     {
-                        packet = packets.getItemAt(i);
+                        PacketPtr packet;
+                        if constexpr (std::is_rvalue_reference_v<P&&>)
+                        {
+                            packet = packets.popFront();
+                        }
+                        else
+                        {
+                            packet = packets.getItemAt(i);
+                        }
+                        onPacketEnqueued(packet);
+                        this->packets.push_back(packet);
                     }
-                    onPacketEnqueued(packet);
-                    this->packets.push_back(packet);
-                }
-                queueEmpty = false;
-            });
+                    queueEmpty = false;
+                });
+        }
 
         port.notifyPacketEnqueued(queueWasEmpty);
         return OPENDAQ_SUCCESS;
@@ -227,6 +355,26 @@ ErrCode ConnectionImpl::dequeue(IPacket** packet)
 {
     OPENDAQ_PARAM_NOT_NULL(packet);
 
+    if (ringBuffer)
+    {
+        return withConsumerLock([&packet, this]()
+        {
+            PacketPtr packetPtr;
+            if (!popLockFree(packetPtr))
+            {
+                LOGP_T("No packet to dequeue.")
+                *packet = nullptr;
+                return OPENDAQ_NO_MORE_ITEMS;
+            }
+
+            onPacketDequeued(packetPtr);
+            *packet = packetPtr.detach();
+            LOGP_T("Packet dequeued.")
+
+            return OPENDAQ_SUCCESS;
+        });
+    }
+
     return withLock([&packet, this]()
     {
         if (packets.empty())
@@ -252,6 +400,24 @@ ErrCode INTERFACE_FUNC ConnectionImpl::dequeueAll(IList** packets)
 
     auto packetsPtr = List<IPacket>();
 
+    if (ringBuffer)
+    {
+        return withConsumerLock(
+            [&packetsPtr, packets, this]()
+            {
+                PacketPtr packet;
+                while (popLockFree(packet))
+                    packetsPtr.pushBack(std::move(packet));
+
+                samplesCnt = 0;
+                eventPacketsCnt = 0;
+                gapPacketsCnt = 0;
+
+                *packets = packetsPtr.detach();
+                return OPENDAQ_NO_MORE_ITEMS;
+            });
+    }
+
     return withLock(
         [&packetsPtr, packets, this]()
         {
@@ -272,6 +438,25 @@ ErrCode ConnectionImpl::peek(IPacket** packet)
 {
     OPENDAQ_PARAM_NOT_NULL(packet);
 
+    if (ringBuffer)
+    {
+        return withConsumerLock([&packet, this]()
+        {
+            IPacket* front = frontLockFree();
+            if (front == nullptr)
+            {
+                LOGP_T("No packet to peek.")
+                *packet = nullptr;
+                return OPENDAQ_NO_MORE_ITEMS;
+            }
+
+            front->addRef();
+            *packet = front;
+            LOGP_T("Packet peeked.")
+            return OPENDAQ_SUCCESS;
+        });
+    }
+
     return withLock([&packet, this]()
     {
         if (packets.empty())
@@ -291,9 +476,9 @@ ErrCode ConnectionImpl::getPacketCount(SizeT* packetCount)
 {
     OPENDAQ_PARAM_NOT_NULL(packetCount);
 
-    return withLock([&packetCount, this]()
+    return withConsumerLock([&packetCount, this]()
     {
-        *packetCount = packets.size();
+        *packetCount = ringBuffer ? getPacketCountLockFree() : packets.size();
         LOG_T("Packet count = {}.", *packetCount)
         return OPENDAQ_SUCCESS;
     });
@@ -303,7 +488,7 @@ ErrCode ConnectionImpl::getAvailableSamples(SizeT* samples)
 {
     OPENDAQ_PARAM_NOT_NULL(samples);
 
-    return withLock([samples, this]()
+    return withConsumerLock([samples, this]()
     {
         *samples = samplesCnt;
 
@@ -316,7 +501,7 @@ ErrCode ConnectionImpl::getSamplesUntilNextEventPacket(SizeT* samples)
 {
     OPENDAQ_PARAM_NOT_NULL(samples);
 
-    return withLock([samples, this]() {
+    return withConsumerLock([samples, this]() {
         if (eventPacketsCnt == 0 && gapPacketsCnt == 0)
         {
             *samples = samplesCnt;
@@ -324,7 +509,7 @@ ErrCode ConnectionImpl::getSamplesUntilNextEventPacket(SizeT* samples)
             return OPENDAQ_SUCCESS;
         }
         *samples = 0;
-        for (const auto& packet : packets)
+        forEachQueued([samples](const PacketPtr& packet)
         {
             switch (packet.getType())
             {
@@ -338,14 +523,12 @@ ErrCode ConnectionImpl::getSamplesUntilNextEventPacket(SizeT* samples)
                     break;
                 }
                 case PacketType::Event:
-                {
-                    LOG_T("Samples until next event packet = {}.", *samples)
-                    return OPENDAQ_SUCCESS;
-                }
+                    return false;
                 case PacketType::None:
                     break;
             }
-        }
+            return true;
+        });
 
         LOG_T("Samples until next event packet = {}.", *samples)
         return OPENDAQ_SUCCESS;
@@ -356,7 +539,7 @@ ErrCode ConnectionImpl::getSamplesUntilNextDescriptor(SizeT* samples)
 {
     OPENDAQ_PARAM_NOT_NULL(samples);
 
-    return withLock([samples, this]() {
+    return withConsumerLock([samples, this]() {
         if (eventPacketsCnt == 0)
         {
             *samples = samplesCnt;
@@ -364,7 +547,7 @@ ErrCode ConnectionImpl::getSamplesUntilNextDescriptor(SizeT* samples)
             return OPENDAQ_SUCCESS;
         }
         *samples = 0;
-        for (const auto& packet : packets)
+        forEachQueued([samples](const PacketPtr& packet)
         {
             switch (packet.getType())
             {
@@ -381,16 +564,14 @@ ErrCode ConnectionImpl::getSamplesUntilNextDescriptor(SizeT* samples)
                 {
                     auto eventPacket = packet.template asPtrOrNull<IEventPacket>(true);
                     if (eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
-                    {
-                        LOG_T("Samples until next descriptor = {}.", *samples)
-                        return OPENDAQ_SUCCESS;
-                    }
+                        return false;
                     break;
                 }
                 case PacketType::None:
                     break;
             }
-        }
+            return true;
+        });
 
         LOG_T("Samples until next descriptor = {}.", *samples)
         return OPENDAQ_SUCCESS;
@@ -401,7 +582,7 @@ ErrCode ConnectionImpl::getSamplesUntilNextGapPacket(SizeT* samples)
 {
         OPENDAQ_PARAM_NOT_NULL(samples);
 
-    return withLock([samples, this]() {
+    return withConsumerLock([samples, this]() {
         if (gapPacketsCnt == 0)
         {
             *samples = samplesCnt;
@@ -409,7 +590,7 @@ ErrCode ConnectionImpl::getSamplesUntilNextGapPacket(SizeT* samples)
             return OPENDAQ_SUCCESS;
         }
         *samples = 0;
-        for (const auto& packet : packets)
+        forEachQueued([samples](const PacketPtr& packet)
         {
             switch (packet.getType())
             {
@@ -426,16 +607,14 @@ ErrCode ConnectionImpl::getSamplesUntilNextGapPacket(SizeT* samples)
                 {
                     auto eventPacket = packet.template asPtr<IEventPacket>(true);
                     if (eventPacket.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED)
-                    {
-                        LOG_T("Samples until next gap packet = {}.", *samples)
-                        return OPENDAQ_SUCCESS;
-                    }
+                        return false;
                     break;
                 }
                 case PacketType::None:
                     break;
             }
-        }
+            return true;
+        });
 
         LOG_T("Samples until next gap packet = {}.", *samples)
         return OPENDAQ_SUCCESS;
@@ -446,7 +625,7 @@ ErrCode ConnectionImpl::hasEventPacket(Bool* hasEventPacket)
 {
     OPENDAQ_PARAM_NOT_NULL(hasEventPacket);
 
-    return withLock([hasEventPacket, this]()
+    return withConsumerLock([hasEventPacket, this]()
     {
         *hasEventPacket = eventPacketsCnt != 0 || gapPacketsCnt != 0;
         LOG_T("Has event packet = {}.", *hasEventPacket)
@@ -458,7 +637,7 @@ ErrCode ConnectionImpl::hasGapPacket(Bool* hasGapPacket)
 {
     OPENDAQ_PARAM_NOT_NULL(hasGapPacket);
 
-    return withLock([hasGapPacket, this]()
+    return withConsumerLock([hasGapPacket, this]()
     {
         *hasGapPacket = gapPacketsCnt != 0;
         LOG_T("Has gap packet = {}.", *hasGapPacket)
@@ -504,6 +683,29 @@ ErrCode ConnectionImpl::dequeueUpTo(IPacket** packetPtr, SizeT* count)
     OPENDAQ_PARAM_NOT_NULL(packetPtr);
     OPENDAQ_PARAM_NOT_NULL(count);
 
+    if (ringBuffer)
+    {
+        return withConsumerLock(
+            [&packetPtr, &count, this]()
+            {
+                auto ptr = packetPtr;
+                const SizeT requested = *count;
+                SizeT dequeued = 0;
+
+                PacketPtr packet;
+                while (dequeued < requested && popLockFree(packet))
+                {
+                    onPacketDequeued(packet);
+                    *ptr = packet.detach();
+                    ptr++;
+                    dequeued++;
+                }
+
+                *count = dequeued;
+                return OPENDAQ_SUCCESS;
+            });
+    }
+
     return withLock(
         [&packetPtr, &count, this]()
         {
@@ -526,10 +728,12 @@ const std::deque<PacketPtr>& ConnectionImpl::getPackets() const noexcept
     return packets;
 }
 
-void ConnectionImpl::checkForGaps(const PacketPtr& packet)
+PacketPtr ConnectionImpl::checkForGaps(const PacketPtr& packet)
 {
     assert(gapCheckState != GapCheckState::disabled);
 
+    PacketPtr gapPacket;
+
     switch (packet.getType())
     {
         case PacketType::Data:
@@ -549,7 +753,7 @@ void ConnectionImpl::checkForGaps(const PacketPtr& packet)
                 {
                     DomainValue diff;
                     if (doGapCheck(domainPacket, diff))
-                        enqueueGapPacket(diff);
+                        gapPacket = createGapPacket(diff);
                 }
             }
 
@@ -561,9 +765,11 @@ void ConnectionImpl::checkForGaps(const PacketPtr& packet)
         default:
             break;
     }
+
+    return gapPacket;
 }
 
-void ConnectionImpl::enqueueGapPacket(const DomainValue& diff)
+PacketPtr ConnectionImpl::createGapPacket(const DomainValue& diff)
 {
     NumberPtr diffNumber;
     if (domainSampleType == SampleType::Float64)
@@ -571,15 +777,12 @@ void ConnectionImpl::enqueueGapPacket(const DomainValue& diff)
     else
         diffNumber = diff.valueInt64_t;
 
-    const auto gapPacket = ImplicitDomainGapDetectedEventPacket(diffNumber);
-    gapPacketsCnt += 1;
-    packets.emplace_back(gapPacket);
-    LOGP_T("Gap packet enqueued.")
+    return ImplicitDomainGapDetectedEventPacket(diffNumber);
 }
 
 void ConnectionImpl::beginGapCheck(const DataPacketPtr& domainPacket)
 {
-    nextExpectedPacketOffset = numberToDomainValue(domainPacket.getOffset());
+    nextExpectedPacketOffset = packetOffsetToDomainValue(domainPacket);
     if (domainSampleType == SampleType::Float64)
         nextExpectedPacketOffset.valueDouble += static_cast<double>(domainPacket.getSampleCount()) * delta.valueDouble;
     else
@@ -591,7 +794,7 @@ void ConnectionImpl::beginGapCheck(const DataPacketPtr& domainPacket)
 
 bool ConnectionImpl::doGapCheck(const DataPacketPtr& domainPacket, DomainValue& diff)
 {
-    const auto currPacketOffset = numberToDomainValue(domainPacket.getOffset());
+    const auto currPacketOffset = packetOffsetToDomainValue(domainPacket);
     bool gapDetected;
 
     if (domainSampleType == SampleType::Float64)
@@ -763,7 +966,7 @@ void ConnectionImpl::onPacketDequeued(const PacketPtr& packet)
 
 ErrCode ConnectionImpl::enqueueLastDescriptor()
 {
-    return withLock([this]
+    return withConsumerLock([this]
     {
         if (valueDataDescriptor.assigned() || domainDataDescriptor.assigned())
         {
@@ -775,21 +978,162 @@ ErrCode ConnectionImpl::enqueueLastDescriptor()
     });
 }
 
-ConnectionImpl::DomainValue ConnectionImpl::numberToDomainValue(const NumberPtr& number)
+void ConnectionImpl::accountPublishedLockFree()
+{
+    const SizeT writePosition = ringBuffer->writePosition();
+    for (; ringAccountedPosition != writePosition; ++ringAccountedPosition)
+    {
+        IPacket* packet = ringBuffer->at(ringAccountedPosition);
+        accountEnqueuedLockFree(PacketPtr::Borrow(packet));
+    }
+
+    if (overflowPending.load(std::memory_order_acquire))
+    {
+        std::lock_guard guard(overflowMutex);
+        for (; overflowAccountedCount < overflow.size(); ++overflowAccountedCount)
+            accountEnqueuedLockFree(overflow[overflowAccountedCount]);
+    }
+}
+
+void ConnectionImpl::accountEnqueuedLockFree(const PacketPtr& packet)
+{
+    // gap packets are created by the producer, but counted on the consumer side like any other packet.
+    // As in the locked mode, gap packets only count as such when gap checking generates them.
+    if (gapPacketsGenerated && packet.getType() == PacketType::Event &&
+        packet.asPtr<IEventPacket>(true).getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED)
+    {
+        gapPacketsCnt += 1;
+        return;
+    }
+
+    onPacketEnqueued(packet);
+}
+
+bool ConnectionImpl::moveOverflowLockFree()
+{
+    if (!overflowPending.load(std::memory_order_acquire))
+        return false;
+
+    std::lock_guard guard(overflowMutex);
+
+    // packets still in the ring were enqueued before the overflowed ones
+    if (ringBuffer->readPosition() != ringBuffer->writePosition())
+        return false;
+
+    for (; overflowAccountedCount < overflow.size(); ++overflowAccountedCount)
+        accountEnqueuedLockFree(overflow[overflowAccountedCount]);
+
+    for (auto& packet : overflow)
+        packets.push_back(std::move(packet));
+
+    overflow.clear();
+    overflowAccountedCount = 0;
+    overflowPending.store(false, std::memory_order_release);
+    return true;
+}
+
+bool ConnectionImpl::popLockFree(PacketPtr& packet)
+{
+    bool emptyMarked = false;
+    while (true)
+    {
+        if (!packets.empty())
+        {
+            packet = std::move(packets.front());
+            packets.pop_front();
+            return true;
+        }
+
+        if (ringBuffer->readPosition() != ringAccountedPosition)
+        {
+            packet = PacketPtr::Adopt(ringBuffer->tryPop());
+            return true;
+        }
+
+        if (moveOverflowLockFree())
+            continue;
+
+        if (emptyMarked)
+            return false;
+
+        // mark the queue as empty before checking it once more, so that a concurrently
+        // enqueued packet is either dequeued here or reported as enqueued into an empty queue
+        queueEmpty.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        accountPublishedLockFree();
+        emptyMarked = true;
+    }
+}
+
+IPacket* ConnectionImpl::frontLockFree()
 {
+    if (packets.empty() && ringBuffer->readPosition() == ringAccountedPosition)
+        moveOverflowLockFree();
+
+    if (!packets.empty())
+        return packets.front().getObject();
+
+    if (ringBuffer->readPosition() != ringAccountedPosition)
+        return ringBuffer->at(ringBuffer->readPosition());
+
+    return nullptr;
+}
+
+SizeT ConnectionImpl::getPacketCountLockFree() const
+{
+    return packets.size() + (ringAccountedPosition - ringBuffer->readPosition()) + overflowAccountedCount;
+}
+
+template <class F>
+void ConnectionImpl::forEachQueued(F&& f)
+{
+    for (const auto& packet : packets)
+    {
+        if (!f(packet))
+            return;
+    }
+
+    if (!ringBuffer)
+        return;
+
+    for (SizeT pos = ringBuffer->readPosition(); pos != ringAccountedPosition; ++pos)
+    {
+        IPacket* packet = ringBuffer->at(pos);
+        if (!f(PacketPtr::Borrow(packet)))
+            return;
+    }
+
+    if (overflowAccountedCount != 0)
+    {
+        std::lock_guard guard(overflowMutex);
+        for (SizeT i = 0; i < overflowAccountedCount; ++i)
+        {
+            if (!f(overflow[i]))
+                return;
+        }
+    }
+}
+
+ConnectionImpl::DomainValue ConnectionImpl::packetOffsetToDomainValue(const DataPacketPtr& packet)
+{
+    // Reads the inline offset of the packet, so no Number object is created per packet
     DomainValue dv;
+    bool hasOffset;
     switch (domainSampleType)
     {
         case SampleType::Int64:
         case SampleType::UInt64:
-            dv.valueInt64_t = number;
+            hasOffset = getDataPacketIntOffset(packet, dv.valueInt64_t);
             break;
         case SampleType::Float64:
-            dv.valueDouble = number;
+            hasOffset = getDataPacketFloatOffset(packet, dv.valueDouble);
             break;
         default:
             DAQ_THROW_EXCEPTION(InvalidParameterException, "Cannot convert number.");
     }
+
+    if (!hasOffset)
+        DAQ_THROW_EXCEPTION(InvalidParameterException, "Domain packet has no offset.");
     return dv;
 }
 
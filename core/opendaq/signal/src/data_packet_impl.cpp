@@ -1,8 +1,130 @@
 #include <opendaq/data_packet_impl.h>
 #include <coretypes/impl.h>
+#include <coretypes/object_pool.h>
+#include <coretypes/pooled_object.h>
+#include <atomic>
 
 BEGIN_NAMESPACE_OPENDAQ
 
+#ifdef OPENDAQ_ENABLE_OBJECT_POOLS
+
+using namespace object_pool;
+
+class PooledDataPacketImpl : public PooledObject<PooledDataPacketImpl, DataPacketImpl<IDataPacket>>
+{
+public:
+    using PooledObject<PooledDataPacketImpl, DataPacketImpl<IDataPacket>>::PooledObject;
+
+    ~PooledDataPacketImpl() override
+    {
+        unparkMemory();
+    }
+
+    void reset()
+    {
+        unparkMemory();
+        this->markLive();
+    }
+
+    void init(IDataPacket* domainPacket, IDataDescriptor* descriptor, SizeT sampleCount, INumber* offset, const Int* intOffset)
+    {
+        this->initPooled(domainPacket, descriptor, sampleCount, offset, intOffset);
+    }
+
+    void park()
+    {
+        this->releasePooled();
+
+        // Large buffers are not kept around while the packet waits in the pool, nor are any buffers
+        // once the parked packets of all pools hold MaxParkedMemoryTotal bytes
+        const size_t memory = static_cast<size_t>(this->memorySize) + this->scaledDataCapacity;
+        if (this->memorySize > MaxParkedMemorySize || !tryParkMemory(memory))
+        {
+            this->freeMemory();
+            this->data = nullptr;
+            this->scaledData = nullptr;
+            this->memorySize = 0;
+            this->scaledDataCapacity = 0;
+        }
+    }
+
+private:
+    static constexpr uint32_t MaxParkedMemorySize = 64 * 1024;
+    static constexpr size_t MaxParkedMemoryTotal = 16 * 1024 * 1024;
+
+    inline static std::atomic<size_t> parkedMemoryTotal{0};
+    size_t parkedMemory = 0;
+
+    bool tryParkMemory(size_t memory)
+    {
+        size_t total = parkedMemoryTotal.load(std::memory_order_relaxed);
+        do
+        {
+            if (total + memory > MaxParkedMemoryTotal)
+                return false;
+        }
+        while (!parkedMemoryTotal.compare_exchange_weak(total, total + memory, std::memory_order_relaxed));
+
+        parkedMemory = memory;
+        return true;
+    }
+
+    void unparkMemory()
+    {
+        parkedMemoryTotal.fetch_sub(parkedMemory, std::memory_order_relaxed);
+        parkedMemory = 0;
+    }
+};
+
+// At most MaxParkedPacketCount packets wait in the pool, packets released beyond that are destroyed
+static constexpr size_t MaxParkedPacketCount = 4096;
+
+// Packets can outlive static destruction (e.g. when held by other static objects), so the pool is never destroyed
+static ObjectPool<PooledDataPacketImpl>& getDataPacketPool()
+{
+    static auto* pool = new ObjectPool<PooledDataPacketImpl>(0, MaxParkedPacketCount);
+    return *pool;
+}
+
+static ErrCode createPooledDataPacket(
+    IDataPacket** obj, IDataPacket* domainPacket, IDataDescriptor* descriptor, SizeT sampleCount, INumber* offset, const Int* intOffset)
+{
+    OPENDAQ_PARAM_NOT_NULL(obj);
+
+    PooledDataPacketImpl* packet = getDataPacketPool().get();
+    packet->addRef();
+
+    const ErrCode errCode = daqTry([&] { packet->init(domainPacket, descriptor, sampleCount, offset, intOffset); });
+    if (OPENDAQ_FAILED(errCode))
+    {
+        // Returns the packet to the pool
+        packet->releaseRef();
+        return errCode;
+    }
+
+    *obj = packet;
+    return OPENDAQ_SUCCESS;
+}
+
+extern "C" ErrCode LIBRARY_FACTORY createDataPacket(IDataPacket** obj, IDataDescriptor* descriptor, SizeT sampleCount, INumber* offset)
+{
+    return createPooledDataPacket(obj, nullptr, descriptor, sampleCount, offset, nullptr);
+}
+
+extern "C" ErrCode LIBRARY_FACTORY createDataPacketWithDomain(
+    IDataPacket** obj, IDataPacket* domainPacket, IDataDescriptor* descriptor, SizeT sampleCount, INumber* offset)
+{
+    return createPooledDataPacket(obj, domainPacket, descriptor, sampleCount, offset, nullptr);
+}
+
+extern "C" ErrCode LIBRARY_FACTORY createDataPacketWithIntOffset(
+    IDataPacket** obj, IDataPacket* domainPacket, IDataDescriptor* descriptor, SizeT sampleCount, Int offset)
+{
+    return createPooledDataPacket(obj, domainPacket, descriptor, sampleCount, nullptr, &offset);
+}
+
+#else
+
 OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
     LIBRARY_FACTORY, DataPacketImpl<IDataPacket>,
     IDataPacket, createDataPacket,
@@ -20,6 +142,15 @@ OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
     INumber*, offset
 )
 
+extern "C" ErrCode LIBRARY_FACTORY createDataPacketWithIntOffset(
+    IDataPacket** obj, IDataPacket* domainPacket, IDataDescriptor* descriptor, SizeT sampleCount, Int offset)
+{
+    return createObject<IDataPacket, DataPacketImpl<IDataPacket>>(
+        obj, PacketDetails::InlineOffsetTag{}, domainPacket, descriptor, sampleCount, offset);
+}
+
+#endif
+
 OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
     LIBRARY_FACTORY, DataPacketImpl<IDataPacket>,
     IDataPacket, createDataPacketWithExternalMemory,
@@ -0,0 +1,214 @@
+#include <opendaq/pool_allocator_impl.h>
+#include <opendaq/signal_errors.h>
+#include <coreobjects/property_object_factory.h>
+#include <coreobjects/property_factory.h>
+#include <coretypes/common.h>
+#include <coretypes/impl.h>
+#include <cstdlib>
+#include <limits>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace
+{
+    // Stored right before the address returned to the caller
+    struct BlockHeader
+    {
+        uint64_t bytes;
+        uint32_t sizeClassIndex;
+        uint32_t offset;
+    };
+
+    constexpr size_t HeaderSize = sizeof(BlockHeader);
+    constexpr uint32_t UnpooledSizeClassIndex = std::numeric_limits<uint32_t>::max();
+    constexpr size_t InitialShardCapacity = 16;
+
+    static_assert(HeaderSize == 16, "Block header must keep the returned addresses 16-byte aligned");
+}
+
+PoolAllocatorImpl::PoolAllocatorImpl(SizeT maxCachedBytesPerSizeClass)
+{
+    for (size_t i = 0; i < SizeClassCount; ++i)
+    {
+        auto& sizeClass = sizeClasses[i];
+        sizeClass.maxFreeBlockCount = maxCachedBytesPerSizeClass >> (i + MinBlockSizeShift);
+        for (auto& shard : sizeClass.shards)
+            shard = daqLockFreeStackCreate(InitialShardCapacity);
+    }
+}
+
+PoolAllocatorImpl::~PoolAllocatorImpl()
+{
+    for (auto& sizeClass : sizeClasses)
+    {
+        for (auto& shard : sizeClass.shards)
+        {
+            while (void* block = daqLockFreeStackPop(shard))
+                std::free(block);
+            daqLockFreeStackDestroy(shard);
+        }
+    }
+}
+
+ErrCode PoolAllocatorImpl::allocate(
+    const IDataDescriptor* /*descriptor*/,
+    SizeT bytes,
+    SizeT align,
+    VoidPtr* address)
+{
+    OPENDAQ_PARAM_NOT_NULL(address);
+
+    // alignments that are not a power of two are element sizes of compound types, served by the default alignment
+    const size_t alignment = (align > HeaderSize && (align & (align - 1)) == 0) ? align : HeaderSize;
+    const size_t blockSize = bytes + alignment;
+    const uint32_t sizeClassIndex = getSizeClassIndex(blockSize);
+
+    bool poolHit = false;
+    auto block = static_cast<uint8_t*>(allocateBlock(blockSize, sizeClassIndex, poolHit));
+    if (block == nullptr)
+    {
+        *address = nullptr;
+        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_NOMEMORY, "Pool allocator failed to allocate {} bytes", bytes);
+    }
+
+    const auto blockAddress = reinterpret_cast<uintptr_t>(block);
+    const auto userAddress = (blockAddress + HeaderSize + alignment - 1) & ~(uintptr_t(alignment) - 1);
+
+    auto header = reinterpret_cast<BlockHeader*>(userAddress - HeaderSize);
+    header->bytes = bytes;
+    header->sizeClassIndex = sizeClassIndex;
+    header->offset = static_cast<uint32_t>(userAddress - blockAddress);
+
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (poolHit)
+        poolHitCount.fetch_add(1, std::memory_order_relaxed);
+    updateHighWaterMark(bytesLive.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+
+    *address = reinterpret_cast<void*>(userAddress);
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PoolAllocatorImpl::free(VoidPtr address)
+{
+    if (address == nullptr)
+        return OPENDAQ_SUCCESS;
+
+    const auto header = reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(address) - HeaderSize);
+    bytesLive.fetch_sub(header->bytes, std::memory_order_relaxed);
+    freeBlock(static_cast<uint8_t*>(address) - header->offset, header->sizeClassIndex);
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PoolAllocatorImpl::deleteMemory(void* address)
+{
+    return free(address);
+}
+
+ErrCode PoolAllocatorImpl::getStatistics(IPropertyObject** statistics)
+{
+    OPENDAQ_PARAM_NOT_NULL(statistics);
+
+    return daqTry([this, &statistics]
+    {
+        const auto allocations = allocationCount.load(std::memory_order_relaxed);
+        const auto hits = poolHitCount.load(std::memory_order_relaxed);
+
+        size_t cachedBytes = 0;
+        for (size_t i = 0; i < SizeClassCount; ++i)
+            cachedBytes += sizeClasses[i].freeBlockCount.load(std::memory_order_relaxed) << (i + MinBlockSizeShift);
+
+        auto obj = PropertyObject();
+        auto addIntStatistic = [&obj](const StringPtr& name, size_t value)
+        {
+            obj.addProperty(IntPropertyBuilder(name, static_cast<Int>(value)).setReadOnly(true).build());
+        };
+
+        addIntStatistic("AllocationCount", allocations);
+        addIntStatistic("PoolHitCount", hits);
+        const Float hitRate = allocations > 0 ? static_cast<Float>(hits) / static_cast<Float>(allocations) : 0.0;
+        obj.addProperty(FloatPropertyBuilder("HitRate", hitRate).setReadOnly(true).build());
+        addIntStatistic("BytesLive", bytesLive.load(std::memory_order_relaxed));
+        addIntStatistic("HighWaterMark", highWaterMark.load(std::memory_order_relaxed));
+        addIntStatistic("CachedBytes", cachedBytes);
+
+        *statistics = obj.detach();
+    });
+}
+
+void* PoolAllocatorImpl::allocateBlock(size_t blockSize, uint32_t sizeClassIndex, bool& poolHit)
+{
+    if (sizeClassIndex == UnpooledSizeClassIndex)
+        return std::malloc(blockSize);
+
+    // take a block from the shard of the calling thread first and only then from the other shards
+    auto& sizeClass = sizeClasses[sizeClassIndex];
+    const size_t shardIndex = getShardIndex();
+    for (size_t i = 0; i < ShardCount; ++i)
+    {
+        if (void* block = daqLockFreeStackPop(sizeClass.shards[(shardIndex + i) % ShardCount]))
+        {
+            sizeClass.freeBlockCount.fetch_sub(1, std::memory_order_relaxed);
+            poolHit = true;
+            return block;
+        }
+    }
+
+    return std::malloc(size_t(1) << (sizeClassIndex + MinBlockSizeShift));
+}
+
+void PoolAllocatorImpl::freeBlock(void* block, uint32_t sizeClassIndex)
+{
+    if (sizeClassIndex == UnpooledSizeClassIndex)
+    {
+        std::free(block);
+        return;
+    }
+
+    // keep the memory held by idle blocks bounded after bursts
+    auto& sizeClass = sizeClasses[sizeClassIndex];
+    if (sizeClass.freeBlockCount.fetch_add(1, std::memory_order_relaxed) >= sizeClass.maxFreeBlockCount)
+    {
+        sizeClass.freeBlockCount.fetch_sub(1, std::memory_order_relaxed);
+        std::free(block);
+        return;
+    }
+
+    daqLockFreeStackPush(sizeClass.shards[getShardIndex()], block);
+}
+
+void PoolAllocatorImpl::updateHighWaterMark(size_t currentBytesLive)
+{
+    size_t currentHighWaterMark = highWaterMark.load(std::memory_order_relaxed);
+    while (currentBytesLive > currentHighWaterMark &&
+           !highWaterMark.compare_exchange_weak(currentHighWaterMark, currentBytesLive, std::memory_order_relaxed))
+    {
+    }
+}
+
+uint32_t PoolAllocatorImpl::getSizeClassIndex(size_t blockSize)
+{
+    if (blockSize > (size_t(1) << MaxBlockSizeShift))
+        return UnpooledSizeClassIndex;
+
+    uint32_t shift = MinBlockSizeShift;
+    while ((size_t(1) << shift) < blockSize)
+        ++shift;
+    return shift - MinBlockSizeShift;
+}
+
+size_t PoolAllocatorImpl::getShardIndex()
+{
+    // Threads are spread over the shards in order of their first allocation. The thread-local value is
+    // trivially destructible, so no thread-exit destructor is registered (see ErrorInfoHolder).
+    static std::atomic<size_t> nextShardIndex{0};
+    thread_local const size_t shardIndex = nextShardIndex.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+    return shardIndex;
+}
+
+OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, PoolAllocator,
+    IPoolAllocator,
+    SizeT, maxCachedBytesPerSizeClass)
+
+END_NAMESPACE_OPENDAQ
@@ -1,4 +1,6 @@
 #include <array>
+#include <thread>
+#include <vector>
 #include <opendaq/connection_factory.h>
 #include <coretypes/objectptr.h>
 #include <gtest/gtest.h>
@@ -9,6 +11,7 @@
 #include "opendaq/input_port_factory.h"
 #include "opendaq/packet_factory.h"
 #include "opendaq/scheduler_factory.h"
+#include "opendaq/data_descriptor_factory.h"
 
 #include "opendaq/gmock/context.h"
 #include "opendaq/gmock/input_port.h"
@@ -332,3 +335,167 @@ TEST_F(ConnectionTest, DequeueUpTo2)
     for (SizeT i = 0; i < count; ++i)
         PacketPtr pkt = std::move(buf[i]);
 }
+
+TEST_F(ConnectionTest, LockFreeEnqueue)
+{
+    inputPort.mock().packetQueueMode = PacketQueueMode::LockFreeSingleProducer;
+    EXPECT_CALL(inputPort.mock(), getGapCheckingEnabled(testing::_)).WillOnce(GetBool(False));
+    const auto connection = Connection(inputPort->asPtr<IInputPort>(), signal, context);
+    const std::array packets{
+        createWithImplementation<IPacket, MockPacket>(),
+        createWithImplementation<IPacket, MockPacket>(),
+        createWithImplementation<IPacket, MockPacket>(),
+    };
+
+    std::size_t n = 0;
+
+    for (const auto& packet : packets)
+    {
+        EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued(n == 0 ? True : False)).Times(1);
+        ASSERT_NO_THROW(connection.enqueue(packet));
+        EXPECT_EQ(connection.getPacketCount(), ++n);
+        EXPECT_EQ(connection.peek(), packets[0]);
+    }
+
+    while (n)
+    {
+        EXPECT_EQ(connection.peek(), packets[packets.size() - n]);
+        ASSERT_EQ(connection.dequeue(), packets[packets.size() - n]);
+        EXPECT_EQ(connection.getPacketCount(), --n);
+    }
+
+    ASSERT_FALSE(connection.dequeue().assigned());
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued(True)).Times(1);
+    connection.enqueue(createWithImplementation<IPacket, MockPacket>());
+}
+
+TEST_F(ConnectionTest, LockFreeOverflowKeepsOrder)
+{
+    inputPort.mock().packetQueueMode = PacketQueueMode::LockFreeSingleProducer;
+    EXPECT_CALL(inputPort.mock(), getGapCheckingEnabled(testing::_)).WillOnce(GetBool(False));
+    const auto connection = Connection(inputPort->asPtr<IInputPort>(), signal, context);
+
+    // exceeds the capacity of the ring buffer, so that the overflow queue is used
+    const SizeT count = 5000;
+    std::vector<PacketPtr> packets;
+    for (SizeT i = 0; i < count; ++i)
+    {
+        packets.push_back(createWithImplementation<IPacket, MockPacket>());
+        connection.enqueue(packets.back());
+
+        // drain part of the queue while the overflow queue is in use
+        if (i == 2000)
+        {
+            for (SizeT j = 0; j < 20; ++j)
+                ASSERT_EQ(connection.dequeue(), packets[j]);
+        }
+    }
+
+    ASSERT_EQ(connection.getPacketCount(), count - 20);
+
+    for (SizeT i = 20; i < count; ++i)
+        ASSERT_EQ(connection.dequeue(), packets[i]);
+
+    ASSERT_FALSE(connection.dequeue().assigned());
+    ASSERT_EQ(connection.getPacketCount(), 0u);
+}
+
+TEST_F(ConnectionTest, LockFreeDequeueAll)
+{
+    inputPort.mock().packetQueueMode = PacketQueueMode::LockFreeMultiProducer;
+    EXPECT_CALL(inputPort.mock(), getGapCheckingEnabled(testing::_)).WillOnce(GetBool(False));
+    const auto connection = Connection(inputPort->asPtr<IInputPort>(), signal, context);
+
+    const auto packets = List<IPacket>(
+        createWithImplementation<IPacket, MockPacket>(),
+        createWithImplementation<IPacket, MockPacket>(),
+        createWithImplementation<IPacket, MockPacket>());
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued(True)).Times(1);
+    connection.enqueueMultiple(packets);
+
+    const auto packetsOut = connection.dequeueAll();
+    ASSERT_EQ(packetsOut.getCount(), 3u);
+    for (SizeT i = 0; i < 3; ++i)
+        ASSERT_EQ(packetsOut[i], packets[i]);
+
+    ASSERT_FALSE(connection.dequeue().assigned());
+    ASSERT_EQ(connection.dequeueAll().getCount(), 0u);
+}
+
+TEST_F(ConnectionTest, LockFreeSamplesAndDescriptor)
+{
+    auto logger = Logger();
+    auto context = Context(Scheduler(logger, 1), logger, nullptr, nullptr, nullptr);
+
+    auto signal = Signal(context, nullptr, "sig");
+    signal.setDescriptor(DataDescriptorBuilder().setSampleType(SampleType::Float64).build());
+
+    auto ip = InputPort(context, nullptr, "ip");
+    ip.setPacketQueueMode(PacketQueueMode::LockFreeSingleProducer);
+    ip.connect(signal);
+
+    auto packet = DataPacket(signal.getDescriptor(), 10);
+    for (int i = 0; i < 3; ++i)
+        signal.sendPacket(packet);
+
+    const auto connection = ip.getConnection();
+    ASSERT_EQ(connection.getPacketCount(), 4u);
+    ASSERT_EQ(connection.getAvailableSamples(), 30u);
+    ASSERT_TRUE(connection.hasEventPacket());
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 0u);
+
+    ASSERT_EQ(connection.dequeue().getType(), PacketType::Event);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 30u);
+
+    SizeT count = 2;
+    std::vector<IPacket*> buf(count);
+    connection.asPtr<IConnectionInternal>()->dequeueUpTo(buf.data(), &count);
+    ASSERT_EQ(count, 2u);
+    for (SizeT i = 0; i < count; ++i)
+        PacketPtr pkt = std::move(buf[i]);
+
+    ASSERT_EQ(connection.getAvailableSamples(), 10u);
+
+    connection.asPtr<IConnectionInternal>()->enqueueLastDescriptor();
+    ASSERT_EQ(connection.dequeue().getType(), PacketType::Event);
+    ASSERT_EQ(connection.dequeue(), packet);
+    ASSERT_FALSE(connection.dequeue().assigned());
+}
+
+TEST_F(ConnectionTest, LockFreeConcurrentProducers)
+{
+    inputPort.mock().packetQueueMode = PacketQueueMode::LockFreeMultiProducer;
+    EXPECT_CALL(inputPort.mock(), getGapCheckingEnabled(testing::_)).WillOnce(GetBool(False));
+    const auto connection = Connection(inputPort->asPtr<IInputPort>(), signal, context);
+
+    constexpr SizeT producerCount = 4;
+    constexpr SizeT packetsPerProducer = 2000;
+    const auto packet = createWithImplementation<IPacket, MockPacket>();
+
+    std::vector<std::thread> producers;
+    for (SizeT i = 0; i < producerCount; ++i)
+    {
+        producers.emplace_back([&connection, &packet]
+        {
+            for (SizeT j = 0; j < packetsPerProducer; ++j)
+                connection.enqueue(packet);
+        });
+    }
+
+    SizeT received = 0;
+    while (received < producerCount * packetsPerProducer)
+    {
+        if (connection.dequeue().assigned())
+            received++;
+        else
+            std::this_thread::yield();
+    }
+
+    for (auto& producer : producers)
+        producer.join();
+
+    ASSERT_EQ(received, producerCount * packetsPerProducer);
+    ASSERT_FALSE(connection.dequeue().assigned());
+}
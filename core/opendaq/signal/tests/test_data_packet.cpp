@@ -1,9 +1,11 @@
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 #include <opendaq/data_descriptor_factory.h>
+#include <opendaq/data_packet_private.h>
 #include <opendaq/data_rule_factory.h>
 #include <opendaq/dimension_factory.h>
 #include <opendaq/packet_factory.h>
+#include <opendaq/packet_destruct_callback_factory.h>
 #include <opendaq/reusable_data_packet_ptr.h>
 #include <opendaq/sample_type_traits.h>
 #include <opendaq/scaling_factory.h>
@@ -91,6 +93,43 @@ TEST_F(DataPacketTest, DataPacketWithDomainGetters)
     ASSERT_TRUE(*value.getDomainPacket() == *domain);
 }
 
+TEST_F(DataPacketTest, IntOffset)
+{
+    const auto desc = setupDescriptor(SampleType::Int64, LinearDataRule(2, 5), nullptr);
+    const DataPacketPtr packet = DataPacket(desc, 100, Int(1000));
+    const DataPacketPtr numberPacket = DataPacket(desc, 100, NumberPtr(1000));
+
+    Int offset;
+    ASSERT_TRUE(getDataPacketIntOffset(packet, offset));
+    ASSERT_EQ(offset, 1000);
+
+    ASSERT_EQ(packet.getOffset(), 1000);
+    ASSERT_TRUE(*packet == *numberPacket);
+
+    const auto data = static_cast<int64_t*>(packet.getData());
+    for (int64_t i = 0; i < 100; ++i)
+        ASSERT_EQ(data[i], 1000 + 5 + 2 * i);
+}
+
+TEST_F(DataPacketTest, PrivateOffsetGetters)
+{
+    const auto desc = setupDescriptor(SampleType::Float64, LinearDataRule(0.5, 0), nullptr);
+
+    Int intOffset;
+    Float floatOffset;
+
+    const DataPacketPtr floatPacket = DataPacket(desc, 10, NumberPtr(2.5));
+    ASSERT_TRUE(getDataPacketFloatOffset(floatPacket, floatOffset));
+    ASSERT_DOUBLE_EQ(floatOffset, 2.5);
+    ASSERT_TRUE(getDataPacketIntOffset(floatPacket, intOffset));
+    ASSERT_EQ(intOffset, 2);
+
+    const DataPacketPtr noOffsetPacket = DataPacket(desc, 10);
+    ASSERT_FALSE(getDataPacketIntOffset(noOffsetPacket, intOffset));
+    ASSERT_EQ(intOffset, 0);
+    ASSERT_EQ(noOffsetPacket.getOffset(), nullptr);
+}
+
 TEST_F(DataPacketTest, TestDoubleLinearDataRule)
 {
     const auto descriptor = setupDescriptor(SampleType::Float64, LinearDataRule(10.5, 200), nullptr);
@@ -254,6 +293,50 @@ TEST_F(DataPacketTest, TestInt64LinearScaling)
     validateLinearScalingPacket<int64_t, double>(descriptor, 1012, 10020);
 }
 
+template <typename T, typename U>
+static void validateLinearScalingSignedPacket(SampleType rawType, ScaledSampleType scaledType, SampleType outputType)
+{
+    constexpr size_t sampleCount = 1001;
+    const U scale = static_cast<U>(0.3);
+    const U offset = static_cast<U>(-2.5);
+    const auto descriptor = setupDescriptor(outputType, ExplicitDataRule(), LinearScaling(0.3, -2.5, rawType, scaledType));
+
+    const DataPacketPtr packet = DataPacket(descriptor, sampleCount);
+    T* rawData = static_cast<T*>(packet.getRawData());
+    for (size_t i = 0; i < sampleCount; ++i)
+        rawData[i] = static_cast<T>(static_cast<int64_t>(i * 37 % 201) - 100);
+
+    const auto scaledData = static_cast<U*>(packet.getData());
+    for (size_t i = 0; i < sampleCount; ++i)
+    {
+        const U expected = scale * static_cast<U>(rawData[i]) + offset;
+        if constexpr (std::is_same_v<U, float>)
+            ASSERT_FLOAT_EQ(scaledData[i], expected);
+        else
+            ASSERT_DOUBLE_EQ(scaledData[i], expected);
+    }
+}
+
+TEST_F(DataPacketTest, TestSignedLinearScalingOddSampleCount)
+{
+    validateLinearScalingSignedPacket<int8_t, float>(SampleType::Int8, ScaledSampleType::Float32, SampleType::Float32);
+    validateLinearScalingSignedPacket<int16_t, float>(SampleType::Int16, ScaledSampleType::Float32, SampleType::Float32);
+    validateLinearScalingSignedPacket<int32_t, double>(SampleType::Int32, ScaledSampleType::Float64, SampleType::Float64);
+    validateLinearScalingSignedPacket<double, float>(SampleType::Float64, ScaledSampleType::Float32, SampleType::Float32);
+}
+
+TEST_F(DataPacketTest, TestInt64LinearDataRuleOddSampleCount)
+{
+    constexpr int64_t delta = 1000000007;
+    constexpr int64_t start = -5;
+    const auto descriptor = setupDescriptor(SampleType::Int64, LinearDataRule(delta, start), nullptr);
+
+    const DataPacketPtr packet = DataPacket(descriptor, 1001, 42);
+    const auto data = static_cast<int64_t*>(packet.getData());
+    for (int64_t i = 0; i < 1001; ++i)
+        ASSERT_EQ(data[i], 42 + start + i * delta);
+}
+
 template <typename DataType>
 class ConstantRuleTest : public DataPacketTest
 {
@@ -450,6 +533,102 @@ TEST_F(DataPacketTest, Reuse)
     ASSERT_EQ(packet.getDataDescriptor(), newDescriptor);
 }
 
+TEST_F(DataPacketTest, ReuseIntOffsetPacket)
+{
+    const auto descriptor = setupDescriptor(SampleType::Int64, LinearDataRule(1, 0), nullptr);
+    const auto packet = DataPacket(descriptor, 5, Int(100));
+
+    bool success = packet.asPtr<IReusableDataPacket>(true).reuse(nullptr, std::numeric_limits<SizeT>::max(), 200, nullptr, false);
+    ASSERT_TRUE(success);
+
+    Int offset;
+    ASSERT_TRUE(getDataPacketIntOffset(packet, offset));
+    ASSERT_EQ(offset, 200);
+    ASSERT_EQ(packet.getOffset(), 200);
+    ASSERT_EQ(static_cast<const int64_t*>(packet.getData())[0], 200);
+}
+
+#ifdef OPENDAQ_ENABLE_OBJECT_POOLS
+
+TEST_F(DataPacketTest, PooledPacketNoStaleState)
+{
+    const auto domainDescriptor = setupDescriptor(SampleType::Int64, LinearDataRule(1, 0), nullptr);
+    const auto descriptor = setupDescriptor(SampleType::Float64, ExplicitDataRule(), nullptr);
+
+    int destructCallCount = 0;
+    IDataPacket* pooledPacket;
+    {
+        const auto packet = DataPacketWithDomain(DataPacket(domainDescriptor, 10, Int(100)), descriptor, 10, Int(5));
+        packet.subscribeForDestructNotification(PacketDestructCallback([&destructCallCount] { ++destructCallCount; }));
+        pooledPacket = packet.getObject();
+    }
+    ASSERT_EQ(destructCallCount, 1);
+
+    {
+        const auto packet = DataPacket(descriptor, 10);
+        ASSERT_EQ(packet.getObject(), pooledPacket);
+
+        ASSERT_FALSE(packet.getDomainPacket().assigned());
+        ASSERT_EQ(packet.getOffset(), nullptr);
+        Int offset;
+        ASSERT_FALSE(getDataPacketIntOffset(packet, offset));
+    }
+    ASSERT_EQ(destructCallCount, 1);
+}
+
+TEST_F(DataPacketTest, PooledPacketNoStaleScaledData)
+{
+    const auto scaledDescriptor =
+        setupDescriptor(SampleType::Float64, ExplicitDataRule(), LinearScaling(2, 5, SampleType::Int32, ScaledSampleType::Float64));
+
+    IDataPacket* pooledPacket;
+    {
+        const auto packet = createExplicitPacket<int32_t, 10>(scaledDescriptor);
+        ASSERT_EQ(static_cast<double*>(packet.getData())[3], 11.0);
+        pooledPacket = packet.getObject();
+    }
+
+    const auto descriptor = setupDescriptor(SampleType::Float64, ExplicitDataRule(), nullptr);
+    const auto packet = createExplicitPacket<double, 10>(descriptor);
+    ASSERT_EQ(packet.getObject(), pooledPacket);
+
+    const auto data = static_cast<double*>(packet.getData());
+    ASSERT_EQ(data, packet.getRawData());
+    for (size_t i = 0; i < 10; ++i)
+        ASSERT_EQ(data[i], static_cast<double>(i));
+}
+
+TEST_F(DataPacketTest, PooledPacketLargeBufferNotKept)
+{
+    const auto descriptor = setupDescriptor(SampleType::Float64, ExplicitDataRule(), nullptr);
+
+    void* smallPacketData;
+    {
+        const auto packet = DataPacket(descriptor, 1024);
+        smallPacketData = packet.getRawData();
+    }
+
+    // buffers of up to 64 KiB are kept for the next use of the packet
+    {
+        const auto packet = DataPacket(descriptor, 16);
+        ASSERT_EQ(packet.getRawData(), smallPacketData);
+    }
+
+    IDataPacket* largePacket;
+    void* largePacketData;
+    {
+        const auto packet = DataPacket(descriptor, 1024 * 1024);
+        largePacket = packet.getObject();
+        largePacketData = packet.getRawData();
+    }
+
+    const auto packet = DataPacket(descriptor, 16);
+    ASSERT_EQ(packet.getObject(), largePacket);
+    ASSERT_NE(packet.getRawData(), largePacketData);
+}
+
+#endif
+
 TEST_F(DataPacketTest, ReuseSameDescriptorOffsetAndSampleCount)
 {
     auto descriptor = setupDescriptor(SampleType::Float64, ExplicitDataRule(), nullptr);
@@ -0,0 +1,140 @@
+#include <opendaq/pool_allocator_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/scaling_factory.h>
+#include <opendaq/signal_factory.h>
+#include <opendaq/context_factory.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+using PoolAllocatorTest = testing::Test;
+
+BEGIN_NAMESPACE_OPENDAQ
+
+TEST_F(PoolAllocatorTest, TestFactory)
+{
+    PoolAllocatorPtr allocator;
+    void* ptr = nullptr;
+
+    ASSERT_NO_THROW(allocator = PoolAllocator());
+
+    ASSERT_NO_THROW(ptr = allocator.allocate(nullptr, 32, 8));
+    ASSERT_NO_THROW(allocator.free(ptr));
+    ASSERT_NO_THROW(ptr = allocator.allocate(nullptr, 32, 0));
+    ASSERT_NO_THROW(allocator.free(ptr));
+    ASSERT_NO_THROW(allocator.free(nullptr));
+}
+
+TEST_F(PoolAllocatorTest, Alignment)
+{
+    auto allocator = PoolAllocator();
+
+    for (SizeT align : {0, 1, 8, 16, 24, 64, 4096})
+    {
+        void* ptr = allocator.allocate(nullptr, 100, align);
+        ASSERT_NE(ptr, nullptr);
+
+        const SizeT expectedAlignment = (align > 16 && (align & (align - 1)) == 0) ? align : 16;
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % expectedAlignment, 0u);
+        allocator.free(ptr);
+    }
+}
+
+TEST_F(PoolAllocatorTest, BlocksAreRecycled)
+{
+    auto allocator = PoolAllocator();
+
+    void* first = allocator.allocate(nullptr, 1000, 0);
+    allocator.free(first);
+    void* second = allocator.allocate(nullptr, 900, 0);
+    ASSERT_EQ(first, second);
+    allocator.free(second);
+
+    const auto statistics = allocator.getStatistics();
+    ASSERT_EQ(statistics.getPropertyValue("AllocationCount"), 2);
+    ASSERT_EQ(statistics.getPropertyValue("PoolHitCount"), 1);
+    ASSERT_DOUBLE_EQ(statistics.getPropertyValue("HitRate"), 0.5);
+    ASSERT_EQ(statistics.getPropertyValue("BytesLive"), 0);
+    ASSERT_EQ(statistics.getPropertyValue("HighWaterMark"), 1000);
+    ASSERT_EQ(statistics.getPropertyValue("CachedBytes"), 1024);
+}
+
+TEST_F(PoolAllocatorTest, LargeBlocksAreNotPooled)
+{
+    auto allocator = PoolAllocator();
+
+    void* ptr = allocator.allocate(nullptr, 4 * 1024 * 1024, 0);
+    ASSERT_NE(ptr, nullptr);
+    allocator.free(ptr);
+
+    ASSERT_EQ(allocator.getStatistics().getPropertyValue("CachedBytes"), 0);
+}
+
+TEST_F(PoolAllocatorTest, CachedBytesLimit)
+{
+    auto allocator = PoolAllocator(2048);
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < 4; ++i)
+        blocks.push_back(allocator.allocate(nullptr, 1000, 0));
+    for (void* block : blocks)
+        allocator.free(block);
+
+    ASSERT_EQ(allocator.getStatistics().getPropertyValue("CachedBytes"), 2048);
+}
+
+TEST_F(PoolAllocatorTest, DataPacketWithAllocator)
+{
+    auto allocator = PoolAllocator();
+    const auto descriptor = DataDescriptorBuilder()
+                                .setSampleType(SampleType::Float64)
+                                .setPostScaling(LinearScaling(2, 1, SampleType::Int32, ScaledSampleType::Float64))
+                                .build();
+
+    {
+        const auto packet = DataPacketWithAllocator(nullptr, descriptor, 100, allocator);
+        auto rawData = static_cast<int32_t*>(packet.getRawData());
+        for (int32_t i = 0; i < 100; ++i)
+            rawData[i] = i;
+
+        const auto data = static_cast<double*>(packet.getData());
+        ASSERT_DOUBLE_EQ(data[10], 21.0);
+
+        // raw and scaled data
+        ASSERT_EQ(allocator.getStatistics().getPropertyValue("BytesLive"), 100 * (sizeof(int32_t) + sizeof(double)));
+    }
+
+    ASSERT_EQ(allocator.getStatistics().getPropertyValue("BytesLive"), 0);
+}
+
+TEST_F(PoolAllocatorTest, SignalPacketAllocator)
+{
+    auto allocator = PoolAllocator();
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).build();
+    const auto signal = SignalWithDescriptor(NullContext(), descriptor, nullptr, "sig");
+
+    const auto allocatorSlot = signal.asPtr<ISignalPacketAllocator>(true);
+    ASSERT_FALSE(allocatorSlot.getPacketAllocator().assigned());
+
+    {
+        const auto packet = DataPacketForSignal(signal, nullptr, 100);
+        ASSERT_EQ(allocator.getStatistics().getPropertyValue("BytesLive"), 0);
+    }
+
+    allocatorSlot.setPacketAllocator(allocator);
+    ASSERT_EQ(allocatorSlot.getPacketAllocator(), allocator);
+
+    {
+        const auto packet = DataPacketForSignal(signal, nullptr, 100);
+        ASSERT_EQ(packet.getDataDescriptor(), descriptor);
+        ASSERT_EQ(allocator.getStatistics().getPropertyValue("BytesLive"), 100 * sizeof(int32_t));
+    }
+
+    ASSERT_EQ(allocator.getStatistics().getPropertyValue("BytesLive"), 0);
+
+    allocatorSlot.setPacketAllocator(nullptr);
+    ASSERT_FALSE(allocatorSlot.getPacketAllocator().assigned());
+}
+
+END_NAMESPACE_OPENDAQ
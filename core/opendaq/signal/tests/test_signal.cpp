@@ -17,8 +17,10 @@
 #include <opendaq/tags_factory.h>
 #include <opendaq/input_port_notifications.h>
 #include <opendaq/input_port_factory.h>
+#include <opendaq/input_port_private_ptr.h>
 #include <opendaq/scheduler_factory.h>
 #include <thread>
+#include <atomic>
 #include <coreobjects/property_factory.h>
 #include <opendaq/binary_data_packet_factory.h>
 #include <opendaq/connection_factory.h>
@@ -654,6 +656,34 @@ TEST_F(SignalTest, SendPacketsCheckOrder)
     }
 }
 
+TEST_F(SignalTest, SendPacketToMultipleConnections)
+{
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+
+    std::vector<ConnectionMockImpl*> connImpls;
+    std::vector<ConnectionPtr> conns;
+    for (int i = 0; i < 3; ++i)
+    {
+        auto connImpl = new ConnectionMockImpl();
+        ConnectionPtr conn;
+        checkErrorInfo(connImpl->queryInterface(IConnection::Id, reinterpret_cast<void**>(&conn)));
+        signal.asPtr<ISignalEvents>()->listenerConnected(conn);
+
+        connImpls.push_back(connImpl);
+        conns.push_back(conn);
+    }
+
+    signal.sendPacket(PacketMock());
+    signal.asPtr<ISignalEvents>()->listenerDisconnected(conns[1]);
+    signal.sendPacket(PacketMock());
+    signal.sendPackets(List<IPacket>(PacketMock(), PacketMock()));
+
+    ASSERT_EQ(connImpls[0]->packetsEnqueued, 5u);
+    ASSERT_EQ(connImpls[1]->packetsEnqueued, 2u);
+    ASSERT_EQ(connImpls[2]->packetsEnqueued, 5u);
+    ASSERT_EQ(signal.getConnections().getCount(), 2u);
+}
+
 TEST_F(SignalTest, SetDescriptorWithConnection)
 {
     const auto signal = Signal(NullContext(), nullptr, "sig");
@@ -2254,6 +2284,110 @@ TEST_F(SignalTest, LastReferenceScheduler)
     scheduler.stop();
 }
 
+TEST_F(SignalTest, SchedulerNotificationsSerialized)
+{
+    const auto logger = Logger();
+    const auto scheduler = Scheduler(logger, 4);
+    const auto ctx = Context(scheduler, logger, TypeManager(), nullptr, nullptr);
+
+    const auto signal = Signal(ctx, nullptr, "sig");
+    auto descriptor = DataDescriptorBuilder().setName("test").setSampleType(SampleType::Int64).build();
+    signal.setDescriptor(descriptor);
+
+    std::atomic<int> activeNotifications{0};
+    std::atomic<bool> overlapped{false};
+    std::atomic<int> dataPacketsReceived{0};
+    const auto listener = createWithImplementation<IInputPortNotifications, ListenerImpl>(
+        [&](const InputPortPtr& port)
+        {
+            if (activeNotifications.fetch_add(1) != 0)
+                overlapped = true;
+
+            // dequeue a single data packet per notification
+            const auto conn = port.getConnection();
+            if (conn.assigned())
+            {
+                auto packet = conn.dequeue();
+                while (packet.assigned() && packet.getType() != PacketType::Data)
+                    packet = conn.dequeue();
+                if (packet.assigned())
+                    dataPacketsReceived++;
+            }
+
+            activeNotifications.fetch_sub(1);
+        });
+
+    const auto ip = InputPort(ctx, nullptr, "ip");
+    ip.setNotificationMethod(PacketReadyNotification::Scheduler);
+    ip.setListener(listener);
+    ip.connect(signal);
+
+    for (int i = 0; i < 1000; ++i)
+        signal.sendPacket(DataPacket(descriptor, 1));
+
+    scheduler.waitAll();
+
+    ASSERT_FALSE(overlapped);
+    ASSERT_EQ(dataPacketsReceived, 1000);
+
+    const auto ipPrivate = ip.asPtr<IInputPortPrivate>(true);
+    const SizeT requestCount = ipPrivate.getSchedulerNotificationRequestCount();
+    const SizeT runCount = ipPrivate.getSchedulerNotificationRunCount();
+    ASSERT_GE(requestCount, 1000u);
+    ASSERT_GE(runCount, 1u);
+    ASSERT_LE(runCount, requestCount);
+
+    ip.setListener(nullptr);
+    ASSERT_EQ(ipPrivate.getSchedulerNotificationRequestCount(), 0u);
+
+    scheduler.stop();
+}
+
+TEST_F(SignalTest, SchedulerNotificationsListenerReplacedWhileSending)
+{
+    const auto logger = Logger();
+    const auto scheduler = Scheduler(logger, 4);
+    const auto ctx = Context(scheduler, logger, TypeManager(), nullptr, nullptr);
+
+    const auto signal = Signal(ctx, nullptr, "sig");
+    auto descriptor = DataDescriptorBuilder().setName("test").setSampleType(SampleType::Int64).build();
+    signal.setDescriptor(descriptor);
+
+    const auto listener = createWithImplementation<IInputPortNotifications, ListenerImpl>(
+        [](const InputPortPtr& port)
+        {
+            const auto conn = port.getConnection();
+            if (conn.assigned())
+                while (conn.dequeue().assigned()) {}
+        });
+
+    const auto ip = InputPort(ctx, nullptr, "ip");
+    ip.setNotificationMethod(PacketReadyNotification::Scheduler);
+    ip.setListener(listener);
+    ip.connect(signal);
+
+    std::atomic<bool> sending{true};
+    std::thread listenerThread([&]
+    {
+        while (sending)
+        {
+            ip.setListener(nullptr);
+            ip.setListener(listener);
+        }
+    });
+
+    for (int i = 0; i < 10000; ++i)
+        signal.sendPacket(DataPacket(descriptor, 1));
+
+    sending = false;
+    listenerThread.join();
+    scheduler.waitAll();
+
+    ASSERT_TRUE(ip.getListener().assigned());
+
+    scheduler.stop();
+}
+
 TEST_F(SignalTest, LastReferenceSameThreadMultiPackets)
 {
     const auto logger = Logger();
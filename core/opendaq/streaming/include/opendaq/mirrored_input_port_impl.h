@@ -64,6 +64,8 @@ public:
 //    ErrCode INTERFACE_FUNC setRequiresSignal(Bool requiresSignal) override; // unavailable
 //    ErrCode INTERFACE_FUNC getGapCheckingEnabled(Bool* gapCheckingEnabled) override; // RPC
 //    ErrCode INTERFACE_FUNC notifyPacketEnqueuedWithScheduler() override; // unavailable
+//    ErrCode INTERFACE_FUNC setPacketQueueMode(PacketQueueMode mode) override; // unavailable
+//    ErrCode INTERFACE_FUNC getPacketQueueMode(PacketQueueMode* mode) override; // unavailable
 
     // IInputPort
 //    ErrCode INTERFACE_FUNC getConnection(IConnection** connection) override; // unavailable
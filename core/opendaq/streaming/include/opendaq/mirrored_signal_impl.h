@@ -19,6 +19,7 @@
 #include <opendaq/mirrored_signal_config_ptr.h>
 #include <opendaq/streaming_ptr.h>
 #include <opendaq/streaming_private.h>
+#include <opendaq/streaming_routing.h>
 #include <opendaq/mirrored_signal_private_ptr.h>
 #include <opendaq/subscription_event_args_factory.h>
 
@@ -186,6 +187,7 @@ void MirroredSignalBase<Interfaces...>::removed()
     if (listened && streamed)
         unsubscribeInternal();
     activeStreamingSourceRef = nullptr;
+    daqInvalidateStreamingRouting();
 
     StringPtr signalRemoteId;
     ErrCode errCode = wrapHandlerReturn(this, &Self::onGetRemoteId, signalRemoteId);
@@ -323,6 +325,7 @@ ErrCode MirroredSignalBase<Interfaces...>::removeStreamingSource(IString* stream
         {
             // source is already destroyed
             activeStreamingSourceRef = nullptr;
+            daqInvalidateStreamingRouting();
         }
         else if (streamingConnectionStringPtr == activeStreamingSource.getConnectionString())
         {
@@ -332,6 +335,7 @@ ErrCode MirroredSignalBase<Interfaces...>::removeStreamingSource(IString* stream
                 OPENDAQ_RETURN_IF_FAILED(errCode);
             }
             activeStreamingSourceRef = nullptr;
+            daqInvalidateStreamingRouting();
         }
     }
 
@@ -572,6 +576,7 @@ ErrCode MirroredSignalBase<Interfaces...>::setActiveStreamingSource(IString* str
     }
 
     activeStreamingSourceRef = streamingSource;
+    daqInvalidateStreamingRouting();
     if (listened && streamed)
     {
         ErrCode errCode = subscribeInternal();
@@ -607,6 +612,7 @@ ErrCode MirroredSignalBase<Interfaces...>::deactivateStreaming()
     if (listened && streamed)
         errCode = unsubscribeInternal();
     activeStreamingSourceRef = nullptr;
+    daqInvalidateStreamingRouting();
 
     OPENDAQ_RETURN_IF_FAILED(errCode);
 
@@ -737,6 +743,7 @@ ErrCode MirroredSignalBase<Interfaces...>::setStreamed(Bool streamed)
         return OPENDAQ_IGNORED;
 
     this->streamed = streamed;
+    daqInvalidateStreamingRouting();
 
     ErrCode errCode = OPENDAQ_SUCCESS;
     if (this->streamed)
@@ -32,10 +32,14 @@
 #include <opendaq/mirrored_device_ptr.h>
 #include <opendaq/connection_status_container_private_ptr.h>
 #include <opendaq/mirrored_input_port_private_ptr.h>
+#include <opendaq/streaming_routing.h>
+#include <coretypes/ctutils.h>
 
 #include <opendaq/thread_name.h>
 #include <thread>
 #include <algorithm>
+#include <atomic>
+#include <memory>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -187,13 +191,45 @@ private:
     ErrCode removeStreamingSourceForAllInputPorts();
     void removeAllInputPortsInternal();
 
-    bool isActive{false};
+    /*!
+     * @brief Packet delivery target of a signal, with the cached outcome of the streamed and active streaming source checks.
+     */
+    struct SignalRoute
+    {
+        explicit SignalRoute(WeakRefPtr<IMirroredSignalConfig> signalRef)
+            : signalRef(std::move(signalRef))
+        {
+        }
+
+        // Packs the routing version the decision was made for and the decision itself into a single word,
+        // so both are always read and written together; 0 means not yet evaluated.
+        static SizeT packDecision(SizeT routingVersion, bool deliverPackets)
+        {
+            return ((routingVersion + 1) << 1) | static_cast<SizeT>(deliverPackets);
+        }
+
+        WeakRefPtr<IMirroredSignalConfig> signalRef;
+        mutable std::atomic<SizeT> checkedDecision{0};
+    };
+    using SignalRoutes = std::unordered_map<StringPtr, SignalRoute, StringHash, StringEqualTo>;
+
+    /*!
+     * @brief Publishes a new routing table built from the signal items. Requires `sync` to be locked.
+     */
+    void publishSignalRoutes();
+    bool shouldDeliverPackets(const SignalRoute& route, const MirroredSignalConfigPtr& signal) const;
+
+    std::atomic<bool> isActive{false};
     bool isReconnecting{false};
     const bool skipDomainSignalSubscribe;
 
     using SignalItem = std::pair<SizeT, WeakRefPtr<IMirroredSignalConfig>>;
     std::unordered_map<StringPtr, SignalItem, StringHash, StringEqualTo> streamingSignalsItems;
 
+    // Immutable snapshot of the signal items used by onPacket without taking `sync`. It is replaced, never modified,
+    // whenever signals are added, removed or remapped.
+    std::shared_ptr<const SignalRoutes> signalRoutes;
+
     std::unordered_set<StringPtr, StringHash, StringEqualTo> availableSignalIds;
 
     StringPtr protocolGroupId;
@@ -300,6 +336,16 @@ ErrCode StreamingImpl<Interfaces...>::addSignals(IList* signals)
     OPENDAQ_PARAM_NOT_NULL(signals);
 
     const auto signalsPtr = ListPtr<ISignal>::Borrow(signals);
+
+    bool signalsAdded = false;
+    Finally publishRoutes([this, &signalsAdded]
+    {
+        if (!signalsAdded)
+            return;
+        std::scoped_lock lock(sync);
+        publishSignalRoutes();
+    });
+
     for (const auto& signal : signalsPtr)
     {
         if (!signal.getPublic())
@@ -348,6 +394,7 @@ ErrCode StreamingImpl<Interfaces...>::addSignals(IList* signals)
 
             auto signalItem = std::make_pair(0, WeakRefPtr<IMirroredSignalConfig>(mirroredSignal));
             streamingSignalsItems.insert({signalIdKey, signalItem});
+            signalsAdded = true;
         }
 
         ErrCode errCode =
@@ -407,6 +454,7 @@ ErrCode StreamingImpl<Interfaces...>::removeSignals(IList* signals)
                 {
                     onRemoveSignal(mirroredSignal);
                     streamingSignalsItems.erase(it);
+                    publishSignalRoutes();
                 }
             }
             else
@@ -668,6 +716,7 @@ ErrCode StreamingImpl<Interfaces...>::detachRemovedSignal(const StringPtr& signa
     if (auto it = streamingSignalsItems.find(signalIdKey); it != streamingSignalsItems.end())
     {
         streamingSignalsItems.erase(it);
+        publishSignalRoutes();
     }
     else
     {
@@ -729,27 +778,54 @@ template <typename... Interfaces>
 void StreamingImpl<Interfaces...>::removeAllSignalsInternal()
 {
     streamingSignalsItems.clear();
+    publishSignalRoutes();
+}
+
+template <typename... Interfaces>
+void StreamingImpl<Interfaces...>::publishSignalRoutes()
+{
+    auto routes = std::make_shared<SignalRoutes>();
+    routes->reserve(streamingSignalsItems.size());
+    for (const auto& [signalId, signalItem] : streamingSignalsItems)
+        routes->try_emplace(signalId, signalItem.second);
+
+    std::atomic_store(&signalRoutes, std::shared_ptr<const SignalRoutes>(std::move(routes)));
+}
+
+template <typename... Interfaces>
+bool StreamingImpl<Interfaces...>::shouldDeliverPackets(const SignalRoute& route, const MirroredSignalConfigPtr& signal) const
+{
+    // the version is read before the checks, so changes made while checking cause a re-evaluation of the next packet
+    const SizeT routingVersion = daqGetStreamingRoutingVersion();
+    SizeT checkedDecision = route.checkedDecision.load(std::memory_order_acquire);
+    if ((checkedDecision | 1) == SignalRoute::packDecision(routingVersion, true))
+        return checkedDecision & 1;
+
+    const bool deliverPackets = signal.getStreamed() && signal.getActiveStreamingSource() == connectionString;
+    // only replaces the decision that was found stale, so a concurrent evaluation of a newer version is kept
+    route.checkedDecision.compare_exchange_strong(checkedDecision,
+                                                  SignalRoute::packDecision(routingVersion, deliverPackets),
+                                                  std::memory_order_acq_rel,
+                                                  std::memory_order_relaxed);
+    return deliverPackets;
 }
 
 template <typename... Interfaces>
 void StreamingImpl<Interfaces...>::onPacket(const StringPtr& signalId, const PacketPtr& packet)
 {
-    MirroredSignalConfigPtr signal;
-    {
-        std::scoped_lock lock(sync);
+    if (!packet.assigned() || !this->isActive.load(std::memory_order_acquire))
+        return;
 
-        if (!packet.assigned() || !this->isActive)
-            return;
+    const auto routes = std::atomic_load(&signalRoutes);
+    if (!routes)
+        return;
 
-        if (auto it = streamingSignalsItems.find(signalId); it != streamingSignalsItems.end())
-        {
-            auto signalRef = it->second.second;
-            signal = signalRef.getRef();
-        }
-    }
-    if (signal.assigned() &&
-        signal.getStreamed() &&
-        signal.getActiveStreamingSource() == connectionString)
+    const auto it = routes->find(signalId);
+    if (it == routes->end())
+        return;
+
+    const MirroredSignalConfigPtr signal = it->second.signalRef.getRef();
+    if (signal.assigned() && shouldDeliverPackets(it->second, signal))
     {
         const auto eventPacket = packet.asPtrOrNull<IEventPacket>();
         if (eventPacket.assigned())
@@ -852,6 +928,7 @@ void StreamingImpl<Interfaces...>::addToAvailableSignals(const StringPtr& signal
     {
         this->availableSignalIds.insert(signalStreamingId);
         remapAvailableSignal(signalStreamingId);
+        publishSignalRoutes();
         resubscribeAvailableSignal(signalStreamingId);
     }
     else
@@ -873,6 +950,7 @@ void StreamingImpl<Interfaces...>::removeFromAvailableSignals(const StringPtr& s
     {
         this->availableSignalIds.erase(it);
         remapUnavailableSignal(signalStreamingId);
+        publishSignalRoutes();
     }
     else
     {
@@ -946,6 +1024,7 @@ void StreamingImpl<Interfaces...>::startReconnection()
     // consider all signals as unavailable
     for (const auto& signalStreamingId : availableSignalIds)
         remapUnavailableSignal(signalStreamingId);
+    publishSignalRoutes();
 
     availableSignalIds.clear();
     isReconnecting = true;
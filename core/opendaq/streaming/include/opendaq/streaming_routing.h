@@ -0,0 +1,36 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Gets the version of the streaming routing state of mirrored signals.
+ *
+ * The version is incremented whenever a mirrored signal changes its streamed state or its active streaming
+ * source. Streaming objects cache whether packets of a signal are to be delivered and re-evaluate the cached
+ * decision once the version changes.
+ */
+extern "C" PUBLIC_EXPORT SizeT daqGetStreamingRoutingVersion();
+
+/*!
+ * @brief Invalidates the cached streaming routing decisions of all streaming objects.
+ */
+extern "C" PUBLIC_EXPORT void daqInvalidateStreamingRouting();
+
+END_NAMESPACE_OPENDAQ
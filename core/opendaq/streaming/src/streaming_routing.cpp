@@ -0,0 +1,18 @@
+#include <opendaq/streaming_routing.h>
+#include <atomic>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+static std::atomic<SizeT> streamingRoutingVersion{0};
+
+SizeT daqGetStreamingRoutingVersion()
+{
+    return streamingRoutingVersion.load(std::memory_order_acquire);
+}
+
+void daqInvalidateStreamingRouting()
+{
+    streamingRoutingVersion.fetch_add(1, std::memory_order_acq_rel);
+}
+
+END_NAMESPACE_OPENDAQ
@@ -687,6 +687,51 @@ TEST_F(TriggeredSubscriptionTest, UnsubscribeBySignalRemove)
     signal.remove();
 }
 
+TEST_F(TriggeredSubscriptionTest, PacketRouting)
+{
+    auto signal = createAndAddSignal("Signal");
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    signal.asPtr<IMirroredSignalPrivate>().setMirroredDataDescriptor(descriptor);
+
+    auto inputPort = InputPort(context, nullptr, "TestPort");
+    inputPort.connect(signal);
+    const auto connection = inputPort.getConnection();
+
+    EXPECT_CALL(streaming.mock(), onSetActive(true)).Times(Exactly(1));
+    streaming.ptr.setActive(true);
+
+    const auto sendPacket = [&]
+    {
+        const auto countBefore = connection.getPacketCount();
+        streaming.mock().triggerPacket("Signal", DataPacket(descriptor, 1));
+        return connection.getPacketCount() - countBefore;
+    };
+
+    // not the active streaming source of the signal
+    ASSERT_EQ(sendPacket(), 0u);
+
+    EXPECT_CALL(streaming.mock(), onSubscribeSignal(signal.getRemoteId())).Times(Exactly(1));
+    signal.setActiveStreamingSource(streaming.ptr.getConnectionString());
+    ASSERT_EQ(sendPacket(), 1u);
+    ASSERT_EQ(sendPacket(), 1u);
+
+    // cached routing decisions follow changes of the streamed flag
+    EXPECT_CALL(streaming.mock(), onUnsubscribeSignal(signal.getRemoteId())).Times(Exactly(1));
+    signal.setStreamed(false);
+    ASSERT_EQ(sendPacket(), 0u);
+
+    EXPECT_CALL(streaming.mock(), onSubscribeSignal(signal.getRemoteId())).Times(Exactly(1));
+    signal.setStreamed(true);
+    ASSERT_EQ(sendPacket(), 1u);
+
+    EXPECT_CALL(streaming.mock(), onUnsubscribeSignal(signal.getRemoteId())).Times(Exactly(1));
+    signal.deactivateStreaming();
+    ASSERT_EQ(sendPacket(), 0u);
+
+    // packets of signals not added to the streaming are ignored
+    ASSERT_NO_THROW(streaming.mock().triggerPacket("OtherSignal", DataPacket(descriptor, 1)));
+}
+
 TEST_F(TriggeredSubscriptionTest, ByMultipleStreamingSources)
 {
     auto signal = createWithImplementation<IMirroredSignalConfig, MockMirroredSignalImpl>(context, nullptr, "Signal");
@@ -62,6 +62,20 @@ DECLARE_OPENDAQ_INTERFACE(IPacketBufferBuilder, IBaseObject)
      * @param[out] buffer Returns the newly created buffer
      */
     virtual ErrCode INTERFACE_FUNC build(IPacketBuffer** buffer) = 0;
+
+    /*!
+     * @brief Gets whether the buffer memory is mapped with huge pages
+     * @param[out] useHugePages True if huge pages are requested
+     */
+    virtual ErrCode INTERFACE_FUNC getUseHugePages(Bool* useHugePages) = 0;
+
+    // [returnSelf]
+    /*!
+     * @brief Sets whether the buffer memory is mapped with huge pages
+     * @param useHugePages If true, the memory is mapped with huge pages where the platform supports them.
+     * Transparent huge pages are used if no huge pages are reserved.
+     */
+    virtual ErrCode INTERFACE_FUNC setUseHugePages(Bool useHugePages) = 0;
 };
 
 /*!@}*/
@@ -35,9 +35,13 @@ public:
 
     ErrCode INTERFACE_FUNC build(IPacketBuffer** buffer) override;
 
+    ErrCode INTERFACE_FUNC getUseHugePages(Bool* useHugePages) override;
+    ErrCode INTERFACE_FUNC setUseHugePages(Bool useHugePages) override;
+
 private:
 
     SizeT sizeInBytes;
+    Bool useHugePages;
     ContextPtr context;
 };
 
@@ -15,8 +15,11 @@
  */
 
 #pragma once
-#include <queue>
-#include <condition_variable>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <coretypes/deserializer.h>
 #include <coreobjects/core_event_args_impl.h>
 #include <coreobjects/eval_value_factory.h>
@@ -30,11 +33,19 @@
 
 BEGIN_NAMESPACE_OPENDAQ
 
+/*
+ * Ring arena from which packets are allocated in order. Releasing a packet only marks its block as released,
+ * which is lock-free and can be done from any thread. The released blocks are reclaimed in allocation order
+ * by the producers when they create packets, so blocks released out of order are reclaimed once all older
+ * blocks are released. Producers are serialized among themselves, which allows multiple signals to share
+ * one buffer.
+ */
 class PacketBufferImpl : public ImplementationOf<IPacketBuffer>
 {
 public:
 
     PacketBufferImpl(const PacketBufferBuilderPtr& builder);
+    ~PacketBufferImpl() override;
 
     ErrCode INTERFACE_FUNC createPacket(SizeT sampleCount, IDataDescriptor* desc, IPacket* domainPacket, IDataPacket** packet) override;
     ErrCode INTERFACE_FUNC resize(SizeT sizeInBytes) override;
@@ -44,13 +55,27 @@ public:
 
 protected:
 
-    ErrCode Write(size_t sizeOfPackets, void** memPos);
+    struct Block
+    {
+        size_t size;
+        std::atomic<bool> released;
+    };
+
+    // blocks are kept in slabs that are recycled, so their addresses stay valid while the packets are alive
+    static constexpr size_t BlocksPerSlab = 256;
+    using BlockSlab = std::array<Block, BlocksPerSlab>;
+
+    ErrCode Write(size_t sizeOfPackets, void** memPos, Block** block);
+    Block* allocateBlock(size_t size);
+    void reclaimBlocks();
 
-    ErrCode Read(void* beginningOfDelegatedSpace, size_t sizeOfPackets);
+    void allocateMemory(size_t size);
+    void freeMemory();
 
-    ErrCode CleanOosPackets();
+    uint8_t* data;
+    size_t mappedSize;
+    bool useHugePages;
 
-    std::vector<uint8_t> data;
     void* readPos;
     void* writePos;
     bool isFull;
@@ -60,11 +85,12 @@ protected:
 
     void* endPos;
 
-    std::mutex readWriteMutex;
-    std::condition_variable resizeSync;
+    std::mutex writeMutex;
 
-    std::priority_queue<std::pair<uint8_t*, size_t>, std::vector<std::pair<uint8_t*, size_t>>, std::greater<std::pair<uint8_t*, size_t>>>
-        oosPackets;
+    std::deque<std::unique_ptr<BlockSlab>> blockSlabs;
+    std::vector<std::unique_ptr<BlockSlab>> spareBlockSlabs;
+    size_t firstBlockIndex;
+    size_t blockCount;
 
     ContextPtr context;
 };
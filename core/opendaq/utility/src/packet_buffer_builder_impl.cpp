@@ -5,6 +5,7 @@ BEGIN_NAMESPACE_OPENDAQ
 
 PacketBufferBuilderImpl::PacketBufferBuilderImpl()
     : sizeInBytes(0)
+    , useHugePages(false)
 {
 }
 
@@ -52,6 +53,20 @@ ErrCode PacketBufferBuilderImpl::build(IPacketBuffer** buffer)
         });
 }
 
+ErrCode PacketBufferBuilderImpl::getUseHugePages(Bool* useHugePages)
+{
+    OPENDAQ_PARAM_NOT_NULL(useHugePages);
+
+    *useHugePages = this->useHugePages;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PacketBufferBuilderImpl::setUseHugePages(Bool useHugePages)
+{
+    this->useHugePages = useHugePages;
+    return OPENDAQ_SUCCESS;
+}
+
 OPENDAQ_DEFINE_CLASS_FACTORY(LIBRARY_FACTORY, PacketBufferBuilder)
 
 END_NAMESPACE_OPENDAQ
@@ -1,52 +1,140 @@
 #include <opendaq/packet_buffer_impl.h>
 #include <thread>
-#include <iostream>
+#include <cstdlib>
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+#endif
 
 BEGIN_NAMESPACE_OPENDAQ
 
 PacketBufferImpl::PacketBufferImpl(const PacketBufferBuilderPtr& builder)
+    : data(nullptr)
+    , mappedSize(0)
+    , firstBlockIndex(0)
+    , blockCount(0)
 {
-    // Here comes the init of the buffer (that means the fresh std::vector gets called here)
+    // Here comes the init of the buffer memory
     // also looks into the builder for the class
     sizeInBytes = builder.getSizeInBytes();
+    useHugePages = builder.getUseHugePages();
     context = builder.getContext();
 
-    data = std::vector<uint8_t>(sizeInBytes);
-    readPos = data.data();
-    writePos = data.data();
+    allocateMemory(sizeInBytes);
+    readPos = data;
+    writePos = data;
     isFull = false;
     underReset = false;
-    endPos = static_cast<uint8_t*>(data.data()) + sizeInBytes;
+    endPos = data + sizeInBytes;
 }
 
-ErrCode PacketBufferImpl::CleanOosPackets()
+PacketBufferImpl::~PacketBufferImpl()
 {
-    while (!oosPackets.empty())
-    { 
-        if (readPos != oosPackets.top().first)
-            break;
+    freeMemory();
+}
 
-        isFull = false;
-        readPos = static_cast<void*>(static_cast<uint8_t*>(readPos) + oosPackets.top().second);
-        oosPackets.pop();
+void PacketBufferImpl::allocateMemory(size_t size)
+{
+#if defined(__linux__)
+    if (useHugePages)
+    {
+        constexpr size_t hugePageSize = 2 * 1024 * 1024;
+        const size_t alignedSize = (size + hugePageSize - 1) / hugePageSize * hugePageSize;
+
+        void* mem = mmap(nullptr, alignedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (mem == MAP_FAILED)
+        {
+            // no huge pages are reserved, so fall back to transparent huge pages
+            mem = mmap(nullptr, alignedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (mem == MAP_FAILED)
+                DAQ_THROW_EXCEPTION(NoMemoryException, "Failed to map the packet buffer memory.");
+            madvise(mem, alignedSize, MADV_HUGEPAGE);
+        }
+
+        data = static_cast<uint8_t*>(mem);
+        mappedSize = alignedSize;
+        return;
     }
+#endif
+
+    data = static_cast<uint8_t*>(std::malloc(size > 0 ? size : 1));
+    if (!data)
+        DAQ_THROW_EXCEPTION(NoMemoryException, "Failed to allocate the packet buffer memory.");
+    mappedSize = 0;
+}
 
-    if (readPos >= static_cast<uint8_t*>(endPos))
+void PacketBufferImpl::freeMemory()
+{
+#if defined(__linux__)
+    if (mappedSize > 0)
     {
-        auto delta = static_cast<uint8_t*>(readPos) - static_cast<uint8_t*>(endPos);
-        readPos = data.data() + delta;
+        munmap(data, mappedSize);
+        data = nullptr;
+        return;
     }
+#endif
 
-    return OPENDAQ_SUCCESS;
+    std::free(data);
+    data = nullptr;
+}
+
+PacketBufferImpl::Block* PacketBufferImpl::allocateBlock(size_t size)
+{
+    const size_t index = firstBlockIndex + blockCount;
+    if (index / BlocksPerSlab == blockSlabs.size())
+    {
+        if (spareBlockSlabs.empty())
+        {
+            blockSlabs.push_back(std::make_unique<BlockSlab>());
+        }
+        else
+        {
+            blockSlabs.push_back(std::move(spareBlockSlabs.back()));
+            spareBlockSlabs.pop_back();
+        }
+    }
+
+    Block& block = (*blockSlabs[index / BlocksPerSlab])[index % BlocksPerSlab];
+    block.size = size;
+    block.released.store(false, std::memory_order_relaxed);
+    ++blockCount;
+    return &block;
 }
 
+void PacketBufferImpl::reclaimBlocks()
+{
+    while (blockCount > 0)
+    {
+        const Block& block = (*blockSlabs.front())[firstBlockIndex];
+        if (!block.released.load(std::memory_order_acquire))
+            break;
+
+        isFull = false;
+        readPos = static_cast<uint8_t*>(readPos) + block.size;
+        if (readPos >= endPos)
+        {
+            auto delta = static_cast<uint8_t*>(readPos) - static_cast<uint8_t*>(endPos);
+            readPos = data + delta;
+        }
+
+        --blockCount;
+        if (++firstBlockIndex == BlocksPerSlab)
+        {
+            spareBlockSlabs.push_back(std::move(blockSlabs.front()));
+            blockSlabs.pop_front();
+            firstBlockIndex = 0;
+        }
+    }
+}
 
-ErrCode PacketBufferImpl::Write(size_t sizeOfPackets, void** memPos)
+ErrCode PacketBufferImpl::Write(size_t sizeOfPackets, void** memPos, Block** block)
 {
+    reclaimBlocks();
+
     auto endOfBuffer = (reinterpret_cast<uint8_t*>(endPos));
     size_t availableSamples;
 
-    // Check whether R>W; 
+    // Check whether R>W;
     auto readPosWritePosDiff = (static_cast<uint8_t*>(writePos) - static_cast<uint8_t*>(readPos));
     if (readPosWritePosDiff < 0)
     {
@@ -65,22 +153,22 @@ ErrCode PacketBufferImpl::Write(size_t sizeOfPackets, void** memPos)
     }
 
     // Handle case when W>R and not enough space is available at buffer right-hand-side
-    // Create dummy packet that fills up unused buffer space; Actual write will happen on left-hand-side
+    // Create dummy block that fills up unused buffer space; Actual write will happen on left-hand-side
     if (availableSamples < sizeOfPackets)
     {
          // R>W && availableSamples < sampleCount
         if (readPosWritePosDiff < 0)
             return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "The requested packet size is not available.");
 
-        size_t beginningReadPosDiff = (static_cast<uint8_t*>(readPos) - data.data());
+        size_t beginningReadPosDiff = (static_cast<uint8_t*>(readPos) - data);
         if (sizeOfPackets > beginningReadPosDiff)
             return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "The requested packet size is not available.");
 
-        oosPackets.push(std::make_pair(static_cast<uint8_t*>(writePos), endOfBuffer - static_cast<uint8_t*>(writePos)));
-        CleanOosPackets();
+        allocateBlock(endOfBuffer - static_cast<uint8_t*>(writePos))->released.store(true, std::memory_order_relaxed);
+        reclaimBlocks();
 
-        *memPos = data.data();
-        writePos = static_cast<void*>(data.data() + sizeOfPackets);
+        *memPos = data;
+        writePos = static_cast<void*>(data + sizeOfPackets);
         if (writePos == readPos)
             isFull = true;
     }
@@ -91,34 +179,13 @@ ErrCode PacketBufferImpl::Write(size_t sizeOfPackets, void** memPos)
         writePos = static_cast<uint8_t*>(writePos) + sizeOfPackets;
 
         if (writePos == (void*) endOfBuffer)
-            writePos = data.data();
+            writePos = data;
 
         if (writePos == readPos)
             isFull = true;
     }
 
-    return OPENDAQ_SUCCESS;
-}
-
-ErrCode PacketBufferImpl::Read(void* startMemPos, size_t sizeOfPackets)
-{
-    {
-        std::unique_lock<std::mutex> lock(readWriteMutex);
-
-        auto memSize = sizeOfPackets;
-        if (startMemPos < readPos)
-        {
-            oosPackets.push(std::make_pair(static_cast<uint8_t*>(startMemPos) + sizeInBytes, memSize));
-        }
-        else
-        {
-            oosPackets.push(std::make_pair(static_cast<uint8_t*>(startMemPos), memSize));
-        }
-
-        CleanOosPackets();
-        lock.unlock();
-    }
-    resizeSync.notify_all();
+    *block = allocateBlock(sizeOfPackets);
     return OPENDAQ_SUCCESS;
 }
 
@@ -135,23 +202,27 @@ ErrCode PacketBufferImpl::createPacket(SizeT sampleCount, IDataDescriptor* desc,
     if (type != daq::DataRuleType::Explicit)
         return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDPARAMETER, "Packet Buffer supports only Explicit Rule Type packets.");
 
-    std::lock_guard<std::mutex> lock(readWriteMutex);
-    if (underReset)
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Trying to create packets while the reset procedure is underway.");
-
     size_t rawSampleSize;
     err = desc->getRawSampleSize(&rawSampleSize);
     OPENDAQ_RETURN_IF_FAILED(err);
 
     SizeT packetSize = sampleCount * rawSampleSize;
     void* startMemPos = nullptr;
+    Block* block = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        if (underReset)
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Trying to create packets while the reset procedure is underway.");
 
-    const ErrCode errCode = this->Write(packetSize, &startMemPos);
-    OPENDAQ_RETURN_IF_FAILED(errCode);
-    
-    DeleterPtr deleter = daq::Deleter([this, packetSize, startMemPos = startMemPos] (void*) mutable
+        const ErrCode errCode = this->Write(packetSize, &startMemPos, &block);
+        OPENDAQ_RETURN_IF_FAILED(errCode);
+    }
+
+    // releasing the packet only marks its block, the memory is reclaimed by the next write
+    DeleterPtr deleter = daq::Deleter([block] (void*)
     {
-        Read(startMemPos, packetSize);
+        block->released.store(true, std::memory_order_release);
     });
     *packet = daq::DataPacketWithExternalMemory(domainPacket, desc, sampleCount, startMemPos, deleter).detach();
 
@@ -160,25 +231,36 @@ ErrCode PacketBufferImpl::createPacket(SizeT sampleCount, IDataDescriptor* desc,
 
 ErrCode PacketBufferImpl::resize(SizeT sizeInBytes)
 {
-    std::unique_lock<std::mutex> lock(readWriteMutex);
-    underReset = true;
+    {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        underReset = true;
+    }
 
-    this->resizeSync.wait(lock, [this]
+    while (true)
     {
+        {
+            std::lock_guard<std::mutex> lock(writeMutex);
+            reclaimBlocks();
+            if (blockCount == 0)
+                break;
+        }
         std::this_thread::sleep_for(std::chrono::milliseconds(20));
-        return ((readPos == writePos) && (!isFull));
-    });
+    }
 
-    data.resize(sizeInBytes);
-    this->sizeInBytes = sizeInBytes;
-    readPos = data.data();
-    writePos = data.data();
-    endPos = static_cast<uint8_t*>(data.data()) + sizeInBytes;
+    std::lock_guard<std::mutex> lock(writeMutex);
+    const ErrCode errCode = daqTry([this, sizeInBytes]
+    {
+        freeMemory();
+        allocateMemory(sizeInBytes);
+    });
 
-    resizeSync.notify_all();
+    this->sizeInBytes = data ? sizeInBytes : 0;
+    readPos = data;
+    writePos = data;
+    isFull = false;
+    endPos = data + this->sizeInBytes;
     underReset = false;
-    lock.unlock();
-    return OPENDAQ_SUCCESS;
+    return errCode;
 }
 
 ErrCode PacketBufferImpl::getMaxAvailableContinousSampleCount(IDataDescriptor* desc, SizeT* count)
@@ -186,13 +268,16 @@ ErrCode PacketBufferImpl::getMaxAvailableContinousSampleCount(IDataDescriptor* d
     OPENDAQ_PARAM_NOT_NULL(desc);
     OPENDAQ_PARAM_NOT_NULL(count);
 
-    auto fromEndToPos = static_cast<uint8_t*>(endPos) - static_cast<uint8_t*>(writePos);
-    auto fromStartToPos = static_cast<uint8_t*>(readPos) - static_cast<uint8_t*>(data.data());
-
     SizeT rawSampleSize;
     ErrCode err = desc->getRawSampleSize(&rawSampleSize);
     OPENDAQ_RETURN_IF_FAILED(err);
 
+    std::lock_guard<std::mutex> lock(writeMutex);
+    reclaimBlocks();
+
+    auto fromEndToPos = static_cast<uint8_t*>(endPos) - static_cast<uint8_t*>(writePos);
+    auto fromStartToPos = static_cast<uint8_t*>(readPos) - data;
+
     *count = (fromStartToPos <= fromEndToPos) ? (fromEndToPos/rawSampleSize) : (fromStartToPos/rawSampleSize);
 
     if (writePos == readPos && isFull)
@@ -213,6 +298,9 @@ ErrCode PacketBufferImpl::getAvailableSampleCount(IDataDescriptor* desc, SizeT*
     ErrCode err = desc->getRawSampleSize(&rawSampleSize);
     OPENDAQ_RETURN_IF_FAILED(err);
 
+    std::lock_guard<std::mutex> lock(writeMutex);
+    reclaimBlocks();
+
     auto fromEndToPos = static_cast<uint8_t*>(endPos) - static_cast<uint8_t*>(readPos);
 
     *count = fromEndToPos/rawSampleSize;
@@ -10,6 +10,7 @@
 #include <opendaq/sample_type_traits.h>
 
 #include <chrono>
+#include <cstring>
 
 using namespace daq;
 
@@ -365,3 +366,61 @@ TEST_F(PacketBufferTest, FullDynamicFunctionallityWorkflow)
 
     ASSERT_EQ(buffer.getMaxAvailableContinousSampleCount(desc), 80u);
 }
+
+TEST_F(PacketBufferTest, ReleaseOutOfOrderFromOtherThreads)
+{
+    auto buffer = PacketBufferBuilder().setSizeInBytes(800).build();
+
+    auto [desc, domain] = generateBuildingBlocks();
+    const auto otherDesc = DataDescriptorBuilder().setSampleType(SampleType::Int32).build();
+
+    // packets of different signals share the buffer
+    std::vector<DataPacketPtr> packets;
+    for (int i = 0; i < 4; i++)
+    {
+        packets.push_back(buffer.createPacket(10, desc, domain));
+        packets.push_back(buffer.createPacket(25, otherDesc, domain));
+    }
+    ASSERT_THROW(buffer.createPacket(1, desc, domain), BufferFullException);
+
+    // the blocks released before the oldest one are reclaimed together with it
+    std::vector<std::thread> threads;
+    for (size_t i = packets.size() - 1; i > 0; i--)
+        threads.emplace_back([packet = std::move(packets[i])]() mutable { packet.release(); });
+    for (auto& thread : threads)
+        thread.join();
+    ASSERT_EQ(buffer.getAvailableSampleCount(desc), 0u);
+
+    packets[0].release();
+    ASSERT_EQ(buffer.getAvailableSampleCount(desc), 80u);
+}
+
+TEST_F(PacketBufferTest, ManyPackets)
+{
+    auto buffer = PacketBufferBuilder().setSizeInBytes(1000).build();
+
+    auto [desc, domain] = generateBuildingBlocks();
+
+    for (int i = 0; i < 10000; i++)
+    {
+        auto packet = buffer.createPacket(3, desc, domain);
+        ASSERT_NE(packet.getRawData(), nullptr);
+    }
+
+    // 33 packets fit into one round of the buffer, so the last one is the first of a round and ends at offset 30
+    ASSERT_EQ(buffer.getMaxAvailableContinousSampleCount(desc), 97u);
+}
+
+TEST_F(PacketBufferTest, HugePages)
+{
+    auto buffer = PacketBufferBuilder().setSizeInBytes(800).setUseHugePages(true).build();
+
+    auto [desc, domain] = generateBuildingBlocks();
+
+    {
+        auto packet = buffer.createPacket(80, desc, domain);
+        std::memset(packet.getRawData(), 0xFF, 800);
+    }
+
+    ASSERT_EQ(buffer.getAvailableSampleCount(desc), 80u);
+}
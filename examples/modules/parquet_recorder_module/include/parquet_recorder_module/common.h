@@ -64,6 +64,42 @@ struct Props
      * This property can be set to `true` to stop recording and `false` to keep it active.
      */
     static constexpr const char* StopRecording = "StopRecording";
+    /*!
+     * @brief The maximum number of samples written into a single row group.
+     *
+     * Samples of a signal are collected until one of the row group limits is reached and are then
+     * written to the file at once, so files consist of few large row groups instead of one per packet.
+     */
+    static constexpr const char* RowGroupSampleCount = "RowGroupSampleCount";
+    /*!
+     * @brief The maximum size of a row group in bytes, not taking compression into account.
+     *
+     * The value 0 disables the limit.
+     */
+    static constexpr const char* RowGroupMaxBytes = "RowGroupMaxBytes";
+    /*!
+     * @brief The longest time in milliseconds samples are collected before they are written to the file.
+     *
+     * Bounds the amount of data lost if the process terminates unexpectedly. The value 0 disables the limit.
+     */
+    static constexpr const char* RowGroupMaxDuration = "RowGroupMaxDuration";
+    /*!
+     * @brief The compression codec of the written columns.
+     *
+     * Codecs the Parquet library was built without fall back to uncompressed columns.
+     */
+    static constexpr const char* Compression = "Compression";
+    /*!
+     * @brief Whether the columns are dictionary encoded.
+     */
+    static constexpr const char* UseDictionary = "UseDictionary";
+    /*!
+     * @brief The maximum number of packets waiting to be written per signal.
+     *
+     * Packets are written by a dedicated thread, so recording does not block the acquisition. If the
+     * thread falls behind by more than this number of packets, further data packets are dropped.
+     */
+    static constexpr const char* WriteQueueMaxPackets = "WriteQueueMaxPackets";
 };
 
 END_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
@@ -20,17 +20,17 @@
 #include <memory>
 #include <unordered_map>
 #include <optional>
+#include <vector>
 
 #include <coretypes/filesystem.h>
 #include <opendaq/function_block_impl.h>
 #include <opendaq/opendaq.h>
 
 #include <parquet_recorder_module/common.h>
+#include <parquet_recorder_module/parquet_writer.h>
 
 BEGIN_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
 
-class ParquetWriter;
-
 /*!
  * @brief A function block recording data from its input signals into a Parquet
  *     file.
@@ -39,7 +39,9 @@ class ParquetWriter;
  * via a property. Recording can be started and stopped by calling member functions or by setting
  * a property. Signals can be dynamically connected and disconnected.
  *
- * Packet handling takes place in scheduled tasks.
+ * Packets are written by a dedicated thread per recorded signal and are collected into large row groups.
+ * The row group limits, compression and write queue length are taken from the properties when the
+ * writers are created, i.e. changes take effect the next time recording is started.
  */
 class ParquetRecorderImpl final : public FunctionBlockImpl<IFunctionBlock, IRecorder>
 {
@@ -111,12 +113,15 @@ protected:
 private:
     void addProperties();
     void addInputPort();
+    void onPathChanged();
     void reconfigure();
     void clearWriters();
-    std::shared_ptr<ParquetWriter> findWriterForSignal(IInputPort* port);
+    void destroyReleasedWriters();
+    ParquetWriterOptions getWriterOptions();
 
     std::unordered_map<IInputPort*, std::shared_ptr<ParquetWriter>> writers;
-    SchedulerPtr scheduler;
+    // Writers removed from the map; destroyed by destroyReleasedWriters, never on the acquisition thread.
+    std::vector<std::shared_ptr<ParquetWriter>> releasedWriters;
     std::atomic_uint32_t portCount = 0;
     std::atomic_bool recording = false;
     std::optional<fs::path> cachedPath;
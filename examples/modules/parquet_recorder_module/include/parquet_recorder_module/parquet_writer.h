@@ -16,7 +16,12 @@
 
 #pragma once
 
-#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <opendaq/opendaq.h>
 #include <coretypes/filesystem.h>
@@ -33,6 +38,7 @@ namespace parquet
 
 namespace arrow
 {
+    class ArrayBuilder;
     class Schema;
     namespace io
     {
@@ -42,12 +48,41 @@ namespace arrow
 
 BEGIN_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
 
+/*!
+ * @brief Compression codecs selectable for the written columns, in the order of the `Compression` property selection.
+ */
+enum class CompressionCodec
+{
+    Uncompressed = 0,
+    Snappy,
+    Gzip,
+    Zstd
+};
+
+/*!
+ * @brief Settings controlling how a ParquetWriter lays out its file.
+ */
+struct ParquetWriterOptions
+{
+    size_t rowGroupSampleCount = 1'000'000;
+    size_t rowGroupMaxBytes = 0;
+    std::chrono::milliseconds rowGroupMaxDuration{0};
+    CompressionCodec compression = CompressionCodec::Uncompressed;
+    bool useDictionary = true;
+    size_t writeQueueMaxPackets = 10'000;
+};
+
+/*!
+ * @brief Records the packets of a single signal into a Parquet file.
+ *
+ * Packets are handed over to a dedicated writer thread, so enqueuing them never waits on file I/O.
+ * Samples are collected in column builders that are reused across row groups, and a row group is written
+ * once one of the limits in ParquetWriterOptions is reached.
+ */
 class ParquetWriter
 {
 public:
-    static constexpr const size_t PACKET_BUFFER_SIZE_TO_WRITE = 10;
-
-    ParquetWriter(fs::path path, SignalPtr signal, daq::LoggerComponentPtr logger_component, daq::SchedulerPtr scheduler);
+    ParquetWriter(fs::path path, SignalPtr signal, daq::LoggerComponentPtr logger_component, ParquetWriterOptions options = {});
     ~ParquetWriter();
 
     void enqueuePacketList(ListPtr<IPacket>& packets);
@@ -56,22 +91,30 @@ private:
     fs::path path;
     SignalPtr signal;
     daq::LoggerComponentPtr loggerComponent;
-    daq::SchedulerPtr scheduler;
+    ParquetWriterOptions options;
     std::string filename;
 
-    std::mutex mutex;
+    // accessed only by the writer thread
     std::shared_ptr<arrow::Schema> schema;
     std::shared_ptr<arrow::io::FileOutputStream> outfile;
     std::unique_ptr<parquet::arrow::FileWriter> writer;
     DataDescriptorPtr currentDataDescriptor;
     DataDescriptorPtr currentDomainDescriptor;
+    std::unique_ptr<arrow::ArrayBuilder> domainBuilder;
+    std::unique_ptr<arrow::ArrayBuilder> sampleBuilder;
+    size_t bufferedRows = 0;
+    size_t bufferedBytes = 0;
+    std::chrono::steady_clock::time_point rowGroupStart;
 
-    std::vector<PacketPtr> packetBuffer;
-    std::mutex packetBufferMutex;
+    std::vector<PacketPtr> packetQueue;
+    std::mutex packetQueueMutex;
+    std::condition_variable packetQueueCondition;
+    size_t droppedPacketCount = 0;
+    bool stopRequested = false;
 
-    std::atomic_bool isClosing = false;
+    std::thread writerThread;
 
-    std::vector<PacketPtr> dequeuePacketList();
+    void writerThreadLoop();
     void processPacketList(const std::vector<PacketPtr>& packets);
 
     void onPacket(const PacketPtr& packet);
@@ -81,9 +124,14 @@ private:
     void configure(const DataDescriptorPtr& dataDescriptor, const DataDescriptorPtr& domainDescriptor);
     void reconfigure(const DataDescriptorPtr& dataDescriptor, const DataDescriptorPtr& domainDescriptor);
     void generateMetadata(const DataDescriptorPtr& dataDescriptor, const DataDescriptorPtr& domainDescriptor);
+    void createBuilders();
+    void reserveBuilders();
     void openFile();
     void closeFile();
 
+    bool isRowGroupDue() const;
+    void flushRowGroup();
+
     template <typename TDataType, typename TDomainType>
     void writePackets(const DataPacketPtr& data, const DataPacketPtr& domain);
     template <typename TDataType>
@@ -91,4 +139,4 @@ private:
     void writePackets(const DataPacketPtr& data, const DataPacketPtr& domain);
 };
 
-END_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
\ No newline at end of file
+END_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
@@ -1,12 +1,12 @@
 #include <parquet_recorder_module/parquet_recorder_impl.h>
 
+#include <chrono>
 #include <functional>
 #include <string>
 
 #include <coreobjects/callable_info_factory.h>
 
 #include <parquet_recorder_module/common.h>
-#include <parquet_recorder_module/parquet_writer.h>
 
 BEGIN_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
 
@@ -23,38 +23,38 @@ ParquetRecorderImpl::ParquetRecorderImpl(const ContextPtr& context,
     , cachedPath(std::nullopt)
 {
     tags.add(Tags::Recorder);
-    scheduler = context.getScheduler();
 
     if (loggerComponent.assigned())
         loggerComponent.setLevel(LogLevel::Trace);
 
-    if (!scheduler.assigned())
-    {
-        throw InvalidParameterException("ParquetRecorderImpl: Scheduler must be assigned for recording to work");
-    }
-
     addInputPort();
     addProperties();
 }
 
 ParquetRecorderImpl::~ParquetRecorderImpl()
 {
-    auto lock = getRecursiveConfigLock();
-    clearWriters();
+    {
+        auto lock = getRecursiveConfigLock();
+        clearWriters();
+    }
+    destroyReleasedWriters();
 }
 
 ErrCode ParquetRecorderImpl::startRecording()
 {
     LOG_D("ParquetRecorderImpl::startRecording: Starting recording...");
-    auto lock = getRecursiveConfigLock();
-    if (recording)
     {
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Recording is already active.");
-    }
+        auto lock = getRecursiveConfigLock();
+        if (recording)
+        {
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Recording is already active.");
+        }
 
-    recording = true;
+        recording = true;
 
-    reconfigure();
+        reconfigure();
+    }
+    destroyReleasedWriters();
 
     return OPENDAQ_SUCCESS;
 }
@@ -62,14 +62,17 @@ ErrCode ParquetRecorderImpl::startRecording()
 ErrCode ParquetRecorderImpl::stopRecording()
 {
     LOG_D("ParquetRecorderImpl::stopRecording: Stopping recording...");
-    auto lock = getRecursiveConfigLock();
-    if (!recording)
     {
-        return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Recording is not active.");
-    }
+        auto lock = getRecursiveConfigLock();
+        if (!recording)
+        {
+            return DAQ_MAKE_ERROR_INFO(OPENDAQ_ERR_INVALIDSTATE, "Recording is not active.");
+        }
 
-    recording = false;
-    clearWriters();
+        recording = false;
+        clearWriters();
+    }
+    destroyReleasedWriters();
 
     return OPENDAQ_SUCCESS;
 }
@@ -87,19 +90,23 @@ ErrCode ParquetRecorderImpl::getIsRecording(Bool* isRecording)
 void ParquetRecorderImpl::onConnected(const InputPortPtr& port)
 {
     LOG_D("ParquetRecorderImpl::onConnected: Input port connected: {}", port.getName());
-    auto lock = getRecursiveConfigLock();
-    addInputPort();
-    reconfigure();
+    {
+        auto lock = getRecursiveConfigLock();
+        addInputPort();
+        reconfigure();
+    }
+    destroyReleasedWriters();
 }
 
 void ParquetRecorderImpl::onDisconnected(const InputPortPtr& port)
 {
     LOG_D("ParquetRecorderImpl::onDisconnected: Input port disconnected: {}", port.getName());
-    auto lock = getRecursiveConfigLock();
-
-    removeInputPort(port);
-
-    reconfigure();
+    {
+        auto lock = getRecursiveConfigLock();
+        removeInputPort(port);
+        reconfigure();
+    }
+    destroyReleasedWriters();
 }
 
 void ParquetRecorderImpl::activeChanged()
@@ -112,20 +119,22 @@ void ParquetRecorderImpl::onPacketReceived(const InputPortPtr& port)
     if (!active || !recording)
         return;
 
-    auto writer = findWriterForSignal(port);
     auto list = port.getConnection().dequeueAll();
-
-    if (!writer || !list.assigned())
+    if (!list.assigned())
         return;
 
-    writer->enqueuePacketList(list);
+    // Enqueuing never blocks, so the writer is used under the lock instead of being copied out of the map.
+    // The acquisition thread thus never holds the last reference and never runs ~ParquetWriter.
+    auto lock = getAcquisitionLock();
+    if (auto it = writers.find(port.getObject()); it != writers.end())
+        it->second->enqueuePacketList(list);
 }
 
 void ParquetRecorderImpl::addProperties()
 {
     objPtr.addProperty(StringProperty(Props::Path, ""));
 
-    objPtr.getOnPropertyValueWrite(Props::Path) += std::bind(&ParquetRecorderImpl::reconfigure, this);
+    objPtr.getOnPropertyValueWrite(Props::Path) += std::bind(&ParquetRecorderImpl::onPathChanged, this);
 
     const auto startRecordingProp = FunctionProperty(Props::StartRecording, ProcedureInfo());
     objPtr.addProperty(startRecordingProp);
@@ -134,6 +143,55 @@ void ParquetRecorderImpl::addProperties()
     const auto stopRecordingProp = FunctionProperty(Props::StopRecording, ProcedureInfo());
     objPtr.addProperty(stopRecordingProp);
     objPtr.setPropertyValue(Props::StopRecording, Procedure([this] { this->stopRecording(); }));
+
+    const ParquetWriterOptions defaultOptions;
+
+    const auto rowGroupSampleCountProp =
+        IntPropertyBuilder(Props::RowGroupSampleCount, static_cast<Int>(defaultOptions.rowGroupSampleCount))
+            .setMinValue(1)
+            .setDescription("Maximum number of samples written into a single row group.")
+            .build();
+    objPtr.addProperty(rowGroupSampleCountProp);
+
+    const auto rowGroupMaxBytesProp = IntPropertyBuilder(Props::RowGroupMaxBytes, static_cast<Int>(defaultOptions.rowGroupMaxBytes))
+                                          .setMinValue(0)
+                                          .setUnit(Unit("B"))
+                                          .setDescription("Maximum uncompressed size of a single row group. 0 disables the limit.")
+                                          .build();
+    objPtr.addProperty(rowGroupMaxBytesProp);
+
+    const auto rowGroupMaxDurationProp =
+        IntPropertyBuilder(Props::RowGroupMaxDuration, static_cast<Int>(defaultOptions.rowGroupMaxDuration.count()))
+            .setMinValue(0)
+            .setUnit(Unit("ms"))
+            .setDescription("Longest time samples are collected before they are written to the file. 0 disables the limit.")
+            .build();
+    objPtr.addProperty(rowGroupMaxDurationProp);
+
+    objPtr.addProperty(SelectionProperty(Props::Compression,
+                                         List<IString>("Uncompressed", "Snappy", "Gzip", "Zstd"),
+                                         static_cast<Int>(defaultOptions.compression)));
+
+    objPtr.addProperty(BoolProperty(Props::UseDictionary, defaultOptions.useDictionary));
+
+    const auto writeQueueMaxPacketsProp =
+        IntPropertyBuilder(Props::WriteQueueMaxPackets, static_cast<Int>(defaultOptions.writeQueueMaxPackets))
+            .setMinValue(1)
+            .setDescription("Maximum number of packets per signal waiting to be written. Further data packets are dropped.")
+            .build();
+    objPtr.addProperty(writeQueueMaxPacketsProp);
+}
+
+ParquetWriterOptions ParquetRecorderImpl::getWriterOptions()
+{
+    ParquetWriterOptions options;
+    options.rowGroupSampleCount = static_cast<Int>(objPtr.getPropertyValue(Props::RowGroupSampleCount));
+    options.rowGroupMaxBytes = static_cast<Int>(objPtr.getPropertyValue(Props::RowGroupMaxBytes));
+    options.rowGroupMaxDuration = std::chrono::milliseconds(static_cast<Int>(objPtr.getPropertyValue(Props::RowGroupMaxDuration)));
+    options.compression = static_cast<CompressionCodec>(static_cast<Int>(objPtr.getPropertyValue(Props::Compression)));
+    options.useDictionary = static_cast<Bool>(objPtr.getPropertyValue(Props::UseDictionary));
+    options.writeQueueMaxPackets = static_cast<Int>(objPtr.getPropertyValue(Props::WriteQueueMaxPackets));
+    return options;
 }
 
 void ParquetRecorderImpl::addInputPort()
@@ -142,6 +200,12 @@ void ParquetRecorderImpl::addInputPort()
     auto c = createAndAddInputPort("Value" + std::to_string(portCount.fetch_add(1)), PacketReadyNotification::SameThread);
 }
 
+void ParquetRecorderImpl::onPathChanged()
+{
+    reconfigure();
+    destroyReleasedWriters();
+}
+
 void ParquetRecorderImpl::reconfigure()
 {
     LOG_D("ParquetRecorderImpl::reconfigure: Reconfiguring ParquetRecorder...");
@@ -157,11 +221,12 @@ void ParquetRecorderImpl::reconfigure()
     if (!recording)
     {
         // Do not keep writers when not recording.
-        writers.clear();
+        clearWriters();
         return;
     }
 
     std::unordered_set<IInputPort*> ports;
+    std::optional<ParquetWriterOptions> options;
 
     auto inputPorts = borrowPtr<FunctionBlockPtr>().getInputPorts();
     for (const auto& inputPort : inputPorts)
@@ -176,10 +241,15 @@ void ParquetRecorderImpl::reconfigure()
             auto it = writers.find(inputPort.getObject());
             if (it == writers.end() || pathChanged)
             {
-                // Might take a long time to stop the existing writer and create a new one.
-                writers.insert_or_assign(
-                    inputPort.getObject(),
-                    std::make_shared<ParquetWriter>(path, signal, loggerComponent, context.getScheduler()));
+                if (!options.has_value())
+                    options = getWriterOptions();
+
+                if (it != writers.end())
+                    releasedWriters.push_back(std::move(it->second));
+
+                // Might take a long time to create a new writer.
+                writers.insert_or_assign(inputPort.getObject(),
+                                         std::make_shared<ParquetWriter>(path, signal, loggerComponent, options.value()));
             }
         }
     }
@@ -189,7 +259,10 @@ void ParquetRecorderImpl::reconfigure()
     while (it != writers.end())
     {
         if (ports.find(it->first) == ports.end())
+        {
+            releasedWriters.push_back(std::move(it->second));
             it = writers.erase(it);
+        }
         else
             ++it;
     }
@@ -198,15 +271,23 @@ void ParquetRecorderImpl::reconfigure()
 void ParquetRecorderImpl::clearWriters()
 {
     LOG_D("ParquetRecorderImpl::clearWriters: Clearing all Parquet writers...");
+    for (auto& [port, writer] : writers)
+        releasedWriters.push_back(std::move(writer));
     writers.clear();
 }
 
-std::shared_ptr<ParquetWriter> ParquetRecorderImpl::findWriterForSignal(IInputPort* port)
+void ParquetRecorderImpl::destroyReleasedWriters()
 {
-    auto lock = getAcquisitionLock();
-    if (auto it = writers.find(port); it != writers.end())
-        return it->second;
-    return nullptr;
+    std::vector<std::shared_ptr<ParquetWriter>> released;
+    {
+        auto lock = getRecursiveConfigLock();
+        std::swap(released, releasedWriters);
+    }
+
+    // Stopping a writer joins its thread and closes its file, so it is done outside of the lock.
+    if (!released.empty())
+        LOG_D("ParquetRecorderImpl::destroyReleasedWriters: Stopping {} Parquet writers...", released.size());
+    released.clear();
 }
 
 END_NAMESPACE_OPENDAQ_PARQUET_RECORDER_MODULE
@@ -4,10 +4,10 @@
 
 #include <opendaq/custom_log.h>
 #include <opendaq/event_packet_params.h>
-#include <opendaq/work_factory.h>
 
 #include <arrow/api.h>
 #include <arrow/io/file.h>
+#include <arrow/util/compression.h>
 #include <parquet/arrow/writer.h>
 
 #include <parquet_recorder_module/type_resolver.h>
@@ -48,23 +48,88 @@ static std::string getFilename(const fs::path& path, const SignalPtr& signal)
     return retPath.string();
 }
 
-ParquetWriter::ParquetWriter(fs::path path, SignalPtr signal, daq::LoggerComponentPtr logger_component, daq::SchedulerPtr scheduler)
+static arrow::Compression::type toArrowCompression(CompressionCodec codec)
+{
+    switch (codec)
+    {
+        case CompressionCodec::Snappy:
+            return arrow::Compression::SNAPPY;
+        case CompressionCodec::Gzip:
+            return arrow::Compression::GZIP;
+        case CompressionCodec::Zstd:
+            return arrow::Compression::ZSTD;
+        case CompressionCodec::Uncompressed:
+        default:
+            return arrow::Compression::UNCOMPRESSED;
+    }
+}
+
+ParquetWriter::ParquetWriter(fs::path path, SignalPtr signal, daq::LoggerComponentPtr logger_component, ParquetWriterOptions options)
     : path(std::move(path))
     , signal(std::move(signal))
     , loggerComponent(std::move(logger_component))
-    , scheduler(std::move(scheduler))
+    , options(options)
     , filename(getFilename(this->path, this->signal))
 {
-    packetBuffer.reserve(PACKET_BUFFER_SIZE_TO_WRITE);
+    this->options.rowGroupSampleCount = std::max<size_t>(this->options.rowGroupSampleCount, 1);
+    packetQueue.reserve(std::min<size_t>(this->options.writeQueueMaxPackets, 1024));
+
+    writerThread = std::thread([this] { writerThreadLoop(); });
 }
 
 ParquetWriter::~ParquetWriter()
 {
-    isClosing = true;
-    scheduler.waitAll();
-    std::lock_guard bufferLock(packetBufferMutex);
-    std::lock_guard lock(mutex);
-    closeFile();
+    {
+        std::lock_guard lock(packetQueueMutex);
+        stopRequested = true;
+    }
+    packetQueueCondition.notify_one();
+
+    if (writerThread.joinable())
+        writerThread.join();
+}
+
+void ParquetWriter::writerThreadLoop()
+{
+    std::vector<PacketPtr> packets;
+    packets.reserve(packetQueue.capacity());
+
+    std::unique_lock lock(packetQueueMutex);
+    while (true)
+    {
+        const auto hasWork = [this] { return !packetQueue.empty() || stopRequested; };
+        if (bufferedRows > 0 && options.rowGroupMaxDuration.count() > 0)
+            packetQueueCondition.wait_until(lock, rowGroupStart + options.rowGroupMaxDuration, hasWork);
+        else
+            packetQueueCondition.wait(lock, hasWork);
+
+        std::swap(packets, packetQueue);
+        const size_t droppedCount = std::exchange(droppedPacketCount, 0);
+        const bool stopping = stopRequested;
+        lock.unlock();
+
+        if (droppedCount > 0)
+            LOG_W("ParquetWriter: Write queue of {} is full, dropped {} data packets", filename, droppedCount);
+
+        try
+        {
+            processPacketList(packets);
+            if (isRowGroupDue())
+                flushRowGroup();
+            if (stopping)
+                closeFile();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_E("ParquetWriter::writerThreadLoop: Exception while processing packet list: {}", e.what());
+        }
+        packets.clear();
+
+        if (stopping)
+            return;
+
+        lock.lock();
+    }
 }
 
 void ParquetWriter::onPacket(const PacketPtr& packet)
@@ -207,8 +272,8 @@ void ParquetWriter::writePackets(const DataPacketPtr& data, const DataPacketPtr&
 template <typename TDataType, typename TDomainType>
 void ParquetWriter::writePackets(const DataPacketPtr& data, const DataPacketPtr& domain)
 {
-    typename ArrowTypeResolver<TDataType>::BuilderType sampleBuilder;
-    typename ArrowTypeResolver<TDomainType>::BuilderType domainBuilder;
+    using SampleBuilderType = typename ArrowTypeResolver<TDataType>::BuilderType;
+    using DomainBuilderType = typename ArrowTypeResolver<TDomainType>::BuilderType;
 
     if (!data.assigned())
     {
@@ -216,38 +281,85 @@ void ParquetWriter::writePackets(const DataPacketPtr& data, const DataPacketPtr&
         return;
     }
 
-    auto status = sampleBuilder.AppendValues(static_cast<TDataType*>(data.getData()), data.getSampleCount());
-    if(!status.ok()) {
-        LOG_E("Failed to append sample values: {}", status.ToString());
+    if (!writer || !sampleBuilder || !domainBuilder)
+    {
+        LOG_E("Writer for {} is not initialized", filename);
         return;
     }
 
-    if (domain.assigned())
+    const size_t sampleCount = data.getSampleCount();
+    const size_t domainCount = domain.assigned() ? domain.getSampleCount() : sampleCount;
+
+    if (sampleCount != domainCount)
     {
-        status = domainBuilder.AppendValues(static_cast<TDomainType*>(domain.getData()), domain.getSampleCount());
-        if(!status.ok()) {
-            LOG_E("Failed to append domain values: {}", status.ToString());
+        LOG_E("Sample count ({}) does not match domain count ({}), cannot write to Parquet file", sampleCount, domainCount);
+        return;
+    }
+
+    auto& samples = static_cast<SampleBuilderType&>(*sampleBuilder);
+    auto& domains = static_cast<DomainBuilderType&>(*domainBuilder);
+
+    const auto* sampleValues = static_cast<const TDataType*>(data.getData());
+    const auto* domainValues = domain.assigned() ? static_cast<const TDomainType*>(domain.getData()) : nullptr;
+
+    // split the packet where a row group is full, so row groups hold exactly the configured number of rows
+    size_t offset = 0;
+    while (offset < sampleCount)
+    {
+        const size_t count = std::min(sampleCount - offset, options.rowGroupSampleCount - bufferedRows);
+
+        auto status = samples.AppendValues(sampleValues + offset, count);
+        if (!status.ok())
+        {
+            LOG_E("Failed to append sample values: {}", status.ToString());
             return;
         }
-    } else {
-        status = domainBuilder.AppendNulls(data.getSampleCount());
-        if(!status.ok()) {
-            LOG_E("Failed to append null domain values: {}", status.ToString());
+
+        status = domainValues ? domains.AppendValues(domainValues + offset, count) : domains.AppendNulls(count);
+        if (!status.ok())
+        {
+            LOG_E("Failed to append domain values: {}", status.ToString());
             return;
         }
+
+        if (bufferedRows == 0)
+            rowGroupStart = std::chrono::steady_clock::now();
+        bufferedRows += count;
+        bufferedBytes += count * (sizeof(TDataType) + sizeof(TDomainType));
+        offset += count;
+
+        if (isRowGroupDue())
+            flushRowGroup();
     }
 
-    const auto sampleCount = data.getSampleCount();
-    const auto domainCount = domain.assigned() ? domain.getSampleCount() : sampleCount;
+    LOG_T("ParquetWriter::writePackets: Buffered packet with ID: {} and sample count: {}", data.getPacketId(), sampleCount);
+}
 
-    if (sampleCount != domainCount)
-    {
-        LOG_E("Sample count ({}) does not match domain count ({}), cannot write to Parquet file", sampleCount, domainCount);
+bool ParquetWriter::isRowGroupDue() const
+{
+    if (bufferedRows == 0)
+        return false;
+    if (bufferedRows >= options.rowGroupSampleCount)
+        return true;
+    if (options.rowGroupMaxBytes > 0 && bufferedBytes >= options.rowGroupMaxBytes)
+        return true;
+    if (options.rowGroupMaxDuration.count() > 0 && std::chrono::steady_clock::now() - rowGroupStart >= options.rowGroupMaxDuration)
+        return true;
+    return false;
+}
+
+void ParquetWriter::flushRowGroup()
+{
+    if (bufferedRows == 0 || !sampleBuilder || !domainBuilder)
         return;
-    }
 
-    auto samples = sampleBuilder.Finish().ValueOr(nullptr);
-    auto domains = domainBuilder.Finish().ValueOr(nullptr);
+    const auto rows = static_cast<int64_t>(bufferedRows);
+    bufferedRows = 0;
+    bufferedBytes = 0;
+
+    auto domains = domainBuilder->Finish().ValueOr(nullptr);
+    auto samples = sampleBuilder->Finish().ValueOr(nullptr);
+    reserveBuilders();
 
     if (!domains)
     {
@@ -260,29 +372,57 @@ void ParquetWriter::writePackets(const DataPacketPtr& data, const DataPacketPtr&
         return;
     }
 
-    auto batch = arrow::RecordBatch::Make(schema, sampleCount, {domains, samples});
+    if (!writer)
+    {
+        LOG_E("Writer for {} is not initialized", filename);
+        return;
+    }
 
-    if (!batch)
+    auto table = arrow::Table::Make(schema, {domains, samples}, rows);
+    auto status = writer->WriteTable(*table, rows);
+    if (!status.ok())
     {
-        LOG_E("Failed to create RecordBatch for Parquet file");
+        LOG_E("Failed to write row group to Parquet file: {}", status.ToString());
         return;
     }
 
-    if (writer)
+    LOG_D("ParquetWriter::flushRowGroup: Wrote row group with {} rows to {}", rows, filename);
+}
+
+void ParquetWriter::createBuilders()
+{
+    sampleBuilder.reset();
+    domainBuilder.reset();
+    bufferedRows = 0;
+    bufferedBytes = 0;
+
+    if (!schema)
+        return;
+
+    domainBuilder = arrow::MakeBuilder(schema->field(0)->type()).ValueOr(nullptr);
+    sampleBuilder = arrow::MakeBuilder(schema->field(1)->type()).ValueOr(nullptr);
+    if (!domainBuilder || !sampleBuilder)
     {
-        status = writer->WriteRecordBatch(*batch);
-        if (!status.ok())
-        {
-            LOG_E("Failed to write record batch to Parquet file: {}", status.ToString());
-        }
-        else
-        {
-            LOG_D("ParquetWriter::writePackets: Successfully wrote record batch with ID: {} and sample count: {}", data.getPacketId(), sampleCount);
-        }
+        LOG_E("Failed to create column builders for Parquet file");
+        return;
     }
-    else
+
+    reserveBuilders();
+}
+
+void ParquetWriter::reserveBuilders()
+{
+    // row groups limited only by time or size are bounded by the initial reservation to keep idle writers small
+    constexpr size_t maxReservedRows = 1 << 20;
+    const auto rows = static_cast<int64_t>(std::min(options.rowGroupSampleCount, maxReservedRows));
+
+    for (auto* builder : {domainBuilder.get(), sampleBuilder.get()})
     {
-        LOG_E("Writer for {} is not initialized", filename);
+        if (!builder)
+            continue;
+        auto status = builder->Reserve(rows);
+        if (!status.ok())
+            LOG_W("Failed to reserve {} rows in column builder: {}", rows, status.ToString());
     }
 }
 
@@ -364,7 +504,20 @@ void ParquetWriter::openFile()
         auto arrowPropertiesBuilder = parquet::ArrowWriterProperties::Builder();
         arrowPropertiesBuilder.store_schema();
 
+        auto compression = toArrowCompression(options.compression);
+        if (!arrow::util::Codec::IsAvailable(compression))
+        {
+            LOG_W("Compression codec {} is not available, writing uncompressed columns", arrow::util::Codec::GetCodecAsString(compression));
+            compression = arrow::Compression::UNCOMPRESSED;
+        }
+
         auto writerPropertiesBuilder = parquet::WriterProperties::Builder();
+        writerPropertiesBuilder.max_row_group_length(static_cast<int64_t>(options.rowGroupSampleCount));
+        writerPropertiesBuilder.compression(compression);
+        if (options.useDictionary)
+            writerPropertiesBuilder.enable_dictionary();
+        else
+            writerPropertiesBuilder.disable_dictionary();
 
         // Create Parquet FileWriter
         writer = parquet::arrow::FileWriter::Open(
@@ -379,6 +532,7 @@ void ParquetWriter::openFile()
 void ParquetWriter::closeFile()
 {
     LOG_D("ParquetWriter::closeFile: Closing Parquet file and writer");
+    flushRowGroup();
     if (writer)
     {
         auto status = writer->Close();
@@ -403,6 +557,7 @@ void ParquetWriter::configure(const DataDescriptorPtr& dataDescriptor, const Dat
 {
     LOG_D("ParquetWriter::configure: Configuring ParquetWriter with data and domain descriptors");
     generateMetadata(dataDescriptor, domainDescriptor);
+    createBuilders();
     openFile();
 }
 
@@ -427,39 +582,25 @@ void ParquetWriter::reconfigure(const DataDescriptorPtr& dataDescriptor, const D
 
 void ParquetWriter::enqueuePacketList(ListPtr<IPacket>& packets)
 {
-    std::lock_guard lock(packetBufferMutex);
-    if (isClosing && packetBuffer.empty()) return;
-
-    for (auto&& packet : packets)
     {
-        packetBuffer.push_back(packet);
-    }
+        std::lock_guard lock(packetQueueMutex);
+        if (stopRequested)
+            return;
 
-    if (packetBuffer.size() >= PACKET_BUFFER_SIZE_TO_WRITE)
-    {
-        scheduler.scheduleWork(Work(  // main processing task
-            [this]()
+        for (auto&& packet : packets)
+        {
+            // never wait for the writer thread; once it falls too far behind, data packets are dropped,
+            // while event packets are kept so the file layout follows descriptor changes
+            if (packetQueue.size() >= options.writeQueueMaxPackets && packet.getType() == PacketType::Data)
             {
-                std::lock_guard lock(mutex);
-                try
-                {
-                    auto packets = dequeuePacketList();
-                    processPacketList(packets);
-                }
-                catch (const std::exception& e)
-                {
-                    LOG_E("ParquetWriter::enqueuePacketList: Exception while processing packet list: {}", e.what());
-                }
-            }));
+                ++droppedPacketCount;
+                continue;
+            }
+            packetQueue.push_back(packet);
+        }
     }
-}
 
-std::vector<PacketPtr> ParquetWriter::dequeuePacketList()
-{
-    std::lock_guard lock(packetBufferMutex);
-    std::vector<PacketPtr> packets;
-    std::swap(packetBuffer, packets);
-    return packets;
+    packetQueueCondition.notify_one();
 }
 
 void ParquetWriter::processPacketList(const std::vector<PacketPtr>& packets)
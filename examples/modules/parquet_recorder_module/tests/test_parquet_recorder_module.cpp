@@ -227,4 +227,74 @@ TEST_F(ParquetRecorderModuleTest, WritesToConfiguredSubdir)
     ASSERT_FALSE(foundInCwd);
 
     cleanup();
-}
\ No newline at end of file
+}
+
+TEST_F(ParquetRecorderModuleTest, WritesConfiguredRowGroups)
+{
+    const fs::path subdir = fs::current_path() / "parquet_test_row_groups";
+    fs::remove_all(subdir);
+    fs::create_directories(subdir);
+
+    auto module = CreateModuleWithScheduler();
+    auto fb = module.createFunctionBlock("ParquetRecorder", nullptr, "fb");
+    ASSERT_TRUE(fb.assigned());
+
+    auto context = fb.getContext();
+    auto recorder = fb.asPtr<daq::IRecorder>(true);
+    auto inputPort = fb.getInputPorts().getItemAt(0);
+
+    auto signal = CreateSignal(context);
+    inputPort.connect(signal);
+
+    fb.setPropertyValue("Path", subdir.string());
+    fb.setPropertyValue("RowGroupSampleCount", 1000);
+    fb.setPropertyValue("Compression", 0);
+    fb.setPropertyValue("UseDictionary", false);
+
+    recorder->startRecording();
+
+    // packet boundaries do not line up with the row groups
+    for (auto i = 0; i < 9'900; i += 300)
+    {
+        auto data = DataPacket(signal.getDescriptor(), 300);
+        std::iota(static_cast<SampleTypeToType<daq::SampleType::Float64>::Type*>(data.getData()),
+                  static_cast<SampleTypeToType<daq::SampleType::Float64>::Type*>(data.getData()) + 300,
+                  i);
+        signal.sendPacket(data);
+    }
+
+    recorder->stopRecording();
+    fb = nullptr;
+
+    auto dir = fs::directory_iterator(subdir);
+    auto parquetItem =
+        std::find_if(fs::begin(dir),
+                     fs::end(dir),
+                     [](const fs::directory_entry& item) { return item.is_regular_file() && item.path().extension() == ".parquet"; });
+    ASSERT_NE(parquetItem, fs::end(dir));
+
+    {
+        std::shared_ptr<arrow::io::ReadableFile> input = arrow::io::ReadableFile::Open(parquetItem->path().string()).ValueOrDie();
+        std::unique_ptr<parquet::arrow::FileReader> arrow_reader =
+            parquet::arrow::OpenFile(input, arrow::default_memory_pool()).ValueOrDie();
+
+        ASSERT_EQ(arrow_reader->num_row_groups(), 10);
+        for (int i = 0; i < 9; ++i)
+            ASSERT_EQ(arrow_reader->parquet_reader()->metadata()->RowGroup(i)->num_rows(), 1000);
+        ASSERT_EQ(arrow_reader->parquet_reader()->metadata()->RowGroup(9)->num_rows(), 900);
+
+        std::shared_ptr<arrow::Table> table;
+        ASSERT_TRUE(arrow_reader->ReadTable(&table).ok());
+        ASSERT_EQ(table->num_rows(), 9'900);
+
+        SampleTypeToType<daq::SampleType::Float64>::Type expectedValue = 0;
+        for (const auto& chunk : table->column(1)->chunks())
+        {
+            auto array = std::static_pointer_cast<arrow::DoubleArray>(chunk);
+            for (const auto& value : *array)
+                ASSERT_EQ(value, expectedValue++);
+        }
+    }
+
+    fs::remove_all(subdir);
+}
@@ -63,6 +63,7 @@ public:
 private:
     void transportConnectionStatusChangedHandler(const EnumerationPtr& status, const StringPtr& statusMessage);
     config_protocol::PacketBuffer doConfigRequestAndGetReply(const config_protocol::PacketBuffer& reqPacket);
+    std::future<config_protocol::PacketBuffer> doConfigRequestAsync(const config_protocol::PacketBuffer& reqPacket);
     void doConfigNoReplyRequest(const config_protocol::PacketBuffer& reqPacket);
     void sendConfigRequest(const config_protocol::PacketBuffer& reqPacket);
     std::future<config_protocol::PacketBuffer> registerConfigRequest(uint64_t requestId);
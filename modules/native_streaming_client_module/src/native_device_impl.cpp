@@ -234,6 +234,11 @@ void NativeDeviceHelper::setupProtocolClients(const ContextPtr& context)
     {
         this->doConfigNoReplyRequest(packet);
     };
+    SendRequestAsyncCallback sendRequestAsyncCallback =
+        [this](const PacketBuffer& packet)
+    {
+        return this->doConfigRequestAsync(packet);
+    };
     HandleDaqPacketCallback handleDaqPacketCallback =
         [this](PacketPtr&& packet, uint32_t signalNumericId)
     {
@@ -262,7 +267,8 @@ void NativeDeviceHelper::setupProtocolClients(const ContextPtr& context)
             handleDaqPacketCallback,
             nullptr,
             nullptr,
-            downgradePacketStreamingCallback
+            downgradePacketStreamingCallback,
+            sendRequestAsyncCallback
         );
 
     ProcessConfigProtocolPacketCb receiveConfigPacketCb =
@@ -306,6 +312,11 @@ void NativeDeviceHelper::setupProtocolClients(const ContextPtr& context)
 }
 
 PacketBuffer NativeDeviceHelper::doConfigRequestAndGetReply(const PacketBuffer& reqPacket)
+{
+    return doConfigRequestAsync(reqPacket).get();
+}
+
+std::future<PacketBuffer> NativeDeviceHelper::doConfigRequestAsync(const PacketBuffer& reqPacket)
 {
     auto reqId = reqPacket.getId();
 
@@ -334,19 +345,28 @@ PacketBuffer NativeDeviceHelper::doConfigRequestAndGetReply(const PacketBuffer&
         DAQ_THROW_EXCEPTION(ComponentRemovedException);
     }
 
-    if (future.wait_for(configProtocolRequestTimeout) == std::future_status::ready)
-    {
-        return future.get();
-    }
-    else // std::future_status::timeout
-    {
-        unregisterConfigRequest(reqId);
-        LOG_E("Native configuration protocol request id {} timed out", reqId);
-        if (connectionStatus == "Connected")
-            DAQ_THROW_EXCEPTION(GeneralErrorException, "Native configuration protocol request id {} timed out", reqId);
-        else
-            DAQ_THROW_EXCEPTION(ConnectionLostException, "Native configuration protocol request id {} timed out due to disconnection", reqId);
-    }
+    // replies are matched by request id, so any number of requests can be in flight;
+    // the timeout is measured from the moment the caller starts waiting for the reply
+    return std::async(
+        std::launch::deferred,
+        [reqId, future = std::move(future), deviceHelperWeak = weak_from_this(), timeout = configProtocolRequestTimeout]() mutable
+        {
+            if (future.wait_for(timeout) == std::future_status::ready)
+                return future.get();
+
+            // std::future_status::timeout
+            const auto deviceHelperSelf = deviceHelperWeak.lock();
+            if (!deviceHelperSelf)
+                DAQ_THROW_EXCEPTION(ComponentRemovedException);
+
+            deviceHelperSelf->unregisterConfigRequest(reqId);
+            const auto& loggerComponent = deviceHelperSelf->loggerComponent;
+            LOG_E("Native configuration protocol request id {} timed out", reqId);
+            if (deviceHelperSelf->connectionStatus == "Connected")
+                DAQ_THROW_EXCEPTION(GeneralErrorException, "Native configuration protocol request id {} timed out", reqId);
+            else
+                DAQ_THROW_EXCEPTION(ConnectionLostException, "Native configuration protocol request id {} timed out due to disconnection", reqId);
+        });
 }
 
 std::future<PacketBuffer> NativeDeviceHelper::registerConfigRequest(uint64_t requestId)
@@ -376,7 +396,7 @@ void NativeDeviceHelper::cancelPendingConfigRequests(const DaqException& e)
 
 void NativeDeviceHelper::processConfigPacket(PacketBuffer&& packet)
 {
-    if (packet.getPacketType() == ServerNotification)
+    if (packet.getPacketType() == ServerNotification || packet.getPacketType() == BinaryServerNotification)
     {
         // allow server notifications only if connected / reconnection started
         if (acceptNotificationPackets)
@@ -385,7 +405,10 @@ void NativeDeviceHelper::processConfigPacket(PacketBuffer&& packet)
         }
         else
         {
-            LOG_W("Notification packet from server ignored: \n{}\n", packet.parseServerNotification());
+            if (packet.getPacketType() == BinaryServerNotification)
+                LOG_W("Binary notification packet from server ignored");
+            else
+                LOG_W("Notification packet from server ignored: \n{}\n", packet.parseServerNotification());
         }
     }
     else
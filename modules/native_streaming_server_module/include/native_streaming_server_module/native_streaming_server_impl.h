@@ -22,8 +22,10 @@
 #include <opendaq/server_impl.h>
 #include <coretypes/intfs.h>
 #include <native_streaming_protocol/native_streaming_server_handler.h>
+#include <native_streaming_server_module/streaming_read_notifications.h>
 #include <opendaq/connection_internal.h>
-#include <tsl/ordered_map.h>
+#include <opendaq/input_port_ptr.h>
+#include <opendaq/input_port_notifications_ptr.h>
 #include <boost/asio/thread_pool.hpp>
 #include <config_protocol/config_protocol_server.h>
 
@@ -55,9 +57,10 @@ protected:
     void startReading();
     void stopReading();
     void startReadThread();
+    bool readAvailablePackets();
     void addReader(SignalPtr signalToRead);
     void removeReader(SignalPtr signalToRead);
-    void clearIndices();
+    void initLatencyHistogramProperties();
 
     void startTransportOperations();
     void stopTransportOperations();
@@ -81,12 +84,25 @@ protected:
     void dispatchClientConfigRequest(const ConfigServerPtr& configServerPtr, opendaq_native_streaming_protocol::SendConfigProtocolPacketCb sendConfigPacketCb, config_protocol::PacketBuffer&& packetBuffer);
     void dispatchClientToDeviceStreamingPacket(const ConfigServerPtr& configServerPtr, const PacketStreamingClientPtr& packetStreamingClientPtr, const packet_streaming::PacketBufferPtr& packetBufferPtr);
 
+    struct SignalReader
+    {
+        SignalPtr signal;
+        opendaq_native_streaming_protocol::SignalNumericIdType numericId;
+        InputPortPtr port;
+        ObjectPtr<IConnectionInternal> connection;
+        std::shared_ptr<std::atomic<bool>> packetsReady;
+        InputPortNotificationsPtr notifier;
+    };
+
     std::thread readThread;
     std::atomic<bool> readThreadActive;
     std::chrono::milliseconds readThreadSleepTime;
-    std::vector<std::tuple<SignalPtr, std::string, InputPortPtr, ObjectPtr<IConnectionInternal>>> signalReaders;
+    bool notificationReadMode;
+    std::shared_ptr<StreamingReadWakeup> readWakeup;
+    StreamingLatencyHistogram latencyHistogram;
+    std::vector<SignalReader> signalReaders;
     std::vector<IPacket*> packetBuf;
-    tsl::ordered_map<std::string, opendaq_native_streaming_protocol::PacketBufferData> packetIndices;
+    opendaq_native_streaming_protocol::SignalPacketIndices packetIndices;
 
     std::shared_ptr<boost::asio::io_context> transportIOContextPtr;
     std::thread transportThread;
@@ -103,6 +119,7 @@ protected:
     std::mutex readersSync;
     bool serverStopped;
     size_t maxPacketReadCount;
+    std::chrono::milliseconds coreEventCoalescingWindow;
     std::unordered_map<std::string, SizeT> registeredClientIds;
     std::unordered_map<std::string, SizeT> disconnectedClientIds;
     StreamingPtr streaming;
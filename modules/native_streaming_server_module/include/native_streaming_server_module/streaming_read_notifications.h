@@ -0,0 +1,102 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <native_streaming_server_module/common.h>
+#include <opendaq/input_port_notifications.h>
+#include <coretypes/weakrefobj.h>
+#include <coretypes/listobject_factory.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_SERVER_MODULE
+
+/*
+ * Wakes the streaming read thread when subscribed signals receive packets.
+ * Only the first notification after the read thread has taken the pending state triggers a wakeup,
+ * all further notifications until then are coalesced into it.
+ */
+class StreamingReadWakeup
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit StreamingReadWakeup(bool wakeOnNotification);
+
+    void notify();
+    void stop();
+
+    // Waits until notified, stopped or the timeout expires. Returns the time of the first notification
+    // since the previous call or nullopt if none were received.
+    std::optional<Clock::time_point> wait(Clock::duration timeout);
+
+    // Takes the pending state without waiting.
+    std::optional<Clock::time_point> takePending();
+
+private:
+    const bool wakeOnNotification;
+    // Time since epoch of the first pending notification; 0 when nothing is pending
+    std::atomic<Clock::rep> pendingSince{0};
+    bool stopped{false};
+    std::mutex sync;
+    std::condition_variable cv;
+};
+
+/*
+ * Listener of a single input port read by the streaming server. Marks the signal's packets as ready
+ * to be dequeued and forwards the notification to the shared wakeup.
+ */
+class SignalReadNotifierImpl : public ImplementationOfWeak<IInputPortNotifications>
+{
+public:
+    explicit SignalReadNotifierImpl(std::shared_ptr<StreamingReadWakeup> wakeup,
+                                    std::shared_ptr<std::atomic<bool>> packetsReady);
+
+    ErrCode INTERFACE_FUNC acceptsSignal(IInputPort* port, ISignal* signal, Bool* accept) override;
+    ErrCode INTERFACE_FUNC connected(IInputPort* port) override;
+    ErrCode INTERFACE_FUNC disconnected(IInputPort* port) override;
+    ErrCode INTERFACE_FUNC packetReceived(IInputPort* port) override;
+
+private:
+    std::shared_ptr<StreamingReadWakeup> wakeup;
+    std::shared_ptr<std::atomic<bool>> packetsReady;
+};
+
+/*
+ * Counts the time between the first packet notification of a read cycle and the moment
+ * the packets read in that cycle are handed to the transport layer.
+ */
+class StreamingLatencyHistogram
+{
+public:
+    // Bucket upper bounds in microseconds; the last bucket counts all latencies above the last bound
+    static constexpr std::array<Int, 11> BucketBoundsUs{50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000};
+
+    void record(std::chrono::steady_clock::duration latency);
+    ListPtr<IInteger> getCounts() const;
+    static ListPtr<IInteger> getBucketBounds();
+
+private:
+    std::array<std::atomic<Int>, BucketBoundsUs.size() + 1> counts{};
+};
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_SERVER_MODULE
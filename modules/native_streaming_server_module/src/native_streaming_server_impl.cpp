@@ -26,6 +26,13 @@ using namespace config_protocol;
 
 static constexpr size_t DEFAULT_MAX_PACKET_READ_COUNT = 5000;
 static constexpr size_t DEFAULT_POLLING_PERIOD = 20;
+static constexpr size_t DEFAULT_CORE_EVENT_COALESCING_WINDOW = 0;
+
+enum class StreamingDataReadMode : Int
+{
+    Polling = 0,
+    Notification
+};
 
 NativeStreamingServerImpl::NativeStreamingServerImpl(const DevicePtr& rootDevice,
                                                      const PropertyObjectPtr& config,
@@ -33,6 +40,7 @@ NativeStreamingServerImpl::NativeStreamingServerImpl(const DevicePtr& rootDevice
     : Server("OpenDAQNativeStreaming", config, rootDevice, context)
     , readThreadActive(false)
     , readThreadSleepTime(std::chrono::milliseconds(20))
+    , notificationReadMode(false)
     , transportIOContextPtr(std::make_shared<boost::asio::io_context>())
     , processingIOContextPtr(std::make_shared<boost::asio::io_context>())
     , processingStrand(*processingIOContextPtr)
@@ -86,8 +94,16 @@ NativeStreamingServerImpl::NativeStreamingServerImpl(const DevicePtr& rootDevice
     const uint16_t pollingPeriod = config.getPropertyValue("StreamingDataPollingPeriod");
     readThreadSleepTime = std::chrono::milliseconds(pollingPeriod);
 
+    const Int readMode = config.getPropertyValue("StreamingDataReadMode");
+    notificationReadMode = static_cast<StreamingDataReadMode>(readMode) == StreamingDataReadMode::Notification;
+    readWakeup = std::make_shared<StreamingReadWakeup>(notificationReadMode);
+
     maxPacketReadCount = config.getPropertyValue("MaxPacketReadCount");
     packetBuf.resize(maxPacketReadCount);
+
+    const Int coalescingWindow = config.getPropertyValue("CoreEventCoalescingWindow");
+    coreEventCoalescingWindow = std::chrono::milliseconds(coalescingWindow);
+    initLatencyHistogramProperties();
     startReading();
 }
 
@@ -328,6 +344,7 @@ void NativeStreamingServerImpl::prepareServerHandler()
         if (const DevicePtr rootDevice = this->rootDeviceRef.assigned() ? this->rootDeviceRef.getRef() : nullptr; rootDevice.assigned())
         {
             auto configServer = std::make_shared<ConfigProtocolServer>(rootDevice, sendConfigPacketCb, user, connectionType, this->signals);
+            configServer->setCoreEventCoalescingWindow(coreEventCoalescingWindow);
             processConfigRequestCb =
                 [this, configServer, sendConfigPacketCb](PacketBuffer&& packetBuffer)
             {
@@ -502,10 +519,22 @@ PropertyObjectPtr NativeStreamingServerImpl::createDefaultConfig(const ContextPt
                                        .setMaxValue(65535)
                                        .setDescription("Polling period in milliseconds "
                                                        "which specifies how often the server collects and sends "
-                                                       "subscribed signals' data to clients")
+                                                       "subscribed signals' data to clients. In \"Notification\" read mode "
+                                                       "it is the longest time the server waits for new data")
                                        .build();
     defaultConfig.addProperty(pollingPeriodProp);
 
+    const auto readModeProp = SelectionPropertyBuilder("StreamingDataReadMode",
+                                                       List<IString>("Polling", "Notification"),
+                                                       static_cast<Int>(StreamingDataReadMode::Polling))
+                                  .setDescription("Specifies when the server collects subscribed signals' data. "
+                                                  "\"Polling\" reads the data once per polling period. "
+                                                  "\"Notification\" reads the data as soon as signals send it; "
+                                                  "notifications arriving while the data is being sent are "
+                                                  "combined into a single read.")
+                                  .build();
+    defaultConfig.addProperty(readModeProp);
+
     const auto maxPacketReadCountProp = IntPropertyBuilder("MaxPacketReadCount", DEFAULT_MAX_PACKET_READ_COUNT)
                                                 .setMinValue(1)
                                                 .setDescription("Specifies the size of a pre-allocated packet buffer into "
@@ -516,6 +545,17 @@ PropertyObjectPtr NativeStreamingServerImpl::createDefaultConfig(const ContextPt
                                                 .build();
     defaultConfig.addProperty(maxPacketReadCountProp);
 
+    const auto coreEventCoalescingWindowProp = IntPropertyBuilder("CoreEventCoalescingWindow", DEFAULT_CORE_EVENT_COALESCING_WINDOW)
+                                                   .setMinValue(0)
+                                                   .setMaxValue(10000)
+                                                   .setDescription("Time in milliseconds during which core event notifications "
+                                                                   "are collected and sent to a configuration client as one "
+                                                                   "notification. Repeated value changes of the same property "
+                                                                   "within the window are reduced to the latest one. "
+                                                                   "0 sends each event immediately.")
+                                                   .build();
+    defaultConfig.addProperty(coreEventCoalescingWindowProp);
+
     populateDefaultConfigFromProvider(context, defaultConfig);
     return defaultConfig;
 }
@@ -577,6 +617,9 @@ void NativeStreamingServerImpl::startReading()
 void NativeStreamingServerImpl::stopReading()
 {
     readThreadActive = false;
+    if (readWakeup)
+        readWakeup->stop();
+
     if (readThread.joinable())
     {
         readThread.join();
@@ -584,8 +627,8 @@ void NativeStreamingServerImpl::stopReading()
     }
 
     auto ports = List<IInputPort>();
-    for (const auto& [_, __, port, ___] : signalReaders)
-        ports.pushBack(port);
+    for (const auto& reader : signalReaders)
+        ports.pushBack(reader.port);
 
     signalReaders.clear();
 
@@ -597,98 +640,150 @@ void NativeStreamingServerImpl::startReadThread()
 {
     while (readThreadActive)
     {
-        bool sendData = false;
+        if (!notificationReadMode)
+        {
+            // Polling mode sweeps all readers; the input ports have no listener, so no latency is recorded
+            std::this_thread::sleep_for(readThreadSleepTime);
+            if (readAvailablePackets())
+                serverHandler->sendAvailableStreamingPackets();
+            continue;
+        }
 
+        const auto firstNotification = readWakeup->wait(readThreadSleepTime);
+        if (!firstNotification.has_value())
+            continue;
+
+        if (readAvailablePackets())
         {
-            std::scoped_lock lock(readersSync);
-            bool repeatRead;
-            do
-            {
-                repeatRead = false;
-                SizeT read = 0;
-                SizeT count = maxPacketReadCount;
-                for (const auto& [_, signalGlobalId, port, connection] : signalReaders)
-                {
-                    connection->dequeueUpTo(packetBuf.data() + read, &count);
-                    auto& packetData = packetIndices[signalGlobalId];
-                    packetData.index = static_cast<int>(read);
-                    packetData.count = static_cast<int>(count);
-                    read += count;
-                    count = maxPacketReadCount - read;
-
-                    // Max packet read count exceeded; Send packets and re-read to not drop data.
-                    if (count == 0)
-                    {
-                        repeatRead = true;
-                        break;
-                    }
-                }
+            serverHandler->sendAvailableStreamingPackets();
+            latencyHistogram.record(StreamingReadWakeup::Clock::now() - firstNotification.value());
+        }
+    }
+}
 
-                if (read)
-                    serverHandler->processStreamingPackets(packetIndices, packetBuf);
+bool NativeStreamingServerImpl::readAvailablePackets()
+{
+    std::scoped_lock lock(readersSync);
+
+    bool sendData = false;
+    bool repeatRead;
+    do
+    {
+        repeatRead = false;
+        SizeT read = 0;
+        SizeT count = maxPacketReadCount;
+        for (const auto& reader : signalReaders)
+        {
+            // In notification mode, only signals that received packets since the previous read are dequeued
+            if (notificationReadMode && !reader.packetsReady->exchange(false))
+                continue;
 
-                sendData = sendData || read;
-                clearIndices();
+            reader.connection->dequeueUpTo(packetBuf.data() + read, &count);
+            if (count > 0)
+            {
+                PacketBufferData packetData;
+                packetData.index = static_cast<int>(read);
+                packetData.count = static_cast<int>(count);
+                packetIndices.emplace_back(reader.numericId, packetData);
+            }
+            read += count;
+            count = maxPacketReadCount - read;
+
+            // Max packet read count exceeded; Send packets and re-read to not drop data.
+            if (count == 0)
+            {
+                if (notificationReadMode)
+                    reader.packetsReady->store(true);
+                repeatRead = true;
+                break;
             }
-            while (repeatRead);
         }
 
-        if (sendData)
-            serverHandler->sendAvailableStreamingPackets();
+        if (read)
+            serverHandler->processStreamingPackets(packetIndices, packetBuf);
 
-        std::this_thread::sleep_for(readThreadSleepTime);
+        sendData = sendData || read;
+        packetIndices.clear();
     }
+    while (repeatRead);
+
+    return sendData;
 }
 
 void NativeStreamingServerImpl::addReader(SignalPtr signalToRead)
 {
     auto it = std::find_if(signalReaders.begin(),
                            signalReaders.end(),
-                           [&signalToRead](const std::tuple<SignalPtr, std::string, InputPortPtr, ObjectPtr<IConnectionInternal>>& element)
+                           [&signalToRead](const SignalReader& reader)
                            {
-                               return std::get<0>(element) == signalToRead;
+                               return reader.signal == signalToRead;
                            });
     if (it != signalReaders.end())
         return;
 
     LOG_I("Add reader for signal {}", signalToRead.getGlobalId());
 
+    auto packetsReady = std::make_shared<std::atomic<bool>>(true);
+    InputPortNotificationsPtr notifier;
+
     auto port = InputPort(signalToRead.getContext(), nullptr, "readsig");
+    if (notificationReadMode)
+    {
+        // The listener is set before connecting, so the notification of the initial event packet is not missed
+        notifier = createWithImplementation<IInputPortNotifications, SignalReadNotifierImpl>(readWakeup, packetsReady);
+        port.setListener(notifier);
+        port.setNotificationMethod(PacketReadyNotification::SameThread);
+    }
     port.connect(signalToRead);
-    port.setNotificationMethod(PacketReadyNotification::None);
+    if (!notificationReadMode)
+        port.setNotificationMethod(PacketReadyNotification::None);
     auto connection = port.getConnection().asPtr<IConnectionInternal>();
 
-    signalReaders.push_back(std::tuple<SignalPtr, std::string, InputPortPtr, ObjectPtr<IConnectionInternal>>(
-        {signalToRead, signalToRead.getGlobalId().toStdString(), port, connection}));
-    packetIndices.insert(std::make_pair(signalToRead.getGlobalId().toStdString(), PacketBufferData()));
+    signalReaders.push_back({signalToRead, serverHandler->getSignalNumericId(signalToRead), port, connection, packetsReady, notifier});
+    if (notificationReadMode)
+        readWakeup->notify();
 }
 
 void NativeStreamingServerImpl::removeReader(SignalPtr signalToRead)
 {
     auto it = std::find_if(signalReaders.begin(),
                            signalReaders.end(),
-                           [&signalToRead](const std::tuple<SignalPtr, std::string, InputPortPtr, ObjectPtr<IConnection>>& element)
+                           [&signalToRead](const SignalReader& reader)
                            {
-                               return std::get<0>(element) == signalToRead;
+                               return reader.signal == signalToRead;
                            });
     if (it == signalReaders.end())
         return;
 
     LOG_I("Remove reader for signal {}", signalToRead.getGlobalId());
 
-    auto port = std::get<2>(*it);
+    auto port = it->port;
     signalReaders.erase(it);
-    packetIndices.erase(signalToRead.getGlobalId().toStdString());
     port.remove();
 }
 
-void NativeStreamingServerImpl::clearIndices()
+void NativeStreamingServerImpl::initLatencyHistogramProperties()
 {
-    for (auto& [signalId, _] : packetIndices)
-    {
-        auto& data = packetIndices[signalId];
-        data.reset();
-    }
+    const auto boundsProp = ListPropertyBuilder("StreamingLatencyBucketBounds", StreamingLatencyHistogram::getBucketBounds())
+                                .setReadOnly(true)
+                                .setDescription("Upper bounds of the streaming latency histogram buckets in microseconds. "
+                                                "The last histogram bucket counts latencies above the last bound.")
+                                .build();
+    objPtr.addProperty(boundsProp);
+
+    const auto histogramProp = ListPropertyBuilder("StreamingLatencyHistogram", latencyHistogram.getCounts())
+                                   .setReadOnly(true)
+                                   .setDescription("Number of read cycles per latency bucket. The latency is measured from the "
+                                                   "first packet notification of a read cycle until its packets are handed to "
+                                                   "the transport layer. It is only recorded in \"Notification\" read mode.")
+                                   .build();
+    objPtr.addProperty(histogramProp);
+
+    objPtr.getOnPropertyValueRead("StreamingLatencyHistogram") +=
+        [this](PropertyObjectPtr& /*obj*/, PropertyValueEventArgsPtr& args)
+        {
+            args.setValue(latencyHistogram.getCounts());
+        };
 }
 
 OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE(
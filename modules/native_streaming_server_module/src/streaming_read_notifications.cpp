@@ -0,0 +1,117 @@
+#include <native_streaming_server_module/streaming_read_notifications.h>
+#include <coretypes/validation.h>
+
+#include <algorithm>
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_SERVER_MODULE
+
+StreamingReadWakeup::StreamingReadWakeup(bool wakeOnNotification)
+    : wakeOnNotification(wakeOnNotification)
+{
+}
+
+void StreamingReadWakeup::notify()
+{
+    // Already pending - the read thread has been (or will be) woken up and collects this notification as well
+    if (pendingSince.load(std::memory_order_relaxed) != 0)
+        return;
+
+    Clock::rep expected = 0;
+    if (!pendingSince.compare_exchange_strong(expected, Clock::now().time_since_epoch().count()))
+        return;
+
+    if (wakeOnNotification)
+    {
+        {
+            std::scoped_lock lock(sync);
+        }
+        cv.notify_one();
+    }
+}
+
+void StreamingReadWakeup::stop()
+{
+    {
+        std::scoped_lock lock(sync);
+        stopped = true;
+    }
+    cv.notify_all();
+}
+
+std::optional<StreamingReadWakeup::Clock::time_point> StreamingReadWakeup::wait(Clock::duration timeout)
+{
+    {
+        std::unique_lock lock(sync);
+        cv.wait_for(lock, timeout, [this] { return stopped || pendingSince.load() != 0; });
+    }
+
+    return takePending();
+}
+
+std::optional<StreamingReadWakeup::Clock::time_point> StreamingReadWakeup::takePending()
+{
+    const auto since = pendingSince.exchange(0);
+    if (since == 0)
+        return std::nullopt;
+
+    return Clock::time_point(Clock::duration(since));
+}
+
+SignalReadNotifierImpl::SignalReadNotifierImpl(std::shared_ptr<StreamingReadWakeup> wakeup,
+                                               std::shared_ptr<std::atomic<bool>> packetsReady)
+    : wakeup(std::move(wakeup))
+    , packetsReady(std::move(packetsReady))
+{
+}
+
+ErrCode SignalReadNotifierImpl::acceptsSignal(IInputPort* /*port*/, ISignal* /*signal*/, Bool* accept)
+{
+    OPENDAQ_PARAM_NOT_NULL(accept);
+
+    *accept = true;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SignalReadNotifierImpl::connected(IInputPort* /*port*/)
+{
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SignalReadNotifierImpl::disconnected(IInputPort* /*port*/)
+{
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode SignalReadNotifierImpl::packetReceived(IInputPort* /*port*/)
+{
+    // Signal is already marked - its packets are dequeued in the upcoming read cycle
+    if (!packetsReady->exchange(true))
+        wakeup->notify();
+
+    return OPENDAQ_SUCCESS;
+}
+
+void StreamingLatencyHistogram::record(std::chrono::steady_clock::duration latency)
+{
+    const Int latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    const auto bucket = std::lower_bound(BucketBoundsUs.begin(), BucketBoundsUs.end(), latencyUs) - BucketBoundsUs.begin();
+    counts[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+ListPtr<IInteger> StreamingLatencyHistogram::getCounts() const
+{
+    auto list = List<IInteger>();
+    for (const auto& count : counts)
+        list.pushBack(count.load(std::memory_order_relaxed));
+    return list;
+}
+
+ListPtr<IInteger> StreamingLatencyHistogram::getBucketBounds()
+{
+    auto list = List<IInteger>();
+    for (const auto bound : BucketBoundsUs)
+        list.pushBack(bound);
+    return list;
+}
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_SERVER_MODULE
@@ -156,9 +156,15 @@ TEST_F(NativeStreamingServerModuleTest, ServerConfig)
     ASSERT_TRUE(config.hasProperty("StreamingPacketSendTimeout"));
     ASSERT_EQ(config.getPropertyValue("StreamingPacketSendTimeout"), 0);
 
+    ASSERT_TRUE(config.hasProperty("StreamingSendQueueByteLimit"));
+    ASSERT_EQ(config.getPropertyValue("StreamingSendQueueByteLimit"), 0);
+
     ASSERT_TRUE(config.hasProperty("StreamingDataPollingPeriod"));
     ASSERT_EQ(config.getPropertyValue("StreamingDataPollingPeriod"), 20);
 
+    ASSERT_TRUE(config.hasProperty("StreamingDataReadMode"));
+    ASSERT_EQ(config.getPropertyValue("StreamingDataReadMode"), 0);
+
     ASSERT_TRUE(config.hasProperty("StreamingCacheablePayloadSizeMax"));
     ASSERT_EQ(config.getPropertyValue("StreamingCacheablePayloadSizeMax"), 10);
 
@@ -185,3 +191,20 @@ TEST_F(NativeStreamingServerModuleTest, CreateServerFromInstance)
 
     ASSERT_NO_THROW(device.addServer("OpenDAQNativeStreaming", config));
 }
+
+TEST_F(NativeStreamingServerModuleTest, LatencyHistogramProperties)
+{
+    auto device = CreateTestInstance();
+    auto config = CreateServerConfig(device);
+    config.setPropertyValue("StreamingDataReadMode", 1);
+
+    const auto server = device.addServer("OpenDAQNativeStreaming", config);
+
+    ListPtr<IInteger> bounds = server.getPropertyValue("StreamingLatencyBucketBounds");
+    ListPtr<IInteger> histogram = server.getPropertyValue("StreamingLatencyHistogram");
+    ASSERT_GT(bounds.getCount(), 0u);
+    ASSERT_EQ(histogram.getCount(), bounds.getCount() + 1);
+
+    ASSERT_TRUE(server.getProperty("StreamingLatencyHistogram").getReadOnly());
+    ASSERT_THROW(server.setPropertyValue("StreamingLatencyHistogram", List<IInteger>()), AccessDeniedException);
+}
@@ -51,6 +51,7 @@ public:
     ErrCode INTERFACE_FUNC setPropertySelectionValue(IString* propertyName, IBaseObject* value) override;
     ErrCode INTERFACE_FUNC getPropertyValue(IString* propertyName, IBaseObject** value) override;
     ErrCode INTERFACE_FUNC getPropertySelectionValue(IString* propertyName, IBaseObject** value) override;
+    ErrCode INTERFACE_FUNC resolveValueSlot(IString* propertyName, SizeT* slot, SizeT* layoutRevision) override;
     ErrCode INTERFACE_FUNC clearPropertyValue(IString* propertyName) override;
     ErrCode INTERFACE_FUNC clearProtectedPropertyValue(IString* propertyName) override;
     ErrCode INTERFACE_FUNC addProperty(IProperty* property) override;
@@ -92,6 +93,10 @@ protected:
     bool remoteUpdating;
 
 private:
+    // property value changes made between beginUpdate and endUpdate are collected by the client comm per component,
+    // so changes of child property objects are sent in order with the changes of their parent
+    bool tryAddBatchedOperation(const StringPtr& name, ParamsDictPtr params);
+
     BaseObjectPtr getValueFromServer(const StringPtr& propName, bool& setValue);
 
     void updateProperties(const SerializedObjectPtr& serObj);
@@ -191,6 +196,9 @@ ErrCode ConfigClientPropertyObjectBaseImpl<Impl>::setPropertyValue(IString* prop
     {
         checkCanSetPropertyValue(propertyNamePtr);
         auto fullPropName = this->getFullPropName(propertyNamePtr);
+        if (tryAddBatchedOperation("SetPropertyValue", Dict<IString, IBaseObject>({{"PropertyName", fullPropName}, {"PropertyValue", valuePtr}})))
+            return;
+
         clientComm->setPropertyValue(remoteGlobalId, fullPropName, valuePtr);
     });
     OPENDAQ_RETURN_IF_FAILED(errCode);
@@ -211,6 +219,10 @@ ErrCode ConfigClientPropertyObjectBaseImpl<Impl>::setProtectedPropertyValue(IStr
     {
         checkCanSetPropertyValue(propertyNamePtr);
         auto fullPropName = this->getFullPropName(propertyNamePtr);
+        if (tryAddBatchedOperation("SetProtectedPropertyValue",
+                                   Dict<IString, IBaseObject>({{"PropertyName", fullPropName}, {"PropertyValue", String(valuePtr)}})))
+            return;
+
         clientComm->setProtectedPropertyValue(remoteGlobalId, fullPropName, valuePtr);
     });
     OPENDAQ_RETURN_IF_FAILED(errCode);
@@ -230,6 +242,10 @@ ErrCode ConfigClientPropertyObjectBaseImpl<Impl>::setPropertySelectionValue(IStr
     const ErrCode errCode = daqTry([this, &propertyNamePtr, &valuePtr]()
     {
         auto fullPropName = this->getFullPropName(propertyNamePtr);
+        if (tryAddBatchedOperation("SetPropertySelectionValue",
+                                   Dict<IString, IBaseObject>({{"PropertyName", fullPropName}, {"PropertyValue", valuePtr}})))
+            return;
+
         clientComm->setPropertySelectionValue(remoteGlobalId, fullPropName, valuePtr);
     });
     OPENDAQ_RETURN_IF_FAILED(errCode);
@@ -262,6 +278,9 @@ ErrCode ConfigClientPropertyObjectBaseImpl<Impl>::getPropertyValue(IString* prop
                 const ErrCode errCode = Impl::setProtectedPropertyValue(propertyNamePtr, v);
                 OPENDAQ_RETURN_IF_FAILED(errCode);
             }
+
+            // the value is produced by the server on each read
+            Impl::invalidateValueRevision();
             *value = v.detach();
             return OPENDAQ_SUCCESS;
         }
@@ -272,6 +291,17 @@ ErrCode ConfigClientPropertyObjectBaseImpl<Impl>::getPropertyValue(IString* prop
     return errCode;
 }
 
+template <class Impl>
+ErrCode ConfigClientPropertyObjectBaseImpl<Impl>::resolveValueSlot(IString* propertyName, SizeT* slot, SizeT* layoutRevision)
+{
+    OPENDAQ_PARAM_NOT_NULL(propertyName);
+    OPENDAQ_PARAM_NOT_NULL(slot);
+    OPENDAQ_PARAM_NOT_NULL(layoutRevision);
+
+    // Values can be fetched from the server on read, so they are always read through getPropertyValue
+    return OPENDAQ_IGNORED;
+}
+
 template <class Impl>
 ErrCode ConfigClientPropertyObjectBaseImpl<Impl>::getPropertySelectionValue(IString* propertyName, IBaseObject** value)
 {
@@ -307,6 +337,9 @@ ErrCode ConfigClientPropertyObjectBaseImpl<Impl>::clearPropertyValue(IString* pr
     const auto propertyNamePtr = StringPtr::Borrow(propertyName);
     const ErrCode errCode = daqTry([this, &propertyNamePtr]()
     {
+        if (tryAddBatchedOperation("ClearPropertyValue", Dict<IString, IBaseObject>({{"PropertyName", propertyNamePtr}})))
+            return;
+
         clientComm->clearPropertyValue(remoteGlobalId, propertyNamePtr);
     });
     OPENDAQ_RETURN_IF_FAILED(errCode);
@@ -405,6 +438,9 @@ ErrCode INTERFACE_FUNC ConfigClientPropertyObjectBaseImpl<Impl>::beginUpdate()
         if (this->getPath().assigned())
             path = this->getPath().toStdString();
         clientComm->beginUpdate(remoteGlobalId, path);
+
+        if (clientComm->isBatchSupported())
+            clientComm->beginBatchedUpdate(remoteGlobalId);
     });
     OPENDAQ_RETURN_IF_FAILED(errCode);
     return errCode;
@@ -418,12 +454,23 @@ ErrCode INTERFACE_FUNC ConfigClientPropertyObjectBaseImpl<Impl>::endUpdate()
         std::string path{};
         if (this->getPath().assigned())
             path = this->getPath().toStdString();
-        clientComm->endUpdate(remoteGlobalId, path);
+
+        ListPtr<IDict> operations;
+        if (!clientComm->endBatchedUpdate(remoteGlobalId, path, operations))
+            clientComm->endUpdate(remoteGlobalId, path);
+        else if (operations.assigned())
+            ConfigProtocolClientComm::checkBatchResults(clientComm->batch(std::string{}, operations));
     });
     OPENDAQ_RETURN_IF_FAILED(errCode);
     return errCode;
 }
 
+template <class Impl>
+bool ConfigClientPropertyObjectBaseImpl<Impl>::tryAddBatchedOperation(const StringPtr& name, ParamsDictPtr params)
+{
+    return clientComm->tryAddBatchedOperation(remoteGlobalId, name, std::move(params));
+}
+
 template <class Impl>
 ErrCode ConfigClientPropertyObjectBaseImpl<Impl>::updateInternal(ISerializedObject* obj, IBaseObject* context)
 {
@@ -51,7 +51,8 @@ enum PacketType: uint8_t
     ServerNotification = 0x83,
     InvalidRequest = 0x84,
     NoReplyRpc = 0x85,
-    ConnectionRejected = 0x86
+    ConnectionRejected = 0x86,
+    BinaryServerNotification = 0x87
 };
 
 #pragma pack(push, 1)
@@ -127,6 +128,9 @@ public:
     static PacketBuffer createServerNotification(const char* json, size_t jsonSize);
     StringPtr parseServerNotification() const;
 
+    static PacketBuffer createBinaryServerNotification(const void* payload, size_t payloadSize);
+    void parseBinaryServerNotification(const void*& payload, size_t& payloadSize) const;
+
     static PacketBuffer createInvalidRequestReply(uint64_t id);
     void parseInvalidRequestReply() const;
 
@@ -166,6 +170,8 @@ inline auto format_as(PacketType type)
             return "NoReplyRpc";
         case ConnectionRejected:
             return "ConnectionRejected";
+        case BinaryServerNotification:
+            return "BinaryServerNotification";
     }
     return "Unknown type";
 }
@@ -180,7 +186,7 @@ public:
 
 inline constexpr uint16_t GetLatestConfigProtocolVersion()
 {
-    return 24;
+    return 26;
 }
 
 inline std::set<uint16_t> GetSupportedConfigProtocolVersions()
@@ -29,15 +29,21 @@
 #include <opendaq/custom_log.h>
 #include <opendaq/component_private_ptr.h>
 #include <config_protocol/config_protocol_streaming_producer.h>
+#include <config_protocol/core_event_encoding.h>
 #include <coreobjects/property_object_class_internal_ptr.h>
 #include <opendaq/mirrored_input_port_private_ptr.h>
 #include <algorithm>
+#include <future>
+#include <mutex>
+#include <unordered_map>
 #include <opendaq/component_update_context_ptr.h>
 
 namespace daq::config_protocol
 {
 
 using SendRequestCallback = std::function<PacketBuffer(PacketBuffer&)>;
+// Sends the request without waiting for the reply; the returned future is fulfilled with the reply of the matching request ID
+using SendRequestAsyncCallback = std::function<std::future<PacketBuffer>(PacketBuffer&)>;
 using SendNoReplyRequestCallback = std::function<void(PacketBuffer&)>;
 using ServerNotificationReceivedCallback = std::function<bool(const BaseObjectPtr& obj)>;
 using ComponentDeserializeCallback = std::function<ErrCode(ISerializedObject*, IBaseObject*, IFunction*, IBaseObject**)>;
@@ -67,13 +73,16 @@ public:
                                       SendRequestCallback sendRequestCallback,
                                       SendNoReplyRequestCallback sendNoReplyRequestCallback,
                                       const ConfigProtocolStreamingProducerPtr& streamingProducer,
-                                      ComponentDeserializeCallback rootDeviceDeserializeCallback);
+                                      ComponentDeserializeCallback rootDeviceDeserializeCallback,
+                                      SendRequestAsyncCallback sendRequestAsyncCallback = nullptr);
 
     void setPropertyValue(const std::string& globalId, const std::string& propertyName, const BaseObjectPtr& propertyValue);
     void setProtectedPropertyValue(const std::string& globalId, const std::string& propertyName, const BaseObjectPtr& propertyValue);
     void setPropertySelectionValue(const std::string& globalId, const std::string& propertyName, const BaseObjectPtr& propertyValue);
 
     BaseObjectPtr getPropertyValue(const std::string& globalId, const std::string& propertyName);
+    // The reply is parsed on the thread that retrieves the result; requests issued before that are in flight concurrently
+    std::future<BaseObjectPtr> getPropertyValueAsync(const std::string& globalId, const std::string& propertyName);
     BaseObjectPtr getSelectionValues(const std::string& globalId, const std::string& path, const std::string& propertyName);
     ListPtr<IBaseObject> getSuggestedValues(const std::string& globalId, const std::string& path, const std::string& propertyName);
 
@@ -91,6 +100,27 @@ public:
     void endUpdate(const std::string& globalId, const std::string& path = "", const ListPtr<IDict>& props = nullptr);
     void clearPropertyValues(const std::string& globalId, const std::string& path = "");
 
+    // Executes the operations in order with a single request. If globalId is not empty, all operations are executed
+    // within one update of that component, or of its property object at path. Returns a dictionary per operation
+    // with the "ErrorCode" key and, when set, the "ErrorMessage" and "ReturnValue" keys.
+    ListPtr<IDict> batch(const std::string& globalId, const ListPtr<IDict>& operations, const std::string& path = "");
+    DictPtr<IString, IBaseObject> createBatchOperation(const StringPtr& name, const ParamsDictPtr& params) const;
+    // Throws the error of the first failed operation
+    static void checkBatchResults(const ListPtr<IDict>& results);
+    bool isBatchSupported() const;
+
+    // Property value changes of a component and of its child property objects made between beginUpdate and endUpdate
+    // are collected per component, and sent in order together with the EndUpdate requests on the outermost endUpdate.
+    void beginBatchedUpdate(const std::string& globalId);
+    bool tryAddBatchedOperation(const std::string& globalId, const StringPtr& name, ParamsDictPtr params);
+    // Returns false if the component is not in a batched update. Sets operations to the collected operations
+    // when the outermost update of the component ends.
+    bool endBatchedUpdate(const std::string& globalId, const std::string& path, ListPtr<IDict>& operations);
+
+    // Use a single batch request if supported by the server
+    void setPropertyValues(const std::string& globalId, const DictPtr<IString, IBaseObject>& propertyValues);
+    DictPtr<IString, IBaseObject> getPropertyValues(const std::string& globalId, const ListPtr<IString>& propertyNames);
+
     DictPtr<IString, IFunctionBlockType> getAvailableFunctionBlockTypes(const std::string& globalId, bool isFb = false);
     ComponentHolderPtr addFunctionBlock(const std::string& globalId,
                                         const StringPtr& typeId,
@@ -136,6 +166,11 @@ public:
     void enableDiscovery(const std::string& globalId);
     void disableDiscovery(const std::string& globalId);
 
+    // Reads the values of all properties of the component and its descendants with pipelined requests.
+    // The result is keyed by the global IDs of the local components, each entry mapping property names to values.
+    // Function, procedure and object-type properties are skipped.
+    DictPtr<IString, IDict> prefetchPropertyValues(const ComponentPtr& component);
+
     bool getConnected() const;
     ContextPtr getDaqContext();
 
@@ -170,12 +205,21 @@ private:
     SendRequestCallback sendRequestCallback;
     SendNoReplyRequestCallback sendNoReplyRequestCallback;
     ComponentDeserializeCallback rootDeviceDeserializeCallback;
+    SendRequestAsyncCallback sendRequestAsyncCallback;
     bool connected;
     WeakRefPtr<IDevice> rootDeviceRef;
     uint16_t protocolVersion;
     std::weak_ptr<ConfigProtocolStreamingProducer> streamingProducerRef;
     LoggerComponentPtr loggerComponent;
 
+    struct BatchedUpdate
+    {
+        SizeT updateCount = 0;
+        ListPtr<IDict> operations;
+    };
+    std::unordered_map<std::string, BatchedUpdate> batchedUpdates;
+    std::mutex batchedUpdatesSync;
+
     void requireMinServerVersion(const ClientCommand& command);
     ComponentDeserializeContextPtr createDeserializeContext(const std::string& remoteGlobalId,
                                                             const ContextPtr& context,
@@ -191,6 +235,7 @@ private:
                                         const ComponentDeserializeContextPtr& context = nullptr,
                                         bool isGetRootDeviceReply = false);
     uint64_t generateId();
+    std::future<PacketBuffer> sendRequestAsync(PacketBuffer& requestPacketBuffer);
 
     BaseObjectPtr sendComponentCommand(const StringPtr& globalId,
                                        const ClientCommand& command,
@@ -231,6 +276,9 @@ public:
     // sendRequestCallback is called from this object when a request is available
     // it should send the packet and return reply packet
     //
+    // sendRequestAsyncCallback is optional; when set, it is used for pipelined requests and should send the packet
+    // and return a future of the reply packet without blocking. Otherwise pipelined requests fall back to sendRequestCallback
+    //
     // serverNotificationReceivedCallback is used by external code if for any reason needs to preprocess
     // server notification. it should return false when the notification should be handled by the ConfigProtocolClient
 
@@ -240,7 +288,8 @@ public:
                                   const HandleDaqPacketCallback& handleDaqPacketCallback,
                                   const SendPreprocessedPacketsCallback& sendPreprocessedPacketsCb,
                                   const ServerNotificationReceivedCallback& serverNotificationReceivedCallback,
-                                  const DowngradePacketStreamingCallback& downgradePacketStreamingCallback = nullptr);
+                                  const DowngradePacketStreamingCallback& downgradePacketStreamingCallback = nullptr,
+                                  const SendRequestAsyncCallback& sendRequestAsyncCallback = nullptr);
 
     // called from client module
     DevicePtr connect(const ComponentPtr& parent = nullptr, uint16_t protocolVersion = GetLatestConfigProtocolVersion());
@@ -284,7 +333,8 @@ ConfigProtocolClient<TRootDeviceImpl>::ConfigProtocolClient(const ContextPtr& da
                                                             const HandleDaqPacketCallback& handleDaqPacketCallback,
                                                             const SendPreprocessedPacketsCallback& sendPreprocessedPacketsCb,
                                                             const ServerNotificationReceivedCallback& serverNotificationReceivedCallback,
-                                                            const DowngradePacketStreamingCallback& downgradePacketStreamingCallback)
+                                                            const DowngradePacketStreamingCallback& downgradePacketStreamingCallback,
+                                                            const SendRequestAsyncCallback& sendRequestAsyncCallback)
     : daqContext(daqContext)
     , sendRequestCallback(sendRequestCallback)
     , serverNotificationReceivedCallback(serverNotificationReceivedCallback)
@@ -300,7 +350,8 @@ ConfigProtocolClient<TRootDeviceImpl>::ConfigProtocolClient(const ContextPtr& da
               [](ISerializedObject* serialized, IBaseObject* context, IFunction* factoryCallback, IBaseObject** obj)
               {
                   return TRootDeviceImpl::template Deserialize<TRootDeviceImpl>(serialized, context, factoryCallback, obj);
-              }))
+              },
+              sendRequestAsyncCallback))
 {
 }
 
@@ -498,14 +549,26 @@ ConfigProtocolClientCommPtr ConfigProtocolClient<TRootDeviceImpl>::getClientComm
 template<class TRootDeviceImpl>
 void ConfigProtocolClient<TRootDeviceImpl>::triggerNotificationPacket(const PacketBuffer& packet)
 {
-    const auto json = packet.parseServerNotification();
-
-    const auto deserializeContext = clientComm->createDeserializeContext(std::string{}, daqContext, clientComm->getRootDevice(), nullptr, nullptr, nullptr);
-    const auto obj = deserializer.deserialize(json, deserializeContext,
-                                              [this](const StringPtr& typeId, const SerializedObjectPtr& object, const BaseObjectPtr& context, const FunctionPtr& factoryCallback)
-                                              {
-                                                  return clientComm->deserializeConfigComponent(typeId, object, context, factoryCallback);
-                                              });
+    BaseObjectPtr obj;
+    if (packet.getPacketType() == PacketType::BinaryServerNotification)
+    {
+        const void* payload;
+        size_t payloadSize;
+        packet.parseBinaryServerNotification(payload, payloadSize);
+        obj = BinaryCoreEventDecoder().decode(payload, payloadSize);
+    }
+    else
+    {
+        const auto json = packet.parseServerNotification();
+
+        const auto deserializeContext = clientComm->createDeserializeContext(std::string{}, daqContext, clientComm->getRootDevice(), nullptr, nullptr, nullptr);
+        obj = deserializer.deserialize(json, deserializeContext,
+                                       [this](const StringPtr& typeId, const SerializedObjectPtr& object, const BaseObjectPtr& context, const FunctionPtr& factoryCallback)
+                                       {
+                                           return clientComm->deserializeConfigComponent(typeId, object, context, factoryCallback);
+                                       });
+    }
+
     // handle notifications in callback provided in constructor
     const bool processed = serverNotificationReceivedCallback ? serverNotificationReceivedCallback(obj) : false;
     // if callback not processed by callback, process it internally
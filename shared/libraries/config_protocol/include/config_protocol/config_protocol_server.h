@@ -18,10 +18,18 @@
 
 #include <config_protocol/config_protocol.h>
 #include <config_protocol/config_protocol_streaming_consumer.h>
+#include <config_protocol/core_event_encoding.h>
 #include <opendaq/device_ptr.h>
 
 #include <opendaq/component_holder_ptr.h>
 #include <opendaq/client_type.h>
+#include <coretypes/weakrefptr.h>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
 
 namespace daq::config_protocol
 {
@@ -32,17 +40,38 @@ class IComponentFinder
 {
 public:
     virtual ComponentPtr findComponent(const std::string& globalId) = 0;
+    virtual void processCoreEvent(const ComponentPtr& /*component*/, const CoreEventArgsPtr& /*eventArgs*/) {}
     virtual ~IComponentFinder() = default;
 };
 
+/*
+ * Resolves global IDs by walking the component tree of the root device. Resolved components are kept in an
+ * index of weak references, which is updated from component added/removed core events. An indexed component
+ * is validated on each lookup, so a component that was removed or moved within the tree is looked up again.
+ */
 class ComponentFinderRootDevice: public IComponentFinder
 {
 public:
     ComponentFinderRootDevice(DevicePtr rootDevice);
     ComponentPtr findComponent(const std::string& globalId) override;
+    void processCoreEvent(const ComponentPtr& component, const CoreEventArgsPtr& eventArgs) override;
+    size_t getIndexedComponentCount();
 private:
+    struct IndexEntry
+    {
+        WeakRefPtr<IComponent> component;
+        StringPtr componentGlobalId;
+    };
+
     DevicePtr rootDevice;
+    std::map<std::string, IndexEntry> index;
+    std::mutex indexSync;
+
     static ComponentPtr findComponentInternal(const ComponentPtr& component, const std::string& id);
+    ComponentPtr findComponentInTree(const std::string& globalId) const;
+    bool getIndexKey(const StringPtr& componentGlobalId, std::string& key) const;
+    void addToIndex(const std::string& key, const ComponentPtr& component);
+    void removeFromIndex(const StringPtr& componentGlobalId);
 };
 
 
@@ -85,6 +114,11 @@ public:
     void setProtocolVersion(uint16_t protocolVersion);
     SerializerPtr createSerializer();
 
+    // core events are collected for the duration of the window and sent in one notification, in which
+    // repeated value changes of the same property are replaced by the latest one; zero sends each event immediately
+    void setCoreEventCoalescingWindow(std::chrono::milliseconds window);
+    std::chrono::milliseconds getCoreEventCoalescingWindow();
+
 private:
     using DispatchFunction = std::function<BaseObjectPtr(const ParamsDictPtr&)>;
     template <typename T>
@@ -117,8 +151,18 @@ private:
     const std::set<uint16_t> supportedServerVersions;
     ConfigProtocolStreamingConsumer streamingConsumer;
     std::atomic<uint64_t> activeRpcCounter{0};
-    ListPtr<IBaseObject> packedCoreEvents;
+    std::vector<std::pair<StringPtr, CoreEventArgsPtr>> packedCoreEvents;
     std::mutex coreEventsLock;
+    std::recursive_mutex coreEventsSendLock;
+    BinaryCoreEventEncoder coreEventEncoder;
+    std::vector<uint8_t> coreEventPayload;
+
+    std::chrono::milliseconds coreEventCoalescingWindow;
+    std::unordered_map<std::string, size_t> coalescedValueChanges;
+    std::optional<std::chrono::steady_clock::time_point> coreEventFlushTime;
+    std::condition_variable coreEventFlushCv;
+    bool coreEventFlushStopped;
+    std::thread coreEventFlushThread;
 
     PacketBuffer processPacketAndGetReply(const PacketBuffer& packetBuffer);
     void processNoReplyPacket(const PacketBuffer& packetBuffer);
@@ -136,6 +180,7 @@ private:
     BaseObjectPtr connectExternalSignal(const RpcContext& context, const InputPortPtr& inputPort, const ParamsDictPtr& params);
     BaseObjectPtr changeInputPortStreamingSource(const RpcContext& context, const InputPortPtr& inputPort, const ParamsDictPtr& params);
     BaseObjectPtr removeExternalSignals(const ParamsDictPtr& params);
+    BaseObjectPtr batch(const ParamsDictPtr& params);
     BaseObjectPtr acceptsSignal(const RpcContext& context, const InputPortPtr& inputPort, const ParamsDictPtr& params);
     BaseObjectPtr acceptsSignals(const RpcContext& context, const InputPortPtr& inputPort, const ParamsDictPtr& params);
 
@@ -150,6 +195,11 @@ private:
     CoreEventArgsPtr processUpdateEndCoreEvent(const ComponentPtr& component, const CoreEventArgsPtr& args);
     CoreEventArgsPtr processAttributeChangedCoreEvent(const CoreEventArgsPtr& args);
     void SendOutCoreEvents();
+    ListPtr<IBaseObject> takePackedCoreEvents();
+    void sendCoreEventsNotification(const ListPtr<IBaseObject>& packedCoreEventsList);
+    bool isCoreEventCoalescingEnabled();
+    void sendOutOrScheduleCoreEvents();
+    void coreEventFlushLoop();
 };
 
 }
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <coretypes/listobject_factory.h>
+#include <vector>
+
+namespace daq::config_protocol
+{
+
+// Binary core event notification encodings, stored in the first byte of the notification payload
+static constexpr uint8_t CORE_EVENT_ENCODING_BINARY_V1 = 1;
+
+/*
+ * Compact binary encoding of packed core event notifications, i.e. lists of component global ID and
+ * core event arguments pairs. Covers event parameters made of null, bool, integer, float, string,
+ * ratio, list and dictionary values. Notifications with parameters of any other type can't be encoded
+ * and are expected to be sent as JSON instead.
+ */
+class BinaryCoreEventEncoder
+{
+public:
+    // Returns false if an event contains a value not supported by the binary encoding
+    bool encode(const ListPtr<IBaseObject>& packedCoreEvents, std::vector<uint8_t>& output);
+};
+
+class BinaryCoreEventDecoder
+{
+public:
+    // Throws ConfigProtocolException if the payload is malformed
+    ListPtr<IBaseObject> decode(const void* payload, size_t payloadSize);
+};
+
+}
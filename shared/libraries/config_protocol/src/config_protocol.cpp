@@ -316,6 +316,25 @@ StringPtr PacketBuffer::parseServerNotification() const
     return jsonStr;
 }
 
+PacketBuffer PacketBuffer::createBinaryServerNotification(const void* payload, size_t payloadSize)
+{
+    auto packetBuffer = PacketBuffer(PacketType::BinaryServerNotification, std::numeric_limits<uint64_t>::max(), payload, payloadSize);
+    return packetBuffer;
+}
+
+void PacketBuffer::parseBinaryServerNotification(const void*& payload, size_t& payloadSize) const
+{
+    if (getPacketType() != PacketType::BinaryServerNotification)
+        throw ConfigProtocolException("Invalid packet type");
+
+    payloadSize = getPayloadSize();
+
+    if (payloadSize == 0)
+        throw ConfigProtocolException("Invalid payload");
+
+    payload = getPayload();
+}
+
 PacketBuffer PacketBuffer::createNoReplyRpcRequest(const char* json, size_t jsonSize)
 {
     auto packetBuffer = PacketBuffer(PacketType::NoReplyRpc, std::numeric_limits<uint64_t>::max(), json, jsonSize);
@@ -45,12 +45,14 @@ ConfigProtocolClientComm::ConfigProtocolClientComm(const ContextPtr& daqContext,
                                                    SendRequestCallback sendRequestCallback,
                                                    SendNoReplyRequestCallback sendNoReplyRequestCallback,
                                                    const ConfigProtocolStreamingProducerPtr& streamingProducer,
-                                                   ComponentDeserializeCallback rootDeviceDeserializeCallback)
+                                                   ComponentDeserializeCallback rootDeviceDeserializeCallback,
+                                                   SendRequestAsyncCallback sendRequestAsyncCallback)
     : daqContext(daqContext)
     , id(0)
     , sendRequestCallback(std::move(sendRequestCallback))
     , sendNoReplyRequestCallback(std::move(sendNoReplyRequestCallback))
     , rootDeviceDeserializeCallback(std::move(rootDeviceDeserializeCallback))
+    , sendRequestAsyncCallback(std::move(sendRequestAsyncCallback))
     , connected(false)
     , protocolVersion(0)
     , streamingProducerRef(streamingProducer)
@@ -63,6 +65,17 @@ uint64_t ConfigProtocolClientComm::generateId()
     return std::atomic_fetch_add_explicit(&id, uint64_t(1), std::memory_order_relaxed);
 }
 
+std::future<PacketBuffer> ConfigProtocolClientComm::sendRequestAsync(PacketBuffer& requestPacketBuffer)
+{
+    if (sendRequestAsyncCallback)
+        return sendRequestAsyncCallback(requestPacketBuffer);
+
+    // without an asynchronous transport the request is completed before the future is returned
+    std::promise<PacketBuffer> replyPromise;
+    replyPromise.set_value(sendRequestCallback(requestPacketBuffer));
+    return replyPromise.get_future();
+}
+
 void ConfigProtocolClientComm::setPropertyValue(
     const std::string& globalId,
     const std::string& propertyName,
@@ -112,6 +125,23 @@ BaseObjectPtr ConfigProtocolClientComm::getPropertyValue(const std::string& glob
     return parseRpcOrRejectReply(getPropertyValueRpcReplyPacketBuffer.parseRpcRequestOrReply(), deserializeContext);
 }
 
+std::future<BaseObjectPtr> ConfigProtocolClientComm::getPropertyValueAsync(const std::string& globalId, const std::string& propertyName)
+{
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("ComponentGlobalId", String(globalId));
+    dict.set("PropertyName", String(propertyName));
+    auto getPropertyValueRpcRequestPacketBuffer = createRpcRequestPacketBuffer(generateId(), "GetPropertyValue", dict);
+    auto getPropertyValueRpcReplyFuture = sendRequestAsync(getPropertyValueRpcRequestPacketBuffer);
+
+    return std::async(std::launch::deferred,
+                      [self = shared_from_this(), replyFuture = std::move(getPropertyValueRpcReplyFuture)]() mutable
+                      {
+                          const auto replyPacketBuffer = replyFuture.get();
+                          const auto deserializeContext = self->createDeserializeContext(std::string{}, self->daqContext);
+                          return self->parseRpcOrRejectReply(replyPacketBuffer.parseRpcRequestOrReply(), deserializeContext);
+                      });
+}
+
 BaseObjectPtr ConfigProtocolClientComm::getSelectionValues(const std::string& globalId, const std::string& path, const std::string& propertyName)
 {
     auto dict = Dict<IString, IBaseObject>();
@@ -250,6 +280,146 @@ void ConfigProtocolClientComm::clearPropertyValues(const std::string& globalId,
     sendComponentCommand(globalId, ClientCommand("ClearPropertyValues", 22), params);    
 }
 
+ListPtr<IDict> ConfigProtocolClientComm::batch(const std::string& globalId, const ListPtr<IDict>& operations, const std::string& path)
+{
+    auto params = Dict<IString, IBaseObject>();
+    if (!globalId.empty())
+        params.set("ComponentGlobalId", String(globalId));
+    if (!path.empty())
+        params.set("Path", String(path));
+    params.set("Operations", operations);
+
+    requireMinServerVersion(ClientCommand("Batch", 25));
+
+    const auto deserializeContext = createDeserializeContext(std::string{}, daqContext);
+    auto batchRpcRequestPacketBuffer = createRpcRequestPacketBuffer(generateId(), "Batch", params);
+    const auto batchRpcReplyPacketBuffer = sendRequestCallback(batchRpcRequestPacketBuffer);
+    return parseRpcOrRejectReply(batchRpcReplyPacketBuffer.parseRpcRequestOrReply(), deserializeContext);
+}
+
+DictPtr<IString, IBaseObject> ConfigProtocolClientComm::createBatchOperation(const StringPtr& name, const ParamsDictPtr& params) const
+{
+    return createRpcRequest(name, params);
+}
+
+void ConfigProtocolClientComm::checkBatchResults(const ListPtr<IDict>& results)
+{
+    for (const DictPtr<IString, IBaseObject> result : results)
+    {
+        const ErrCode errCode = result.get("ErrorCode");
+        if (OPENDAQ_FAILED(errCode))
+        {
+            std::string msg = result.getOrDefault("ErrorMessage", "");
+            throwExceptionFromErrorCode(errCode, msg);
+        }
+    }
+}
+
+bool ConfigProtocolClientComm::isBatchSupported() const
+{
+    return protocolVersion >= 25;
+}
+
+void ConfigProtocolClientComm::beginBatchedUpdate(const std::string& globalId)
+{
+    std::scoped_lock lock(batchedUpdatesSync);
+    auto& batchedUpdate = batchedUpdates[globalId];
+    if (batchedUpdate.updateCount == 0)
+        batchedUpdate.operations = List<IDict>();
+    ++batchedUpdate.updateCount;
+}
+
+bool ConfigProtocolClientComm::tryAddBatchedOperation(const std::string& globalId, const StringPtr& name, ParamsDictPtr params)
+{
+    std::scoped_lock lock(batchedUpdatesSync);
+    const auto it = batchedUpdates.find(globalId);
+    if (it == batchedUpdates.end())
+        return false;
+
+    params.set("ComponentGlobalId", String(globalId));
+    it->second.operations.pushBack(createBatchOperation(name, params));
+    return true;
+}
+
+bool ConfigProtocolClientComm::endBatchedUpdate(const std::string& globalId, const std::string& path, ListPtr<IDict>& operations)
+{
+    std::scoped_lock lock(batchedUpdatesSync);
+    const auto it = batchedUpdates.find(globalId);
+    if (it == batchedUpdates.end())
+        return false;
+
+    auto params = Dict<IString, IBaseObject>({{"ComponentGlobalId", String(globalId)}});
+    if (!path.empty())
+        params.set("Path", String(path));
+    it->second.operations.pushBack(createBatchOperation("EndUpdate", params));
+
+    if (--it->second.updateCount == 0)
+    {
+        operations = std::move(it->second.operations);
+        batchedUpdates.erase(it);
+    }
+    return true;
+}
+
+void ConfigProtocolClientComm::setPropertyValues(const std::string& globalId, const DictPtr<IString, IBaseObject>& propertyValues)
+{
+    if (!isBatchSupported())
+    {
+        beginUpdate(globalId);
+        try
+        {
+            for (const auto& [propertyName, propertyValue] : propertyValues)
+                setPropertyValue(globalId, propertyName, propertyValue);
+        }
+        catch (...)
+        {
+            endUpdate(globalId);
+            throw;
+        }
+        endUpdate(globalId);
+        return;
+    }
+
+    auto operations = List<IDict>();
+    for (const auto& [propertyName, propertyValue] : propertyValues)
+    {
+        auto params = Dict<IString, IBaseObject>({{"ComponentGlobalId", String(globalId)},
+                                                  {"PropertyName", propertyName},
+                                                  {"PropertyValue", propertyValue}});
+        operations.pushBack(createBatchOperation("SetPropertyValue", params));
+    }
+
+    checkBatchResults(batch(globalId, operations));
+}
+
+DictPtr<IString, IBaseObject> ConfigProtocolClientComm::getPropertyValues(const std::string& globalId, const ListPtr<IString>& propertyNames)
+{
+    auto propertyValues = Dict<IString, IBaseObject>();
+    if (!isBatchSupported())
+    {
+        for (const auto& propertyName : propertyNames)
+            propertyValues.set(propertyName, getPropertyValue(globalId, propertyName));
+        return propertyValues;
+    }
+
+    auto operations = List<IDict>();
+    for (const auto& propertyName : propertyNames)
+    {
+        auto params = Dict<IString, IBaseObject>({{"ComponentGlobalId", String(globalId)}, {"PropertyName", propertyName}});
+        operations.pushBack(createBatchOperation("GetPropertyValue", params));
+    }
+
+    const auto results = batch(std::string{}, operations);
+    checkBatchResults(results);
+
+    for (SizeT i = 0; i < propertyNames.getCount(); ++i)
+    {
+        const DictPtr<IString, IBaseObject> result = results[i];
+        propertyValues.set(propertyNames[i], result.getOrDefault("ReturnValue"));
+    }
+    return propertyValues;
+}
+
 DictPtr<IString, IFunctionBlockType> ConfigProtocolClientComm::getAvailableFunctionBlockTypes(const std::string& globalId, bool isFb)
 {
     auto command = isFb ? ClientCommand("GetAvailableFunctionBlockTypes", 9) : ClientCommand("GetAvailableFunctionBlockTypes");
@@ -420,6 +590,46 @@ void ConfigProtocolClientComm::disableDiscovery(const std::string& globalId)
     sendComponentCommand(globalId, ClientCommand("DisableDiscovery", 24));
 }
 
+DictPtr<IString, IDict> ConfigProtocolClientComm::prefetchPropertyValues(const ComponentPtr& component)
+{
+    struct PendingPropertyValue
+    {
+        DictPtr<IString, IBaseObject> componentValues;
+        StringPtr propertyName;
+        std::future<BaseObjectPtr> value;
+    };
+
+    auto values = Dict<IString, IDict>();
+    std::vector<PendingPropertyValue> pendingValues;
+
+    // all requests are sent before waiting for the first reply, so the round trips overlap
+    forEachComponent<IComponent>(
+        component,
+        [this, &values, &pendingValues](const ComponentPtr& comp)
+        {
+            StringPtr remoteGlobalId;
+            checkErrorInfo(comp.asPtr<IConfigClientObject>(true)->getRemoteGlobalId(&remoteGlobalId));
+
+            auto componentValues = Dict<IString, IBaseObject>();
+            values.set(comp.getGlobalId(), componentValues);
+
+            for (const auto& prop : comp.getAllProperties())
+            {
+                const auto valueType = prop.getValueType();
+                if (valueType == ctFunc || valueType == ctProc || valueType == ctObject)
+                    continue;
+
+                const auto propName = prop.getName();
+                pendingValues.push_back({componentValues, propName, getPropertyValueAsync(remoteGlobalId, propName)});
+            }
+        });
+
+    for (auto& pendingValue : pendingValues)
+        pendingValue.componentValues.set(pendingValue.propertyName, pendingValue.value.get());
+
+    return values;
+}
+
 BaseObjectPtr ConfigProtocolClientComm::getLastValue(const std::string& globalId)
 {
     auto dict = Dict<IString, IBaseObject>();
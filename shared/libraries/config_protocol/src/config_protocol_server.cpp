@@ -16,6 +16,53 @@
 namespace daq::config_protocol
 {
 
+namespace
+{
+
+// Keeps the scope component of a batch in update, and ends the update even if the batch is left with an exception
+class BatchUpdateGuard
+{
+public:
+    BatchUpdateGuard(const RpcContext& context, ComponentPtr component, ParamsDictPtr params)
+        : context(context)
+        , component(std::move(component))
+        , params(std::move(params))
+    {
+        if (this->component.assigned())
+            ConfigServerComponent::beginUpdate(this->context, this->component, this->params);
+    }
+
+    ~BatchUpdateGuard()
+    {
+        try
+        {
+            end();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    BatchUpdateGuard(const BatchUpdateGuard&) = delete;
+    BatchUpdateGuard& operator=(const BatchUpdateGuard&) = delete;
+
+    void end()
+    {
+        if (!component.assigned())
+            return;
+
+        const auto updatedComponent = std::move(component);
+        ConfigServerComponent::endUpdate(context, updatedComponent, params);
+    }
+
+private:
+    const RpcContext& context;
+    ComponentPtr component;
+    ParamsDictPtr params;
+};
+
+}
+
 ComponentFinderRootDevice::ComponentFinderRootDevice(DevicePtr rootDevice)
     : rootDevice(std::move(rootDevice))
 {
@@ -50,11 +97,8 @@ ComponentPtr ComponentFinderRootDevice::findComponentInternal(const ComponentPtr
     return subComponent;
 }
 
-ComponentPtr ComponentFinderRootDevice::findComponent(const std::string& globalId)
-{         
-    if (globalId.find("/") != 0)
-        DAQ_THROW_EXCEPTION(InvalidParameterException, "Global id must start with /");
-
+ComponentPtr ComponentFinderRootDevice::findComponentInTree(const std::string& globalId) const
+{
     const std::string globalIdWithoutSlash = globalId.substr(1);
 
     std::string startStr;
@@ -73,6 +117,104 @@ ComponentPtr ComponentFinderRootDevice::findComponent(const std::string& globalI
     return nullptr;
 }
 
+ComponentPtr ComponentFinderRootDevice::findComponent(const std::string& globalId)
+{         
+    if (globalId.find("/") != 0)
+        DAQ_THROW_EXCEPTION(InvalidParameterException, "Global id must start with /");
+
+    {
+        std::scoped_lock lock(indexSync);
+        const auto it = index.find(globalId);
+        if (it != index.end())
+        {
+            // the component is dropped from the index if it was removed or moved since it was indexed
+            const ComponentPtr component = it->second.component.getRef();
+            if (component.assigned() && !component.isRemoved() && component.getGlobalId() == it->second.componentGlobalId)
+                return component;
+            index.erase(it);
+        }
+    }
+
+    const auto component = findComponentInTree(globalId);
+    if (component.assigned())
+        addToIndex(globalId, component);
+    return component;
+}
+
+void ComponentFinderRootDevice::processCoreEvent(const ComponentPtr& component, const CoreEventArgsPtr& eventArgs)
+{
+    if (!component.assigned())
+        return;
+
+    switch (static_cast<CoreEventId>(eventArgs.getEventId()))
+    {
+        case CoreEventId::ComponentAdded:
+        {
+            const ComponentPtr addedComponent = eventArgs.getParameters().get("Component");
+            std::string key;
+            if (getIndexKey(addedComponent.getGlobalId(), key))
+                addToIndex(key, addedComponent);
+            break;
+        }
+        case CoreEventId::ComponentRemoved:
+        {
+            const StringPtr removedId = eventArgs.getParameters().get("Id");
+            removeFromIndex(component.getGlobalId() + "/" + removedId);
+            break;
+        }
+        case CoreEventId::ComponentUpdateEnd:
+            // the sub-components might have been replaced by the update
+            removeFromIndex(component.getGlobalId());
+            break;
+        default:
+            break;
+    }
+}
+
+size_t ComponentFinderRootDevice::getIndexedComponentCount()
+{
+    std::scoped_lock lock(indexSync);
+    return index.size();
+}
+
+bool ComponentFinderRootDevice::getIndexKey(const StringPtr& componentGlobalId, std::string& key) const
+{
+    // global IDs are resolved relative to the root device, which might have a parent
+    const std::string rootGlobalId = rootDevice.getGlobalId();
+    const std::string globalId = componentGlobalId;
+    if (globalId.compare(0, rootGlobalId.size(), rootGlobalId) != 0)
+        return false;
+    if (globalId.size() > rootGlobalId.size() && globalId[rootGlobalId.size()] != '/')
+        return false;
+
+    key = "/" + rootDevice.getLocalId().toStdString() + globalId.substr(rootGlobalId.size());
+    return true;
+}
+
+void ComponentFinderRootDevice::addToIndex(const std::string& key, const ComponentPtr& component)
+{
+    std::scoped_lock lock(indexSync);
+    index.insert_or_assign(key, IndexEntry{component, component.getGlobalId()});
+}
+
+void ComponentFinderRootDevice::removeFromIndex(const StringPtr& componentGlobalId)
+{
+    std::string key;
+    if (!getIndexKey(componentGlobalId, key))
+        return;
+
+    // removes the component and all of its sub-components
+    std::scoped_lock lock(indexSync);
+    auto it = index.lower_bound(key);
+    while (it != index.end() && it->first.compare(0, key.size(), key) == 0)
+    {
+        if (it->first.size() == key.size() || it->first[key.size()] == '/')
+            it = index.erase(it);
+        else
+            ++it;
+    }
+}
+
 ConfigProtocolServer::ConfigProtocolServer(DevicePtr rootDevice,
                                            NotificationReadyCallback notificationReadyCallback,
                                            const UserPtr& user,
@@ -87,9 +229,10 @@ ConfigProtocolServer::ConfigProtocolServer(DevicePtr rootDevice,
     , user(user)
     , connectionType(connectionType)
     , protocolVersion(0)
-    , supportedServerVersions(std::set<uint16_t>({17, 18, 19, 20, 21, 22, 23, 24}))
+    , supportedServerVersions(std::set<uint16_t>({17, 18, 19, 20, 21, 22, 23, 24, 25, 26}))
     , streamingConsumer(this->daqContext, externalSignalsFolder)
-    , packedCoreEvents(List<IBaseObject>())
+    , coreEventCoalescingWindow(0)
+    , coreEventFlushStopped(false)
 {
     assert(user.assigned());
     notificationSerializer.setUser(user);
@@ -104,6 +247,14 @@ ConfigProtocolServer::~ConfigProtocolServer()
 {
     if (daqContext.assigned())
         daqContext.getOnCoreEvent() -= event(this, &ConfigProtocolServer::coreEventCallback);
+
+    {
+        std::scoped_lock lock(coreEventsLock);
+        coreEventFlushStopped = true;
+    }
+    coreEventFlushCv.notify_one();
+    if (coreEventFlushThread.joinable())
+        coreEventFlushThread.join();
 }
 
 template <class SmartPtr>
@@ -137,6 +288,7 @@ void ConfigProtocolServer::buildRpcDispatchStructure()
     rpcDispatch.insert({"GetTypeManager", std::bind(&ConfigProtocolServer::getTypeManager, this, _1)});
     rpcDispatch.insert({"GetSerializedRootDevice", std::bind(&ConfigProtocolServer::getSerializedRootDevice, this,  _1)});
     rpcDispatch.insert({"RemoveExternalSignals", std::bind(&ConfigProtocolServer::removeExternalSignals, this,  _1)});
+    rpcDispatch.insert({"Batch", std::bind(&ConfigProtocolServer::batch, this,  _1)});
 
     addHandler<ComponentPtr>("SetPropertyValue", &ConfigServerComponent::setPropertyValue);
     addHandler<ComponentPtr>("GetPropertyValue", &ConfigServerComponent::getPropertyValue);
@@ -536,6 +688,68 @@ BaseObjectPtr ConfigProtocolServer::removeExternalSignals(const ParamsDictPtr& p
     return nullptr;
 }
 
+BaseObjectPtr ConfigProtocolServer::batch(const ParamsDictPtr& params)
+{
+    const ListPtr<IDict> operations = params.get("Operations");
+
+    RpcContext context;
+    context.protocolVersion = protocolVersion;
+    context.user = user;
+    context.connectionType = connectionType;
+
+    // the operations are executed within one update of the scope component, so its change events are sent once
+    ComponentPtr scopeComponent;
+    if (params.hasKey("ComponentGlobalId"))
+    {
+        const auto componentGlobalId = static_cast<std::string>(params.get("ComponentGlobalId"));
+        scopeComponent = findComponent(componentGlobalId);
+        if (!scopeComponent.assigned())
+            DAQ_THROW_EXCEPTION(NotFoundException, "Component not found {}", componentGlobalId);
+    }
+
+    BatchUpdateGuard updateGuard(context, scopeComponent, params);
+
+    auto results = List<IDict>();
+    for (const DictPtr<IString, IBaseObject> operation : operations)
+    {
+        auto result = Dict<IString, IBaseObject>();
+        try
+        {
+            const StringPtr name = operation.get("Name");
+            if (name == "Batch")
+                DAQ_THROW_EXCEPTION(InvalidParameterException, "Batches cannot be nested");
+
+            const auto it = rpcDispatch.find(name.toStdString());
+            if (it == rpcDispatch.end())
+                throw ConfigProtocolException(fmt::format("Invalid function call: {}", name));
+
+            ParamsDictPtr operationParams = operation.getOrDefault("Params");
+            if (!operationParams.assigned())
+                operationParams = Dict<IString, IBaseObject>();
+
+            const auto retValue = it->second(operationParams);
+            result.set("ErrorCode", OPENDAQ_SUCCESS);
+            if (retValue.assigned())
+                result.set("ReturnValue", retValue);
+        }
+        catch (const DaqException& e)
+        {
+            result.set("ErrorCode", e.getErrCode());
+            result.set("ErrorMessage", e.what());
+        }
+        catch (const std::exception& e)
+        {
+            result.set("ErrorCode", OPENDAQ_ERR_GENERALERROR);
+            result.set("ErrorMessage", e.what());
+        }
+
+        results.pushBack(result);
+    }
+
+    updateGuard.end();
+    return results;
+}
+
 BaseObjectPtr ConfigProtocolServer::acceptsSignal(const RpcContext& context, const InputPortPtr& inputPort, const ParamsDictPtr& params)
 {
     const StringPtr signalId = params.get("SignalId");
@@ -557,11 +771,13 @@ BaseObjectPtr ConfigProtocolServer::acceptsSignals(const RpcContext& context, co
 
 void ConfigProtocolServer::coreEventCallback(ComponentPtr& component, CoreEventArgsPtr& eventArgs)
 {
+    componentFinder->processCoreEvent(component, eventArgs);
+
     if (isForwardedCoreEvent(component, eventArgs))
     {
         packCoreEvent(component, eventArgs);
         if (protocolVersion < 20 || activeRpcCounter.load(std::memory_order_acquire) == 0)
-            SendOutCoreEvents();
+            sendOutOrScheduleCoreEvents();
     }
 }
 
@@ -635,8 +851,22 @@ void ConfigProtocolServer::packCoreEvent(const ComponentPtr& component, const Co
     }
     
     std::scoped_lock lock(coreEventsLock);
-    packedCoreEvents.pushBack(globalId);
-    packedCoreEvents.pushBack(packedArgs);
+    if (isCoreEventCoalescingEnabled() && packedArgs.getEventId() == static_cast<Int>(CoreEventId::PropertyValueChanged))
+    {
+        // only the latest value change of a property is kept; the earlier one is dropped from the pending events
+        const auto params = packedArgs.getParameters();
+        const StringPtr path = params.getOrDefault("Path");
+        const std::string key = globalId.toStdString() + "/" + (path.assigned() ? path.toStdString() : "") + "/" +
+                                params.get("Name").asPtr<IString>().toStdString();
+        const auto [it, inserted] = coalescedValueChanges.try_emplace(key, packedCoreEvents.size());
+        if (!inserted)
+        {
+            packedCoreEvents[it->second].second = nullptr;
+            it->second = packedCoreEvents.size();
+        }
+    }
+
+    packedCoreEvents.emplace_back(globalId, packedArgs);
 }
 
 CoreEventArgsPtr ConfigProtocolServer::processCoreEventArgs(const CoreEventArgsPtr& args)
@@ -738,14 +968,123 @@ void ConfigProtocolServer::setProtocolVersion(uint16_t protocolVersion)
 }
 
 void ConfigProtocolServer::SendOutCoreEvents()
+{
+    // senders are serialized to keep the notifications in order, while packing new events only waits for coreEventsLock
+    std::scoped_lock sendLock(coreEventsSendLock);
+
+    ListPtr<IBaseObject> packedCoreEventsTmp;
+    {
+        std::scoped_lock lock(coreEventsLock);
+        packedCoreEventsTmp = takePackedCoreEvents();
+    }
+
+    if (packedCoreEventsTmp.assigned())
+        sendCoreEventsNotification(packedCoreEventsTmp);
+}
+
+void ConfigProtocolServer::sendCoreEventsNotification(const ListPtr<IBaseObject>& packedCoreEventsList)
+{
+    // events with values not covered by the binary encoding are sent as JSON
+    if (protocolVersion >= 26 && notificationReadyCallback && coreEventEncoder.encode(packedCoreEventsList, coreEventPayload))
+    {
+        const auto packet = PacketBuffer::createBinaryServerNotification(coreEventPayload.data(), coreEventPayload.size());
+        notificationReadyCallback(packet);
+        return;
+    }
+
+    sendNotification(packedCoreEventsList);
+}
+
+ListPtr<IBaseObject> ConfigProtocolServer::takePackedCoreEvents()
+{
+    if (packedCoreEvents.empty())
+        return nullptr;
+
+    // sendNotification may throw an exception within the tests bcs client code called directly there, so first reset list of accumulated events before sending
+    auto packedCoreEventsTmp = List<IBaseObject>();
+    for (const auto& [globalId, args] : packedCoreEvents)
+    {
+        if (!args.assigned())
+            continue;
+        packedCoreEventsTmp.pushBack(globalId);
+        packedCoreEventsTmp.pushBack(args);
+    }
+    packedCoreEvents.clear();
+    coalescedValueChanges.clear();
+    coreEventFlushTime.reset();
+    return packedCoreEventsTmp;
+}
+
+void ConfigProtocolServer::setCoreEventCoalescingWindow(std::chrono::milliseconds window)
+{
+    {
+        std::scoped_lock lock(coreEventsLock);
+        coreEventCoalescingWindow = window;
+        if (window.count() > 0 && !coreEventFlushThread.joinable())
+            coreEventFlushThread = std::thread([this] { coreEventFlushLoop(); });
+    }
+
+    if (window.count() == 0)
+        SendOutCoreEvents();
+}
+
+std::chrono::milliseconds ConfigProtocolServer::getCoreEventCoalescingWindow()
 {
     std::scoped_lock lock(coreEventsLock);
-    if (packedCoreEvents.getCount() > 0)
+    return coreEventCoalescingWindow;
+}
+
+bool ConfigProtocolServer::isCoreEventCoalescingEnabled()
+{
+    // older clients expect each event to be sent immediately
+    return protocolVersion >= 20 && coreEventCoalescingWindow.count() > 0;
+}
+
+void ConfigProtocolServer::sendOutOrScheduleCoreEvents()
+{
     {
-        // sendNotification may throw an exception within the tests bcs client code called directly there, so first reset list of accumulated events before sending
-        ListPtr<IBaseObject> packedCoreEventsTmp = packedCoreEvents;
-        packedCoreEvents = List<IBaseObject>();
-        sendNotification(packedCoreEventsTmp);
+        std::scoped_lock lock(coreEventsLock);
+        if (isCoreEventCoalescingEnabled())
+        {
+            if (!coreEventFlushTime.has_value() && !packedCoreEvents.empty())
+            {
+                coreEventFlushTime = std::chrono::steady_clock::now() + coreEventCoalescingWindow;
+                coreEventFlushCv.notify_one();
+            }
+            return;
+        }
+    }
+
+    SendOutCoreEvents();
+}
+
+void ConfigProtocolServer::coreEventFlushLoop()
+{
+    std::unique_lock lock(coreEventsLock);
+    while (true)
+    {
+        coreEventFlushCv.wait(lock, [this] { return coreEventFlushStopped || coreEventFlushTime.has_value(); });
+        if (coreEventFlushStopped)
+            return;
+
+        const auto flushTime = coreEventFlushTime.value();
+        if (coreEventFlushCv.wait_until(lock, flushTime, [this] { return coreEventFlushStopped; }))
+            return;
+
+        // the events might have been sent meanwhile, and new ones scheduled for later
+        if (!coreEventFlushTime.has_value() || coreEventFlushTime.value() > std::chrono::steady_clock::now())
+            continue;
+
+        // events packed during an RPC are sent when the RPC completes
+        if (activeRpcCounter.load(std::memory_order_acquire) != 0)
+        {
+            coreEventFlushTime.reset();
+            continue;
+        }
+
+        lock.unlock();
+        SendOutCoreEvents();
+        lock.lock();
     }
 }
 
@@ -758,6 +1097,7 @@ ConfigProtocolServer::RpcScopeTracker::RpcScopeTracker(ConfigProtocolServer& con
 ConfigProtocolServer::RpcScopeTracker::~RpcScopeTracker()
 {
     this->configServerRef.activeRpcCounter.fetch_sub(1, std::memory_order_acq_rel);
+    // pending events are sent before the reply, so the client observes the changes made by its own request
     this->configServerRef.SendOutCoreEvents();
 }
 
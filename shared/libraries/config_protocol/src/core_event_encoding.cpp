@@ -0,0 +1,396 @@
+#include <config_protocol/core_event_encoding.h>
+#include <config_protocol/config_protocol.h>
+#include <coreobjects/core_event_args_factory.h>
+#include <coretypes/boolean_factory.h>
+#include <coretypes/dictobject_factory.h>
+#include <coretypes/float_factory.h>
+#include <coretypes/integer_factory.h>
+#include <coretypes/stringobject_factory.h>
+#include <coretypes/list_element_type.h>
+#include <coretypes/dict_element_type.h>
+#include <coretypes/ratio_factory.h>
+#include <cstring>
+
+namespace daq::config_protocol
+{
+
+namespace
+{
+
+enum class ValueTag : uint8_t
+{
+    Null = 0,
+    False,
+    True,
+    Integer,
+    Float,
+    String,
+    Ratio,
+    List,
+    Dict
+};
+
+class Writer
+{
+public:
+    explicit Writer(std::vector<uint8_t>& output)
+        : output(output)
+    {
+    }
+
+    void writeByte(uint8_t value)
+    {
+        output.push_back(value);
+    }
+
+    void writeTag(ValueTag tag)
+    {
+        output.push_back(static_cast<uint8_t>(tag));
+    }
+
+    void writeUInt(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            output.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        output.push_back(static_cast<uint8_t>(value));
+    }
+
+    // zig-zag encoded so that small negative values are compact as well
+    void writeInt(int64_t value)
+    {
+        writeUInt((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    void writeFloat(double value)
+    {
+        writeRaw(&value, sizeof(value));
+    }
+
+    void writeString(const StringPtr& value)
+    {
+        const auto length = value.getLength();
+        writeUInt(length);
+        writeRaw(value.getCharPtr(), length);
+    }
+
+    void writeIntfId(const IntfID& id)
+    {
+        if (id == IUnknown::Id)
+        {
+            writeByte(0);
+        }
+        else
+        {
+            writeByte(1);
+            writeRaw(&id, sizeof(IntfID));
+        }
+    }
+
+    bool writeValue(const BaseObjectPtr& value);
+
+private:
+    std::vector<uint8_t>& output;
+
+    void writeRaw(const void* data, size_t size)
+    {
+        const auto bytes = static_cast<const uint8_t*>(data);
+        output.insert(output.end(), bytes, bytes + size);
+    }
+
+    bool writeList(const ListPtr<IBaseObject>& value);
+    bool writeDict(const DictPtr<IBaseObject, IBaseObject>& value);
+};
+
+bool Writer::writeValue(const BaseObjectPtr& value)
+{
+    if (!value.assigned())
+    {
+        writeTag(ValueTag::Null);
+        return true;
+    }
+
+    switch (value.getCoreType())
+    {
+        case ctBool:
+            writeTag(static_cast<bool>(value) ? ValueTag::True : ValueTag::False);
+            return true;
+        case ctInt:
+            writeTag(ValueTag::Integer);
+            writeInt(static_cast<Int>(value));
+            return true;
+        case ctFloat:
+            writeTag(ValueTag::Float);
+            writeFloat(static_cast<Float>(value));
+            return true;
+        case ctString:
+            writeTag(ValueTag::String);
+            writeString(value);
+            return true;
+        case ctRatio:
+        {
+            const RatioPtr ratio = value;
+            writeTag(ValueTag::Ratio);
+            writeInt(ratio.getNumerator());
+            writeInt(ratio.getDenominator());
+            return true;
+        }
+        case ctList:
+            return writeList(value);
+        case ctDict:
+            return writeDict(value);
+        default:
+            return false;
+    }
+}
+
+bool Writer::writeList(const ListPtr<IBaseObject>& value)
+{
+    IntfID elementId = IUnknown::Id;
+    if (const auto elementType = value.asPtrOrNull<IListElementType>(true); elementType.assigned())
+        elementType->getElementInterfaceId(&elementId);
+
+    writeTag(ValueTag::List);
+    writeIntfId(elementId);
+    writeUInt(value.getCount());
+    for (const auto& item : value)
+    {
+        if (!writeValue(item))
+            return false;
+    }
+    return true;
+}
+
+bool Writer::writeDict(const DictPtr<IBaseObject, IBaseObject>& value)
+{
+    IntfID keyId = IUnknown::Id;
+    IntfID valueId = IUnknown::Id;
+    if (const auto elementType = value.asPtrOrNull<IDictElementType>(true); elementType.assigned())
+    {
+        elementType->getKeyInterfaceId(&keyId);
+        elementType->getValueInterfaceId(&valueId);
+    }
+
+    writeTag(ValueTag::Dict);
+    writeIntfId(keyId);
+    writeIntfId(valueId);
+    writeUInt(value.getCount());
+    for (const auto& [key, item] : value)
+    {
+        if (!writeValue(key) || !writeValue(item))
+            return false;
+    }
+    return true;
+}
+
+class Reader
+{
+public:
+    Reader(const uint8_t* data, size_t size)
+        : current(data)
+        , end(data + size)
+    {
+    }
+
+    uint8_t readByte()
+    {
+        if (current == end)
+            throwMalformed();
+        return *current++;
+    }
+
+    uint64_t readUInt()
+    {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+            const uint8_t byte = readByte();
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return value;
+        }
+        throwMalformed();
+    }
+
+    int64_t readInt()
+    {
+        const uint64_t value = readUInt();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    double readFloat()
+    {
+        double value;
+        readRaw(&value, sizeof(value));
+        return value;
+    }
+
+    StringPtr readString()
+    {
+        const auto length = readSize();
+        const auto chars = reinterpret_cast<ConstCharPtr>(current);
+        current += length;
+        return String(chars, length);
+    }
+
+    IntfID readIntfId()
+    {
+        IntfID id = IUnknown::Id;
+        if (readByte())
+            readRaw(&id, sizeof(IntfID));
+        return id;
+    }
+
+    BaseObjectPtr readValue();
+
+    bool atEnd() const
+    {
+        return current == end;
+    }
+
+    [[noreturn]] static void throwMalformed()
+    {
+        throw ConfigProtocolException("Malformed binary core event notification payload");
+    }
+
+private:
+    const uint8_t* current;
+    const uint8_t* end;
+
+    size_t readSize()
+    {
+        const auto size = readUInt();
+        if (size > static_cast<uint64_t>(end - current))
+            throwMalformed();
+        return static_cast<size_t>(size);
+    }
+
+    void readRaw(void* data, size_t size)
+    {
+        if (size > static_cast<size_t>(end - current))
+            throwMalformed();
+        std::memcpy(data, current, size);
+        current += size;
+    }
+
+    BaseObjectPtr readList();
+    BaseObjectPtr readDict();
+};
+
+BaseObjectPtr Reader::readValue()
+{
+    switch (static_cast<ValueTag>(readByte()))
+    {
+        case ValueTag::Null:
+            return nullptr;
+        case ValueTag::False:
+            return Boolean(false);
+        case ValueTag::True:
+            return Boolean(true);
+        case ValueTag::Integer:
+            return Integer(readInt());
+        case ValueTag::Float:
+            return Floating(readFloat());
+        case ValueTag::String:
+            return readString();
+        case ValueTag::Ratio:
+        {
+            const auto numerator = readInt();
+            const auto denominator = readInt();
+            return Ratio(numerator, denominator);
+        }
+        case ValueTag::List:
+            return readList();
+        case ValueTag::Dict:
+            return readDict();
+        default:
+            throwMalformed();
+    }
+}
+
+BaseObjectPtr Reader::readList()
+{
+    ListPtr<IBaseObject> list(ListWithElementType_Create(readIntfId()));
+
+    const auto count = readSize();
+    for (size_t i = 0; i < count; ++i)
+        list.pushBack(readValue());
+    return list;
+}
+
+BaseObjectPtr Reader::readDict()
+{
+    const auto keyId = readIntfId();
+    const auto valueId = readIntfId();
+
+    DictPtr<IBaseObject, IBaseObject> dict(DictWithExpectedTypes_Create(keyId, valueId));
+
+    const auto count = readSize();
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto key = readValue();
+        dict.set(key, readValue());
+    }
+    return dict;
+}
+
+}
+
+bool BinaryCoreEventEncoder::encode(const ListPtr<IBaseObject>& packedCoreEvents, std::vector<uint8_t>& output)
+{
+    output.clear();
+
+    const auto count = packedCoreEvents.getCount();
+    if (count % 2 != 0)
+        return false;
+
+    Writer writer(output);
+    writer.writeByte(CORE_EVENT_ENCODING_BINARY_V1);
+    writer.writeUInt(count / 2);
+    for (SizeT i = 0; i < count; i += 2)
+    {
+        const StringPtr globalId = packedCoreEvents[i].asPtrOrNull<IString>(true);
+        const CoreEventArgsPtr args = packedCoreEvents[i + 1].asPtrOrNull<ICoreEventArgs>(true);
+        if (!globalId.assigned() || !args.assigned())
+            return false;
+
+        writer.writeString(globalId);
+        writer.writeInt(args.getEventId());
+        writer.writeString(args.getEventName());
+        if (!writer.writeValue(args.getParameters()))
+            return false;
+    }
+    return true;
+}
+
+ListPtr<IBaseObject> BinaryCoreEventDecoder::decode(const void* payload, size_t payloadSize)
+{
+    Reader reader(static_cast<const uint8_t*>(payload), payloadSize);
+
+    if (reader.readByte() != CORE_EVENT_ENCODING_BINARY_V1)
+        Reader::throwMalformed();
+
+    auto packedCoreEvents = List<IBaseObject>();
+    const auto count = reader.readUInt();
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        const auto globalId = reader.readString();
+        const auto eventId = static_cast<CoreEventId>(reader.readInt());
+        const auto eventName = reader.readString();
+        const DictPtr<IString, IBaseObject> parameters = reader.readValue().asPtrOrNull<IDict>();
+        if (!parameters.assigned())
+            Reader::throwMalformed();
+
+        packedCoreEvents.pushBack(globalId);
+        packedCoreEvents.pushBack(CoreEventArgs(eventId, eventName, parameters));
+    }
+
+    if (!reader.atEnd())
+        Reader::throwMalformed();
+
+    return packedCoreEvents;
+}
+
+}
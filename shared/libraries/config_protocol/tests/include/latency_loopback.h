@@ -0,0 +1,110 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <config_protocol/config_protocol_server.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace daq::config_protocol
+{
+
+// Processes requests on a separate thread, delaying each reply by a fixed latency as a network link would
+class LatencyLoopback
+{
+public:
+    LatencyLoopback(ConfigProtocolServer& server, std::chrono::microseconds latency)
+        : server(server)
+        , latency(latency)
+        , maxPendingCount(0)
+        , stopped(false)
+        , thread([this] { run(); })
+    {
+    }
+
+    ~LatencyLoopback()
+    {
+        {
+            std::scoped_lock lock(sync);
+            stopped = true;
+        }
+        cv.notify_one();
+        thread.join();
+    }
+
+    std::future<PacketBuffer> sendRequest(const PacketBuffer& requestPacket)
+    {
+        std::promise<PacketBuffer> replyPromise;
+        auto replyFuture = replyPromise.get_future();
+        {
+            std::scoped_lock lock(sync);
+            pendingRequests.push_back(
+                {std::chrono::steady_clock::now() + latency, PacketBuffer(requestPacket.getBuffer(), true), std::move(replyPromise)});
+            maxPendingCount = std::max(maxPendingCount, pendingRequests.size());
+        }
+        cv.notify_one();
+        return replyFuture;
+    }
+
+    size_t getMaxPendingCount()
+    {
+        std::scoped_lock lock(sync);
+        return maxPendingCount;
+    }
+
+private:
+    struct PendingRequest
+    {
+        std::chrono::steady_clock::time_point replyTime;
+        PacketBuffer requestPacket;
+        std::promise<PacketBuffer> replyPromise;
+    };
+
+    void run()
+    {
+        std::unique_lock lock(sync);
+        while (true)
+        {
+            cv.wait(lock, [this] { return stopped || !pendingRequests.empty(); });
+            if (stopped)
+                return;
+
+            auto request = std::move(pendingRequests.front());
+            pendingRequests.pop_front();
+
+            lock.unlock();
+            std::this_thread::sleep_until(request.replyTime);
+            request.replyPromise.set_value(server.processRequestAndGetReply(request.requestPacket));
+            lock.lock();
+        }
+    }
+
+    ConfigProtocolServer& server;
+    std::chrono::microseconds latency;
+    std::mutex sync;
+    std::condition_variable cv;
+    std::deque<PendingRequest> pendingRequests;
+    size_t maxPendingCount;
+    bool stopped;
+    std::thread thread;
+};
+
+}
@@ -498,6 +498,12 @@ TEST_F(ConfigProtocolTest, BeginEndUpdateWithProps)
     ASSERT_EQ(device->getPropertyValue("PropName"), "val");
 }
 
+TEST_F(ConfigProtocolTest, BatchNotSupported)
+{
+    // protocol version is not negotiated without connecting
+    ASSERT_THROW(client->getClientComm()->batch("//root", List<IDict>()), ServerVersionTooLowException);
+}
+
 TEST_F(ConfigProtocolTest, SetNameAndDescriptionAttribute)
 {
     StringPtr deviceName;
@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <config_protocol/config_protocol.h>
+#include <config_protocol/core_event_encoding.h>
+#include <coreobjects/core_event_args_factory.h>
+#include <coreobjects/property_object_factory.h>
+#include <coretypes/ratio_factory.h>
+#include <cstring>
 
 using namespace daq;
 using namespace config_protocol;
@@ -171,6 +176,79 @@ TEST_F(ConfigPacketTest, ServerNotification)
     ASSERT_EQ(json1, json);
 }
 
+TEST_F(ConfigPacketTest, BinaryServerNotification)
+{
+    const std::vector<uint8_t> buf = {0, 1, 2, 3, 4, 5, 6, 7};
+    const auto packetBufferSource = PacketBuffer::createBinaryServerNotification(buf.data(), buf.size());
+
+    const PacketBuffer packetBuffer(packetBufferSource.getBuffer(), false);
+
+    ASSERT_EQ(packetBuffer.getPacketType(), PacketType::BinaryServerNotification);
+    ASSERT_EQ(packetBuffer.getId(), std::numeric_limits<uint64_t>::max());
+
+    const void* payload;
+    size_t payloadSize;
+    packetBuffer.parseBinaryServerNotification(payload, payloadSize);
+
+    ASSERT_EQ(payloadSize, buf.size());
+    ASSERT_EQ(std::memcmp(payload, buf.data(), buf.size()), 0);
+    ASSERT_THROW(packetBuffer.parseServerNotification(), ConfigProtocolException);
+}
+
+TEST_F(ConfigPacketTest, BinaryCoreEventEncoding)
+{
+    const auto parameters = Dict<IString, IBaseObject>({{"Name", "Prop"},
+                                                        {"Value", -3.5},
+                                                        {"Path", ""},
+                                                        {"Ratio", Ratio(1, 1000)},
+                                                        {"Tags", List<IString>("a", "b")},
+                                                        {"Count", 42},
+                                                        {"Enabled", true},
+                                                        {"Empty", nullptr}});
+    const auto packedCoreEvents = List<IBaseObject>("/dev/IO/AI/Ch",
+                                                    CoreEventArgs(CoreEventId::PropertyValueChanged, "PropertyValueChanged", parameters),
+                                                    "",
+                                                    CoreEventArgs(CoreEventId::TypeRemoved, "TypeRemoved", Dict<IString, IBaseObject>({{"TypeName", "Foo"}})));
+
+    std::vector<uint8_t> payload;
+    ASSERT_TRUE(BinaryCoreEventEncoder().encode(packedCoreEvents, payload));
+    const auto decoded = BinaryCoreEventDecoder().decode(payload.data(), payload.size());
+
+    ASSERT_EQ(decoded.getCount(), 4u);
+    ASSERT_EQ(decoded[0], "/dev/IO/AI/Ch");
+    ASSERT_EQ(decoded[2], "");
+
+    const CoreEventArgsPtr args = decoded[1];
+    ASSERT_EQ(args.getEventId(), static_cast<Int>(CoreEventId::PropertyValueChanged));
+    ASSERT_EQ(args.getEventName(), "PropertyValueChanged");
+    ASSERT_EQ(args.getParameters(), parameters);
+    ASSERT_EQ(args.getParameters().get("Tags").asPtr<IList>().getElementInterfaceId(), IString::Id);
+
+    const CoreEventArgsPtr typeArgs = decoded[3];
+    ASSERT_EQ(typeArgs.getEventId(), static_cast<Int>(CoreEventId::TypeRemoved));
+    ASSERT_EQ(typeArgs.getParameters().get("TypeName"), "Foo");
+}
+
+TEST_F(ConfigPacketTest, BinaryCoreEventEncodingUnsupportedValue)
+{
+    const auto parameters = Dict<IString, IBaseObject>({{"Name", "Prop"}, {"Value", PropertyObject()}, {"Path", ""}});
+    const auto packedCoreEvents = List<IBaseObject>("/dev", CoreEventArgs(CoreEventId::PropertyValueChanged, "PropertyValueChanged", parameters));
+
+    std::vector<uint8_t> payload;
+    ASSERT_FALSE(BinaryCoreEventEncoder().encode(packedCoreEvents, payload));
+}
+
+TEST_F(ConfigPacketTest, BinaryCoreEventDecodingMalformed)
+{
+    const auto packedCoreEvents = List<IBaseObject>("/dev", CoreEventArgs(CoreEventId::TypeRemoved, "TypeRemoved", Dict<IString, IBaseObject>({{"TypeName", "Foo"}})));
+
+    std::vector<uint8_t> payload;
+    ASSERT_TRUE(BinaryCoreEventEncoder().encode(packedCoreEvents, payload));
+    payload.pop_back();
+
+    ASSERT_THROW(BinaryCoreEventDecoder().decode(payload.data(), payload.size()), ConfigProtocolException);
+}
+
 TEST_F(ConfigPacketTest, NoReplyRpcRequest)
 {
     const std::string json{"str"};
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <config_protocol/config_protocol_server.h>
+#include <config_protocol/config_protocol_client.h>
+#include <config_protocol/config_client_device_impl.h>
+#include <opendaq/mock/advanced_components_setup_utils.h>
+#include <opendaq/context_factory.h>
+#include <coreobjects/user_factory.h>
+#include <latency_loopback.h>
+
+using namespace daq;
+using namespace config_protocol;
+using namespace testing;
+
+class ConfigProtocolAsyncTest : public Test
+{
+public:
+    void SetUp() override
+    {
+        serverDevice = test_utils::createTestDevice();
+        server = std::make_unique<ConfigProtocolServer>(
+            serverDevice,
+            [](const PacketBuffer&) {},
+            User("", ""),
+            ClientType::Control,
+            test_utils::dummyExtSigFolder(serverDevice.getContext()));
+        loopback = std::make_unique<LatencyLoopback>(*server, std::chrono::milliseconds(20));
+
+        client = std::make_unique<ConfigProtocolClient<ConfigClientDeviceImpl>>(
+            NullContext(),
+            [this](const PacketBuffer& requestPacket) { return server->processRequestAndGetReply(requestPacket); },
+            [this](const PacketBuffer& requestPacket) { server->processNoReplyRequest(requestPacket); },
+            nullptr,
+            nullptr,
+            nullptr,
+            nullptr,
+            [this](const PacketBuffer& requestPacket) { return loopback->sendRequest(requestPacket); });
+        clientDevice = client->connect();
+    }
+
+    void TearDown() override
+    {
+        loopback.reset();
+    }
+
+protected:
+    DevicePtr serverDevice;
+    DevicePtr clientDevice;
+    std::unique_ptr<ConfigProtocolServer> server;
+    std::unique_ptr<LatencyLoopback> loopback;
+    std::unique_ptr<ConfigProtocolClient<ConfigClientDeviceImpl>> client;
+};
+
+TEST_F(ConfigProtocolAsyncTest, GetPropertyValueAsync)
+{
+    const auto clientComm = client->getClientComm();
+    const auto fb = serverDevice.getDevices()[0].getFunctionBlocks()[0];
+    fb.setPropertyValue("MockString", "Async");
+
+    std::vector<std::future<BaseObjectPtr>> values;
+    for (int i = 0; i < 10; ++i)
+        values.push_back(clientComm->getPropertyValueAsync(fb.getGlobalId(), "MockString"));
+
+    for (auto& value : values)
+        ASSERT_EQ(value.get(), "Async");
+
+    ASSERT_GT(loopback->getMaxPendingCount(), 1u);
+}
+
+TEST_F(ConfigProtocolAsyncTest, GetPropertyValueAsyncError)
+{
+    auto value = client->getClientComm()->getPropertyValueAsync(serverDevice.getGlobalId(), "InvalidProperty");
+    ASSERT_ANY_THROW(value.get());
+}
+
+TEST_F(ConfigProtocolAsyncTest, PrefetchPropertyValues)
+{
+    const auto clientFb = clientDevice.getDevices()[0].getFunctionBlocks()[0];
+    serverDevice.getDevices()[0].getFunctionBlocks()[0].setPropertyValue("MockString", "Prefetched");
+
+    const auto values = client->getClientComm()->prefetchPropertyValues(clientDevice);
+
+    ASSERT_TRUE(values.hasKey(clientDevice.getGlobalId()));
+    ASSERT_TRUE(values.hasKey(clientFb.getGlobalId()));
+    ASSERT_EQ(values.get(clientFb.getGlobalId()).get("MockString"), "Prefetched");
+    ASSERT_FALSE(values.get(clientFb.getGlobalId()).hasKey("MockChild"));
+    ASSERT_GT(loopback->getMaxPendingCount(), 1u);
+}
@@ -434,6 +434,36 @@ TEST_F(ConfigProtocolIntegrationTest, RemoveFunctionBlockFromServer)
     ASSERT_EQ(clientSubDevice.getFunctionBlocks().getCount(), 0u);
 }
 
+TEST_F(ConfigProtocolIntegrationTest, ComponentFinderIndex)
+{
+    const auto componentFinder = std::make_shared<ComponentFinderRootDevice>(serverDevice);
+    serverDevice.getContext().getOnCoreEvent() += [componentFinder](const ComponentPtr& comp, const CoreEventArgsPtr& args)
+    {
+        componentFinder->processCoreEvent(comp, args);
+    };
+
+    const auto serverSubDevice = serverDevice.getDevices()[0];
+    const auto serverFb = serverSubDevice.getFunctionBlocks()[0];
+    const std::string fbId = serverFb.getGlobalId();
+    const std::string fbSignalId = serverFb.getSignals()[0].getGlobalId();
+
+    ASSERT_EQ(componentFinder->findComponent(fbId), serverFb);
+    ASSERT_EQ(componentFinder->findComponent(fbSignalId), serverFb.getSignals()[0]);
+    ASSERT_EQ(componentFinder->findComponent(fbId), serverFb);
+    ASSERT_EQ(componentFinder->getIndexedComponentCount(), 2u);
+
+    serverSubDevice.removeFunctionBlock(serverFb);
+    ASSERT_EQ(componentFinder->getIndexedComponentCount(), 0u);
+    ASSERT_FALSE(componentFinder->findComponent(fbId).assigned());
+    ASSERT_FALSE(componentFinder->findComponent(fbSignalId).assigned());
+
+    // added components are indexed from the core event
+    clientDevice.getDevices()[0].addFunctionBlock("mockfb1");
+    const auto addedFb = serverSubDevice.getFunctionBlocks()[0];
+    ASSERT_EQ(componentFinder->getIndexedComponentCount(), 1u);
+    ASSERT_EQ(componentFinder->findComponent(addedFb.getGlobalId()), addedFb);
+}
+
 TEST_F(ConfigProtocolIntegrationTest, GetInitialStructPropertyValue)
 {
     ASSERT_EQ(serverDevice.getPropertyValue("StructProp"), clientDevice.getPropertyValue("StructProp"));
@@ -553,6 +583,105 @@ TEST_F(ConfigProtocolIntegrationTest, BeginEndUpdateNestedPropertyObject)
     ASSERT_EQ(clientMockChild.getPropertyValue("String"), "String1");
 }
 
+TEST_F(ConfigProtocolIntegrationTest, BeginEndUpdateBatched)
+{
+    int endUpdateCount = 0;
+    serverDevice.getOnEndUpdate() += [&endUpdateCount](PropertyObjectPtr&, EndUpdateEventArgsPtr& args)
+    {
+        ASSERT_THAT(args.getProperties(), UnorderedElementsAre("StrProp", "StringSuggestedValues"));
+        ++endUpdateCount;
+    };
+
+    clientDevice.beginUpdate();
+    clientDevice.setPropertyValue("StrProp", "SomeValue");
+    clientDevice.beginUpdate();
+    clientDevice.setPropertyValue("StringSuggestedValues", "Apple");
+    clientDevice.endUpdate();
+    ASSERT_EQ(serverDevice.getPropertyValue("StrProp"), "-");
+    clientDevice.endUpdate();
+
+    ASSERT_EQ(endUpdateCount, 1);
+    ASSERT_EQ(serverDevice.getPropertyValue("StrProp"), "SomeValue");
+    ASSERT_EQ(clientDevice.getPropertyValue("StrProp"), "SomeValue");
+    ASSERT_EQ(clientDevice.getPropertyValue("StringSuggestedValues"), "Apple");
+}
+
+TEST_F(ConfigProtocolIntegrationTest, BeginEndUpdateBatchedChildObject)
+{
+    const PropertyObjectPtr serverMockChild = serverDevice.getPropertyValue("ObjectProperty.child1.child1_2.child1_2_1");
+    const PropertyObjectPtr clientMockChild = clientDevice.getPropertyValue("ObjectProperty.child1.child1_2.child1_2_1");
+
+    clientDevice.beginUpdate();
+    clientMockChild.setPropertyValue("String", "String1");
+    clientDevice.setPropertyValue("StrProp", "SomeValue");
+    clientMockChild.beginUpdate();
+    clientMockChild.setPropertyValue("String", "String2");
+    clientMockChild.endUpdate();
+
+    // changes of the child object are sent in the batch of its parent
+    ASSERT_EQ(serverMockChild.getPropertyValue("String"), "String");
+    clientDevice.endUpdate();
+
+    ASSERT_EQ(serverMockChild.getPropertyValue("String"), "String2");
+    ASSERT_EQ(serverDevice.getPropertyValue("StrProp"), "SomeValue");
+    ASSERT_EQ(clientMockChild.getPropertyValue("String"), "String2");
+}
+
+TEST_F(ConfigProtocolIntegrationTest, BeginEndUpdateBatchedError)
+{
+    clientDevice.beginUpdate();
+    clientDevice.setPropertyValue("StrProp", "SomeValue");
+    clientDevice.setPropertyValue("InvalidProp", "SomeValue");
+    ASSERT_THROW(clientDevice.endUpdate(), NotFoundException);
+
+    ASSERT_EQ(serverDevice.getPropertyValue("StrProp"), "SomeValue");
+}
+
+TEST_F(ConfigProtocolIntegrationTest, Batch)
+{
+    const auto clientComm = client->getClientComm();
+    const auto globalId = serverDevice.getGlobalId().toStdString();
+
+    auto operations = List<IDict>();
+    operations.pushBack(clientComm->createBatchOperation(
+        "SetPropertyValue", ParamsDict({{"ComponentGlobalId", String(globalId)}, {"PropertyName", "StrProp"}, {"PropertyValue", "val"}})));
+    operations.pushBack(clientComm->createBatchOperation(
+        "GetPropertyValue", ParamsDict({{"ComponentGlobalId", String(globalId)}, {"PropertyName", "InvalidProp"}})));
+    operations.pushBack(clientComm->createBatchOperation(
+        "GetPropertyValue", ParamsDict({{"ComponentGlobalId", String(globalId)}, {"PropertyName", "StrProp"}})));
+    operations.pushBack(clientComm->createBatchOperation("Batch", ParamsDict()));
+
+    const auto results = clientComm->batch(globalId, operations);
+
+    ASSERT_EQ(results.getCount(), 4u);
+    ASSERT_EQ(results[0].get("ErrorCode"), OPENDAQ_SUCCESS);
+    ASSERT_EQ(results[1].get("ErrorCode"), OPENDAQ_ERR_NOTFOUND);
+    ASSERT_EQ(results[2].get("ErrorCode"), OPENDAQ_SUCCESS);
+    ASSERT_EQ(results[3].get("ErrorCode"), OPENDAQ_ERR_INVALIDPARAMETER);
+
+    // the batch is executed within one update, so the value is applied after the last operation
+    ASSERT_EQ(results[2].get("ReturnValue"), "-");
+    ASSERT_EQ(serverDevice.getPropertyValue("StrProp"), "val");
+
+    ASSERT_THROW(ConfigProtocolClientComm::checkBatchResults(results), NotFoundException);
+}
+
+TEST_F(ConfigProtocolIntegrationTest, SetGetPropertyValues)
+{
+    const auto clientComm = client->getClientComm();
+    const auto globalId = serverDevice.getGlobalId().toStdString();
+
+    clientComm->setPropertyValues(globalId, Dict<IString, IBaseObject>({{"StrProp", "val"}, {"MockString", "mock"}}));
+    ASSERT_EQ(serverDevice.getPropertyValue("StrProp"), "val");
+    ASSERT_EQ(serverDevice.getPropertyValue("MockString"), "mock");
+
+    const auto values = clientComm->getPropertyValues(globalId, List<IString>("StrProp", "MockString"));
+    ASSERT_EQ(values.get("StrProp"), "val");
+    ASSERT_EQ(values.get("MockString"), "mock");
+
+    ASSERT_THROW(clientComm->getPropertyValues(globalId, List<IString>("StrProp", "InvalidProp")), NotFoundException);
+}
+
 TEST_F(ConfigProtocolIntegrationTest, SetSignalNameAndDescriptionFromClient)
 {
     const auto serverSignal = serverDevice.getDevices()[0].getFunctionBlocks()[0].getInputPorts()[0].getSignal();
@@ -21,7 +21,11 @@
 #include "config_protocol/config_protocol_client.h"
 #include "config_protocol/config_client_device_impl.h"
 #include <coreobjects/user_factory.h>
+#include <coreobjects/property_object_protected_ptr.h>
 #include <opendaq/mock/mock_streaming_factory.h>
+#include <atomic>
+#include <future>
+#include <thread>
 
 using namespace daq;
 using namespace daq::config_protocol;
@@ -64,9 +68,13 @@ protected:
     ContextPtr clientContext;
     BaseObjectPtr notificationObj;
 
+    mutable std::atomic<size_t> binaryNotificationCount{0};
+
     // server handling
     void serverNotificationReady(const PacketBuffer& notificationPacket) const
     {
+        if (notificationPacket.getPacketType() == PacketType::BinaryServerNotification)
+            binaryNotificationCount++;
         client->triggerNotificationPacket(notificationPacket);
     }
 
@@ -114,6 +122,77 @@ TEST_F(ConfigCoreEventTest, PropertyValueChanged)
     ASSERT_EQ(callCount, 3);
 }
 
+TEST_F(ConfigCoreEventTest, PropertyValueChangedCoalesced)
+{
+    const auto clientComponent = client->getDevice().findComponent("IO/AI/Ch");
+    const auto serverComponent = serverDevice.findComponent("IO/AI/Ch");
+    server->setCoreEventCoalescingWindow(std::chrono::milliseconds(100));
+
+    std::promise<void> receivedPromise;
+    auto receivedFuture = receivedPromise.get_future();
+    std::vector<std::string> receivedValues;
+    clientContext.getOnCoreEvent() +=
+        [&](const ComponentPtr& comp, const CoreEventArgsPtr& args)
+        {
+            ASSERT_EQ(args.getEventId(), static_cast<Int>(CoreEventId::PropertyValueChanged));
+            const std::string name = args.getParameters().get("Name");
+            receivedValues.push_back(name + "=" + args.getParameters().get("Value").toString().toStdString());
+            if (receivedValues.size() == 2)
+                receivedPromise.set_value();
+        };
+
+    serverComponent.setPropertyValue("StrProp", "foo");
+    serverComponent.asPtr<IPropertyObjectProtected>().setProtectedPropertyValue("StrPropProtected", "protected");
+    serverComponent.setPropertyValue("StrProp", "bar");
+    ASSERT_EQ(clientComponent.getPropertyValue("StrProp"), "-");
+
+    ASSERT_EQ(receivedFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    ASSERT_EQ(receivedValues, std::vector<std::string>({"StrPropProtected=protected", "StrProp=bar"}));
+    ASSERT_EQ(clientComponent.getPropertyValue("StrProp"), "bar");
+
+    server->setCoreEventCoalescingWindow(std::chrono::milliseconds(0));
+}
+
+TEST_F(ConfigCoreEventTest, PropertyValueChangedCoalescedAfterRpc)
+{
+    const auto clientComponent = client->getDevice().findComponent("IO/AI/Ch");
+    server->setCoreEventCoalescingWindow(std::chrono::milliseconds(100));
+
+    int callCount = 0;
+    clientContext.getOnCoreEvent() +=
+        [&](const ComponentPtr& comp, const CoreEventArgsPtr& args)
+        {
+            ASSERT_EQ(args.getEventId(), static_cast<Int>(CoreEventId::PropertyValueChanged));
+            callCount++;
+        };
+
+    // pending events are sent when the RPC completes, so the client sees its own change before the window elapses
+    clientComponent.setPropertyValue("StrProp", "foo");
+    ASSERT_EQ(callCount, 1);
+    ASSERT_EQ(clientComponent.getPropertyValue("StrProp"), "foo");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ASSERT_EQ(callCount, 1);
+
+    server->setCoreEventCoalescingWindow(std::chrono::milliseconds(0));
+}
+
+TEST_F(ConfigCoreEventTest, PropertyValueChangedBinaryNotification)
+{
+    const auto clientComponent = client->getDevice().findComponent("IO/AI/Ch");
+    const auto serverComponent = serverDevice.findComponent("IO/AI/Ch");
+    ASSERT_GE(client->getProtocolVersion(), 26u);
+
+    const size_t binaryCountBefore = binaryNotificationCount;
+    serverComponent.setPropertyValue("StrProp", "foo");
+    ASSERT_EQ(clientComponent.getPropertyValue("StrProp"), "foo");
+    serverComponent.setPropertyValue("StrProp", "bar");
+    ASSERT_EQ(clientComponent.getPropertyValue("StrProp"), "bar");
+    ASSERT_EQ(binaryNotificationCount, binaryCountBefore + 2);
+}
+
 TEST_F(ConfigCoreEventTest, PropertyChangedNested)
 {
     const auto clientComponent = client->getDevice().findComponent("AdvancedPropertiesComponent");
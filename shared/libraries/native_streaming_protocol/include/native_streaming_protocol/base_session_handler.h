@@ -25,9 +25,45 @@
 #include <config_protocol/config_protocol.h>
 #include <packet_streaming/packet_streaming.h>
 
+#include <atomic>
+#include <cstring>
+
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
 static const SizeT UNLIMITED_PACKET_SEND_TIME = 0;
+static const SizeT UNLIMITED_SEND_QUEUE_SIZE = 0;
+
+/// Owns the memory referenced by the write tasks of streaming packets scheduled together in one write.
+/// The transport and packet headers are packed into a single header arena pre-allocated for the expected
+/// count of packets, while packet payloads are written directly from the packet buffers memory which is
+/// kept alive by the batch. Only the handler of the last write task holds the batch, so the handlers of
+/// the other tasks do not capture anything and creating them does not allocate.
+class PacketBufferWriteBatch
+{
+public:
+    explicit PacketBufferWriteBatch(size_t packetBuffersCount);
+    ~PacketBufferWriteBatch();
+
+    PacketBufferWriteBatch(const PacketBufferWriteBatch&) = delete;
+    PacketBufferWriteBatch& operator=(const PacketBufferWriteBatch&) = delete;
+
+    /// Returns memory for the headers of a single packet; if the arena is exhausted, separate memory is allocated
+    char* allocateHeaders(size_t size);
+    /// Returns zero-initialized memory, which remains valid as long as the batch exists
+    char* allocateBuffer(size_t size);
+    void holdPacketBuffer(packet_streaming::PacketBufferPtr&& packetBuffer);
+
+    /// The size of the batch is subtracted from the counter once the batch is destroyed
+    void trackQueuedBytes(const std::shared_ptr<std::atomic<SizeT>>& queuedBytesCounter, SizeT queuedBytes);
+
+private:
+    std::vector<char> headersArena;
+    std::vector<std::vector<char>> buffers;
+    std::vector<packet_streaming::PacketBufferPtr> packetBuffers;
+    std::shared_ptr<std::atomic<SizeT>> queuedBytesCounter;
+    SizeT queuedBytes;
+};
+using PacketBufferWriteBatchPtr = std::shared_ptr<PacketBufferWriteBatch>;
 
 class BaseSessionHandler: public std::enable_shared_from_this<BaseSessionHandler>
 {
@@ -41,7 +77,8 @@ public:
                        OnFindSignalCallback findSignalHandler,
                        OnSignalSubscriptionCallback signalSubscriptionHandler,
                        ConstCharPtr loggerComponentName,
-                       SizeT streamingPacketSendTimeout = UNLIMITED_PACKET_SEND_TIME);
+                       SizeT streamingPacketSendTimeout = UNLIMITED_PACKET_SEND_TIME,
+                       SizeT streamingSendQueueByteLimit = UNLIMITED_SEND_QUEUE_SIZE);
     virtual ~BaseSessionHandler();
 
     void startReading();
@@ -50,9 +87,12 @@ public:
     void sendPacketBuffer(packet_streaming::PacketBufferPtr&& packetBuffer);
 
     void schedulePacketBufferWriteTasks(std::vector<daq::native_streaming::WriteTask>&& tasks,
-                                        std::optional<std::chrono::steady_clock::time_point>&& timeStamp);
+                                        std::optional<std::chrono::steady_clock::time_point>&& timeStamp,
+                                        const PacketBufferWriteBatchPtr& writeBatch);
     static void createAndPushPacketBufferTasks(packet_streaming::PacketBufferPtr&& packetBuffer,
-                                               std::vector<daq::native_streaming::WriteTask>& tasks);
+                                               std::vector<daq::native_streaming::WriteTask>& tasks,
+                                               PacketBufferWriteBatch& writeBatch);
+    static void attachWriteBatch(std::vector<daq::native_streaming::WriteTask>& tasks, const PacketBufferWriteBatchPtr& writeBatch);
     static void copyHeadersToBuffer(const packet_streaming::PacketBufferPtr& packetBuffer, char* bufferDestPtr);
 
     void setConfigPacketReceivedHandler(const ProcessConfigProtocolPacketCb& configPacketReceivedHandler);
@@ -76,16 +116,25 @@ protected:
     daq::native_streaming::ReadTask createReadStopTask();
     daq::native_streaming::ReadTask discardPayload(const void* data, size_t size);
 
+    bool reserveSendQueueBytes(const std::vector<daq::native_streaming::WriteTask>& tasks, PacketBufferWriteBatch& writeBatch);
+
     static size_t calculatePayloadSize(const std::vector<daq::native_streaming::WriteTask>& writePayloadTasks);
     static daq::native_streaming::WriteTask createWriteHeaderTask(PayloadType payloadType, size_t payloadSize);
     static daq::native_streaming::WriteTask createWriteStringTask(const std::string& str);
 
+    // The written data is copied into the write batch, which must be attached to the tasks with attachWriteBatch
+    static daq::native_streaming::WriteTask createWriteHeaderTask(PayloadType payloadType,
+                                                                  size_t payloadSize,
+                                                                  PacketBufferWriteBatch& writeBatch);
+    static daq::native_streaming::WriteTask createWriteStringTask(const std::string& str, PacketBufferWriteBatch& writeBatch);
+
     template<typename T>
-    daq::native_streaming::WriteTask createWriteNumberTask(const T& value)
+    static daq::native_streaming::WriteTask createWriteNumberTask(const T& value, PacketBufferWriteBatch& writeBatch)
     {
-        auto valueCopy = std::make_shared<T>(value);
-        boost::asio::const_buffer valuePayload(valueCopy.get(), sizeof(T));
-        daq::native_streaming::WriteHandler valuePayloadHandler = [valueCopy]() {};
+        char* valueCopy = writeBatch.allocateHeaders(sizeof(T));
+        std::memcpy(valueCopy, &value, sizeof(T));
+        boost::asio::const_buffer valuePayload(valueCopy, sizeof(T));
+        daq::native_streaming::WriteHandler valuePayloadHandler = []() {};
         return daq::native_streaming::WriteTask(valuePayload, valuePayloadHandler);
     }
 
@@ -111,6 +160,9 @@ protected:
     LoggerComponentPtr loggerComponent;
     bool connectionActivityMonitoringStarted{false};
     std::chrono::milliseconds streamingPacketSendTimeout;
+    SizeT streamingSendQueueByteLimit;
+    std::shared_ptr<std::atomic<SizeT>> queuedStreamingBytes;
+    std::atomic<bool> sendQueueOverflowed;
 
     OnSignalCallback signalReceivedHandler;
     OnSubscriptionAckCallback subscriptionAckHandler;
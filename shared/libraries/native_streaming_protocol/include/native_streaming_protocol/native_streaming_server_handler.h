@@ -59,6 +59,8 @@ public:
 
     void sendPacket(const std::string& signalId, PacketPtr&& packet);
     void processStreamingPackets(const tsl::ordered_map<std::string, PacketBufferData>& packetIndices, const std::vector<IPacket*>& packets);
+    void processStreamingPackets(const SignalPacketIndices& packetIndices, const std::vector<IPacket*>& packets);
+    SignalNumericIdType getSignalNumericId(const SignalPtr& signal);
     void sendAvailableStreamingPackets();
 
     static PropertyObjectPtr createDefaultConfig();
@@ -141,6 +143,7 @@ protected:
     SizeT controlConnectionsCount;
     SizeT exclusiveControlConnectionsCount;
     SizeT streamingPacketSendTimeout;
+    SizeT streamingSendQueueByteLimit;
     SizeT packetStreamingReleaseThreshold;
     SizeT cacheablePacketPayloadSizeMax;
 
@@ -21,6 +21,7 @@
 #include <opendaq/context_ptr.h>
 #include <opendaq/signal_ptr.h>
 #include <opendaq/client_type.h>
+#include <packet_streaming/event_packet_encoding.h>
 
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
@@ -36,7 +37,8 @@ public:
                          OnFindSignalCallback findSignalHandler,
                          OnSignalSubscriptionCallback signalSubscriptionHandler,
                          native_streaming::OnSessionErrorCallback errorHandler,
-                         SizeT streamingPacketSendTimeout);
+                         SizeT streamingPacketSendTimeout,
+                         SizeT streamingSendQueueByteLimit);
 
     void sendStreamingInitDone();
 
@@ -56,6 +58,8 @@ public:
     ClientType getClientType();
     void setExclusiveControlDropOthers(bool enabled);
     bool isExclusiveControlDropOthersEnabled();
+    void setEventEncodingVersion(uint8_t version);
+    uint8_t getEventEncodingVersion();
 
     bool isConfigProtocolUsed();
     void triggerUseConfigProtocol();
@@ -75,5 +79,6 @@ private:
     bool useConfigProtocol;
     ClientType clientType = ClientType::Control;
     bool exclusiveControlDropOthers = false;
+    uint8_t eventEncodingVersion = packet_streaming::EVENT_ENCODING_JSON;
 };
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
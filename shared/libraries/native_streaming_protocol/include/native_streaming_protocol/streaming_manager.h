@@ -22,6 +22,7 @@
 #include <opendaq/logger_component_ptr.h>
 #include <opendaq/signal_ptr.h>
 #include <tsl/ordered_map.h>
+#include <tuple>
 
 #include <packet_streaming/packet_streaming_server.h>
 #include <packet_streaming/packet_streaming_client.h>
@@ -45,12 +46,16 @@ struct PacketBufferData
     int count;
 };
 
+/// Pairs of signal numeric ID and the location of that signal's packets in a shared packet buffer.
+using SignalPacketIndices = std::vector<std::pair<SignalNumericIdType, PacketBufferData>>;
+
 using SendPacketBufferCallback = std::function<void(const std::string& subscribedClientId,
                                                     packet_streaming::PacketBufferPtr&& packetBuffer)>;
 using PacketStreamingServerPtr = std::shared_ptr<packet_streaming::PacketStreamingServer>;
 using PacketStreamingClientPtr = std::shared_ptr<packet_streaming::PacketStreamingClient>;
-using StreamingWriteTasks = std::pair<std::vector<daq::native_streaming::WriteTask>,
-                                      std::optional<std::chrono::steady_clock::time_point>>;
+using StreamingWriteTasks = std::tuple<std::vector<daq::native_streaming::WriteTask>,
+                                       std::optional<std::chrono::steady_clock::time_point>,
+                                       PacketBufferWriteBatchPtr>;
 using SubscribeAckCallback = std::function<void(const std::string& signalStringId, bool subscribed)>;
 using DoSubscribeCallback = std::function<void(SignalNumericIdType signalNumericId, const std::string& clientId)>;
 using SignalAvailableCallback = std::function<void(const std::string& signalStringId)>;
@@ -77,6 +82,13 @@ public:
     /// @throw NativeStreamingProtocolException if any signal in the packetIndices map is not registered.
     void processPackets(const tsl::ordered_map<std::string, PacketBufferData>& packetIndices, const std::vector<IPacket*>& packets);
 
+    /// Pushes packets to the packet streaming servers associated with clients subscribed to signals.
+    /// @param packetIndices Signal numeric IDs paired with information on buffer index/count where the packets of said signals are
+    /// located in the `packets` vector.
+    /// @param packets The openDAQ packets to be processed.
+    /// @throw NativeStreamingProtocolException if any signal in packetIndices is not registered.
+    void processPackets(const SignalPacketIndices& packetIndices, const std::vector<IPacket*>& packets);
+
     /// Gets the packet streaming server for streaming client registered under provided id.
     /// @param clientId The unique string ID provided by the client or automatically assigned by the server.
     /// @return Pointer to packet streaming server or nullptr if client with provided id is not registered.
@@ -104,12 +116,14 @@ public:
     /// @param clientId The unique string ID provided by the client or automatically assigned by the server.
     /// @param reconnected true if the client was reconnected, false otherwise.
     /// @param enablePacketBufferTimestamps enables timestamp creation for PacketBuffers
+    /// @param eventEncodingVersion The event packet encoding version supported by the client.
     /// @throw NativeStreamingProtocolException if the client is already registered.
     void registerClient(const std::string& clientId,
                         bool reconnected,
                         bool enablePacketBufferTimestamps,
                         size_t packetStreamingReleaseThreshold,
-                        size_t cacheablePacketPayloadSizeMax);
+                        size_t cacheablePacketPayloadSizeMax,
+                        uint8_t eventEncodingVersion = packet_streaming::EVENT_ENCODING_JSON);
 
     /// Removes a registered client on disconnection.
     /// @param clientId The unique string ID provided by the client or automatically assigned by the server.
@@ -171,7 +185,9 @@ public:
     /// WriteTasks from them in optimized way.
     /// @param packetStreamingServer The packet streaming server to retrieve all ready packet buffers.
     /// @return The vector of WriteTasks for streaming packets plus optionally the timestamp of first timestamped
-    /// packet met in all available packet buffers for specified packet server.
+    /// packet met in all available packet buffers for specified packet server, and the write batch owning
+    /// the memory the tasks refer to. Packet headers are packed into the batch's header arena, while payloads
+    /// of non-cacheable packets are written directly from packet memory without copying.
     /// Common method for device-to-client and client-to-device streaming.
     static StreamingWriteTasks getStreamingWriteTasks(const PacketStreamingServerPtr& packetStreamingServer);
 
@@ -225,9 +241,13 @@ private:
 
     static native_streaming::WriteTask cachePacketsToLinearBuffer(const PacketStreamingServerPtr& packetStreamingServer,
                                                                   size_t cacheableGroupId,
-                                                                  std::optional<std::chrono::steady_clock::time_point>& timeStamp);
+                                                                  std::optional<std::chrono::steady_clock::time_point>& timeStamp,
+                                                                  PacketBufferWriteBatch& writeBatch);
 
     bool removeSignalSubscriberNoLock(const std::string& signalStringId, const std::string& subscribedClientId);
+    void processSignalPacketsNoLock(RegisteredServerSignal& registeredSignal,
+                                    const PacketBufferData& packetData,
+                                    const std::vector<IPacket*>& packets);
 
     ContextPtr context;
     LoggerComponentPtr loggerComponent;
@@ -235,6 +255,8 @@ private:
 
     // key: signal global id
     std::unordered_map<std::string, RegisteredServerSignal> registeredSignals;
+    // key: signal numeric id; values point into registeredSignals
+    std::unordered_map<SignalNumericIdType, RegisteredServerSignal*> registeredSignalsByNumericId;
 
     // key: client id
     std::unordered_map<std::string, PacketStreamingServerPtr> packetStreamingServers;
@@ -1,11 +1,57 @@
 #include <native_streaming_protocol/base_session_handler.h>
 #include <opendaq/custom_log.h>
+#include <packet_streaming/packet_buffer_pool.h>
+#include <boost/asio/post.hpp>
 
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
 using namespace daq::native_streaming;
 using namespace packet_streaming;
 
+// the largest header of the packets sent via packet streaming, used to size the header arena up-front
+static constexpr size_t MaxPacketHeadersSize = TransportHeader::PACKED_HEADER_SIZE + sizeof(DataPacketHeader);
+
+PacketBufferWriteBatch::PacketBufferWriteBatch(size_t packetBuffersCount)
+    : queuedBytes(0)
+{
+    headersArena.reserve(packetBuffersCount * MaxPacketHeadersSize);
+    packetBuffers.reserve(packetBuffersCount);
+}
+
+PacketBufferWriteBatch::~PacketBufferWriteBatch()
+{
+    if (queuedBytesCounter)
+        queuedBytesCounter->fetch_sub(queuedBytes, std::memory_order_relaxed);
+}
+
+char* PacketBufferWriteBatch::allocateHeaders(size_t size)
+{
+    // the write tasks point into the arena, so it must never be reallocated
+    if (headersArena.capacity() - headersArena.size() < size)
+        return allocateBuffer(size);
+
+    const auto offset = headersArena.size();
+    headersArena.resize(offset + size);
+    return headersArena.data() + offset;
+}
+
+char* PacketBufferWriteBatch::allocateBuffer(size_t size)
+{
+    // moving the vectors on reallocation of the outer one keeps their data in place
+    return buffers.emplace_back(size).data();
+}
+
+void PacketBufferWriteBatch::holdPacketBuffer(PacketBufferPtr&& packetBuffer)
+{
+    packetBuffers.push_back(std::move(packetBuffer));
+}
+
+void PacketBufferWriteBatch::trackQueuedBytes(const std::shared_ptr<std::atomic<SizeT>>& queuedBytesCounter, SizeT queuedBytes)
+{
+    this->queuedBytesCounter = queuedBytesCounter;
+    this->queuedBytes = queuedBytes;
+}
+
 BaseSessionHandler::BaseSessionHandler(const ContextPtr& daqContext,
                                        SessionPtr session,
                                        const std::shared_ptr<boost::asio::io_context>& ioContextPtr,
@@ -15,7 +61,8 @@ BaseSessionHandler::BaseSessionHandler(const ContextPtr& daqContext,
                                        OnFindSignalCallback findSignalHandler,
                                        OnSignalSubscriptionCallback signalSubscriptionHandler,
                                        ConstCharPtr loggerComponentName,
-                                       SizeT streamingPacketSendTimeout)
+                                       SizeT streamingPacketSendTimeout,
+                                       SizeT streamingSendQueueByteLimit)
     : session(session)
     , configPacketReceivedHandler(nullptr)
     , packetBufferReceivedHandler(nullptr)
@@ -26,6 +73,9 @@ BaseSessionHandler::BaseSessionHandler(const ContextPtr& daqContext,
     , streamingPacketSendTimeout(streamingPacketSendTimeout != UNLIMITED_PACKET_SEND_TIME
                                      ? std::chrono::milliseconds(streamingPacketSendTimeout)
                                      : std::chrono::milliseconds(0))
+    , streamingSendQueueByteLimit(streamingSendQueueByteLimit)
+    , queuedStreamingBytes(std::make_shared<std::atomic<SizeT>>(0))
+    , sendQueueOverflowed(false)
     , signalReceivedHandler(signalReceivedHandler)
     , subscriptionAckHandler(subscriptionAckHandler)
     , findSignalHandler(findSignalHandler)
@@ -233,6 +283,25 @@ WriteTask BaseSessionHandler::createWriteStringTask(const std::string& str)
     return WriteTask(stringPayload, stringPayloadHandler);
 }
 
+WriteTask BaseSessionHandler::createWriteHeaderTask(PayloadType payloadType, size_t payloadSize, PacketBufferWriteBatch& writeBatch)
+{
+    TransportHeader header(payloadType, payloadSize);
+    char* headerCopy = writeBatch.allocateHeaders(TransportHeader::PACKED_HEADER_SIZE);
+    std::memcpy(headerCopy, header.getPackedHeaderPtr(), TransportHeader::PACKED_HEADER_SIZE);
+    boost::asio::const_buffer headerBuffer(headerCopy, TransportHeader::PACKED_HEADER_SIZE);
+    WriteHandler headerHandler = []() {};
+    return WriteTask(headerBuffer, headerHandler);
+}
+
+WriteTask BaseSessionHandler::createWriteStringTask(const std::string& str, PacketBufferWriteBatch& writeBatch)
+{
+    char* strCopy = writeBatch.allocateBuffer(str.size());
+    std::memcpy(strCopy, str.data(), str.size());
+    boost::asio::const_buffer stringPayload(strCopy, str.size());
+    WriteHandler stringPayloadHandler = []() {};
+    return WriteTask(stringPayload, stringPayloadHandler);
+}
+
 size_t BaseSessionHandler::calculatePayloadSize(const std::vector<daq::native_streaming::WriteTask>& writePayloadTasks)
 {
     size_t result = 0;
@@ -289,8 +358,7 @@ ReadTask BaseSessionHandler::readPacketBuffer(const void* data, size_t size)
 
     size_t bytesDone = 0;
 
-    GenericPacketHeader* packetBufferHeader {};
-    void* packetBufferPayload;
+    PacketBufferPtr recvPacketBuffer;
 
     try
     {
@@ -307,23 +375,21 @@ ReadTask BaseSessionHandler::readPacketBuffer(const void* data, size_t size)
             return createReadHeaderTask();
         }
 
+        // Get generic part of the header first to size the pooled buffer holding both the header and the payload
+        GenericPacketHeader genericHeader;
+        copyData(&genericHeader, data, sizeof(GenericPacketHeader), bytesDone, size);
+
+        recvPacketBuffer = createPooledPacketBuffer(headerSize, genericHeader.payloadSize);
+
         // Get packet buffer header from received buffer
-        packetBufferHeader = static_cast<GenericPacketHeader*>(std::malloc(headerSize));
-        copyData(packetBufferHeader, data, headerSize, bytesDone, size);
+        copyData(recvPacketBuffer->packetHeader, data, headerSize, bytesDone, size);
         LOG_T("Received packet buffer header: header size {}, payload size {}",
-              packetBufferHeader->size, packetBufferHeader->payloadSize);
+              recvPacketBuffer->packetHeader->size, recvPacketBuffer->packetHeader->payloadSize);
         bytesDone += headerSize;
 
         // Get packet buffer payload from received buffer
-        if (packetBufferHeader->payloadSize > 0)
-        {
-            packetBufferPayload = std::malloc(packetBufferHeader->payloadSize);
-            copyData(packetBufferPayload, data, packetBufferHeader->payloadSize, bytesDone, size);
-        }
-        else
-        {
-            packetBufferPayload = nullptr;
-        }
+        if (recvPacketBuffer->packetHeader->payloadSize > 0)
+            copyData(const_cast<void*>(recvPacketBuffer->payload), data, recvPacketBuffer->packetHeader->payloadSize, bytesDone, size);
     }
     catch (const DaqException& e)
     {
@@ -332,17 +398,6 @@ ReadTask BaseSessionHandler::readPacketBuffer(const void* data, size_t size)
         return createReadStopTask();
     }
 
-    auto recvPacketBuffer =
-        std::make_shared<PacketBuffer>(packetBufferHeader,
-                                       packetBufferPayload,
-                                       [packetBufferHeader, packetBufferPayload]()
-                                       {
-                                           std::free(packetBufferHeader);
-                                           if (packetBufferPayload != nullptr)
-                                               std::free(packetBufferPayload);
-                                       },
-                                       false);
-
     packetBufferReceivedHandler(recvPacketBuffer);
 
     return createReadHeaderTask();
@@ -358,22 +413,64 @@ void BaseSessionHandler::sendPacketBuffer(PacketBufferPtr&& packetBuffer)
             ? std::optional(packetBuffer->timeStamp.value() + streamingPacketSendTimeout)
             : std::nullopt;
 
-    createAndPushPacketBufferTasks(std::move(packetBuffer), tasks);
+    auto writeBatch = std::make_shared<PacketBufferWriteBatch>(1);
+    createAndPushPacketBufferTasks(std::move(packetBuffer), tasks, *writeBatch);
+    attachWriteBatch(tasks, writeBatch);
+
+    if (!reserveSendQueueBytes(tasks, *writeBatch))
+        return;
 
     session->scheduleWrite(std::move(tasks), std::move(deadlineTime));
 }
 
 void BaseSessionHandler::schedulePacketBufferWriteTasks(std::vector<native_streaming::WriteTask>&& tasks,
-                                                        std::optional<std::chrono::steady_clock::time_point>&& timeStamp)
+                                                        std::optional<std::chrono::steady_clock::time_point>&& timeStamp,
+                                                        const PacketBufferWriteBatchPtr& writeBatch)
 {
     auto deadlineTime =
         timeStamp.has_value() && streamingPacketSendTimeout != std::chrono::milliseconds(0)
             ? std::optional(timeStamp.value() + streamingPacketSendTimeout)
             : std::nullopt;
 
+    if (!reserveSendQueueBytes(tasks, *writeBatch))
+        return;
+
     session->scheduleWrite(std::move(tasks), std::move(deadlineTime));
 }
 
+bool BaseSessionHandler::reserveSendQueueBytes(const std::vector<WriteTask>& tasks, PacketBufferWriteBatch& writeBatch)
+{
+    if (streamingSendQueueByteLimit == UNLIMITED_SEND_QUEUE_SIZE)
+        return true;
+
+    // the session is being reset; packets sent after the drained ones would leave a hole in the stream
+    if (sendQueueOverflowed.load(std::memory_order_relaxed))
+        return false;
+
+    const auto bytes = calculatePayloadSize(tasks);
+    const auto queuedBytes = queuedStreamingBytes->fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    writeBatch.trackQueuedBytes(queuedStreamingBytes, bytes);
+
+    if (queuedBytes <= streamingSendQueueByteLimit)
+        return true;
+
+    // the client can't keep up with the data rate, so the connection is reset, same as on send timeout;
+    // the error is reported asynchronously as the packets are sent while the owner's locks are held
+    if (!sendQueueOverflowed.exchange(true))
+    {
+        LOG_W("Streaming send queue size {} bytes exceeds the limit of {} bytes, the connection will be reset",
+              queuedBytes,
+              streamingSendQueueByteLimit);
+        boost::asio::post(*ioContextPtr,
+                          [errorHandler = this->errorHandler, sessionWeak = std::weak_ptr<Session>(session)]()
+                          {
+                              if (auto session = sessionWeak.lock())
+                                  errorHandler("Streaming send queue size limit exceeded", session);
+                          });
+    }
+    return false;
+}
+
 void BaseSessionHandler::copyHeadersToBuffer(const packet_streaming::PacketBufferPtr& packetBuffer, char* bufferDestPtr)
 {
     size_t payloadSize = packetBuffer->packetHeader->size + packetBuffer->packetHeader->payloadSize;
@@ -388,40 +485,54 @@ void BaseSessionHandler::copyHeadersToBuffer(const packet_streaming::PacketBuffe
 }
 
 void BaseSessionHandler::createAndPushPacketBufferTasks(packet_streaming::PacketBufferPtr&& packetBuffer,
-                                                        std::vector<native_streaming::WriteTask>& tasks)
+                                                        std::vector<native_streaming::WriteTask>& tasks,
+                                                        PacketBufferWriteBatch& writeBatch)
 {
-    auto headersBuffer = std::make_shared<std::vector<char>>(TransportHeader::PACKED_HEADER_SIZE + packetBuffer->packetHeader->size);
-    copyHeadersToBuffer(packetBuffer, headersBuffer->data());
+    const size_t headersSize = TransportHeader::PACKED_HEADER_SIZE + packetBuffer->packetHeader->size;
+    char* headersBuffer = writeBatch.allocateHeaders(headersSize);
+    copyHeadersToBuffer(packetBuffer, headersBuffer);
 
-    boost::asio::const_buffer headersTaskBuffer(headersBuffer->data(), headersBuffer->size());
-    WriteHandler headersHandler = [headersBuffer]() {};
-    tasks.push_back(WriteTask(headersTaskBuffer, headersHandler));
+    // the handlers are left empty, the memory is kept alive by the write batch attached to the last task
+    tasks.push_back(WriteTask(boost::asio::const_buffer(headersBuffer, headersSize), []() {}));
 
     if (packetBuffer->packetHeader->payloadSize > 0)
     {
-        // create write task for packet buffer payload
+        // create write task for packet buffer payload, which is written directly from the packet memory
         boost::asio::const_buffer packetBufferPayload(packetBuffer->payload,
                                                       packetBuffer->packetHeader->payloadSize);
-        WriteHandler packetBufferPayloadHandler = [packetBuffer]() {};
-        tasks.push_back(WriteTask(packetBufferPayload, packetBufferPayloadHandler));
+        tasks.push_back(WriteTask(packetBufferPayload, []() {}));
     }
+
+    writeBatch.holdPacketBuffer(std::move(packetBuffer));
+}
+
+void BaseSessionHandler::attachWriteBatch(std::vector<native_streaming::WriteTask>& tasks, const PacketBufferWriteBatchPtr& writeBatch)
+{
+    if (tasks.empty())
+        return;
+
+    const auto lastTaskBuffer = tasks.back().getBuffer();
+    tasks.pop_back();
+    tasks.push_back(WriteTask(lastTaskBuffer, [writeBatch]() {}));
 }
 
 void BaseSessionHandler::sendSignalSubscribe(const SignalNumericIdType& signalNumericId, const std::string& signalStringId)
 {
     std::vector<WriteTask> tasks;
+    auto writeBatch = std::make_shared<PacketBufferWriteBatch>(1);
     tasks.reserve(3);
 
     // create write task for signal numeric ID
-    tasks.push_back(createWriteNumberTask<SignalNumericIdType>(signalNumericId));
+    tasks.push_back(createWriteNumberTask<SignalNumericIdType>(signalNumericId, *writeBatch));
 
     // create write task for signal string ID
-    tasks.push_back(createWriteStringTask(signalStringId));
+    tasks.push_back(createWriteStringTask(signalStringId, *writeBatch));
 
     // create write task for transport header
     size_t payloadSize = calculatePayloadSize(tasks);
-    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_SUBSCRIBE_COMMAND, payloadSize);
+    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_SUBSCRIBE_COMMAND, payloadSize, *writeBatch);
     tasks.insert(tasks.begin(), writeHeaderTask);
+    attachWriteBatch(tasks, writeBatch);
 
     session->scheduleWrite(std::move(tasks));
 }
@@ -429,18 +540,20 @@ void BaseSessionHandler::sendSignalSubscribe(const SignalNumericIdType& signalNu
 void BaseSessionHandler::sendSignalUnsubscribe(const SignalNumericIdType& signalNumericId, const std::string& signalStringId)
 {
     std::vector<WriteTask> tasks;
+    auto writeBatch = std::make_shared<PacketBufferWriteBatch>(1);
     tasks.reserve(3);
 
     // create write task for signal numeric ID
-    tasks.push_back(createWriteNumberTask<SignalNumericIdType>(signalNumericId));
+    tasks.push_back(createWriteNumberTask<SignalNumericIdType>(signalNumericId, *writeBatch));
 
     // create write task for signal string ID
-    tasks.push_back(createWriteStringTask(signalStringId));
+    tasks.push_back(createWriteStringTask(signalStringId, *writeBatch));
 
     // create write task for transport header
     size_t payloadSize = calculatePayloadSize(tasks);
-    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNSUBSCRIBE_COMMAND, payloadSize);
+    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNSUBSCRIBE_COMMAND, payloadSize, *writeBatch);
     tasks.insert(tasks.begin(), writeHeaderTask);
+    attachWriteBatch(tasks, writeBatch);
 
     session->scheduleWrite(std::move(tasks));
 }
@@ -683,30 +796,32 @@ void BaseSessionHandler::sendSignalAvailable(const SignalNumericIdType& signalNu
         return;
 
     std::vector<WriteTask> tasks;
+    auto writeBatch = std::make_shared<PacketBufferWriteBatch>(1);
     SizeT signalStringIdMaxSize = std::numeric_limits<uint16_t>::max();
 
     // create write task for signal numeric ID
-    tasks.push_back(createWriteNumberTask<SignalNumericIdType>(signalNumericId));
+    tasks.push_back(createWriteNumberTask<SignalNumericIdType>(signalNumericId, *writeBatch));
 
     auto signalStringId = signal.getGlobalId();
     // create write task for signal string ID size
     SizeT signalStringIdSize = signalStringId.getLength();
     if (signalStringIdSize > signalStringIdMaxSize)
         throw NativeStreamingProtocolException("Size of signal string id exceeds limit");
-    tasks.push_back(createWriteNumberTask<uint16_t>(static_cast<uint16_t>(signalStringIdSize)));
+    tasks.push_back(createWriteNumberTask<uint16_t>(static_cast<uint16_t>(signalStringIdSize), *writeBatch));
     // create write task for signal string ID itself
-    tasks.push_back(createWriteStringTask(signalStringId.toStdString()));
+    tasks.push_back(createWriteStringTask(signalStringId.toStdString(), *writeBatch));
 
     auto jsonSerializer = JsonSerializer(False);
     signal.serialize(jsonSerializer);
     auto serializedSignal = jsonSerializer.getOutput();
     LOG_T("Serialized signal:\n{}", serializedSignal);
-    tasks.push_back(createWriteStringTask(serializedSignal.toStdString()));
+    tasks.push_back(createWriteStringTask(serializedSignal.toStdString(), *writeBatch));
 
     // create write task for transport header
     size_t payloadSize = calculatePayloadSize(tasks);
-    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_AVAILABLE, payloadSize);
+    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_AVAILABLE, payloadSize, *writeBatch);
     tasks.insert(tasks.begin(), writeHeaderTask);
+    attachWriteBatch(tasks, writeBatch);
 
     session->scheduleWrite(std::move(tasks));
 }
@@ -718,17 +833,19 @@ void BaseSessionHandler::sendSignalUnavailable(const SignalNumericIdType& signal
         return;
 
     std::vector<WriteTask> tasks;
+    auto writeBatch = std::make_shared<PacketBufferWriteBatch>(1);
 
     // create write task for signal numeric ID
-    tasks.push_back(createWriteNumberTask<SignalNumericIdType>(signalNumericId));
+    tasks.push_back(createWriteNumberTask<SignalNumericIdType>(signalNumericId, *writeBatch));
 
     // create write task for signal string ID
-    tasks.push_back(createWriteStringTask(signal.getGlobalId().toStdString()));
+    tasks.push_back(createWriteStringTask(signal.getGlobalId().toStdString(), *writeBatch));
 
     // create write task for transport header
     size_t payloadSize = calculatePayloadSize(tasks);
-    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNAVAILABLE, payloadSize);
+    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNAVAILABLE, payloadSize, *writeBatch);
     tasks.insert(tasks.begin(), writeHeaderTask);
+    attachWriteBatch(tasks, writeBatch);
 
     session->scheduleWrite(std::move(tasks));
 }
@@ -736,14 +853,16 @@ void BaseSessionHandler::sendSignalUnavailable(const SignalNumericIdType& signal
 void BaseSessionHandler::sendSubscribingDone(const SignalNumericIdType signalNumericId)
 {
     std::vector<WriteTask> tasks;
+    auto writeBatch = std::make_shared<PacketBufferWriteBatch>(1);
 
     // create write task for signal numeric ID
-    tasks.push_back(createWriteNumberTask<SignalNumericIdType>(signalNumericId));
+    tasks.push_back(createWriteNumberTask<SignalNumericIdType>(signalNumericId, *writeBatch));
 
     // create write task for transport header
     size_t payloadSize = calculatePayloadSize(tasks);
-    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_SUBSCRIBE_ACK, payloadSize);
+    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_SUBSCRIBE_ACK, payloadSize, *writeBatch);
     tasks.insert(tasks.begin(), writeHeaderTask);
+    attachWriteBatch(tasks, writeBatch);
 
     session->scheduleWrite(std::move(tasks));
 }
@@ -751,14 +870,16 @@ void BaseSessionHandler::sendSubscribingDone(const SignalNumericIdType signalNum
 void BaseSessionHandler::sendUnsubscribingDone(const SignalNumericIdType signalNumericId)
 {
     std::vector<WriteTask> tasks;
+    auto writeBatch = std::make_shared<PacketBufferWriteBatch>(1);
 
     // create write task for signal numeric ID
-    tasks.push_back(createWriteNumberTask<SignalNumericIdType>(signalNumericId));
+    tasks.push_back(createWriteNumberTask<SignalNumericIdType>(signalNumericId, *writeBatch));
 
     // create write task for transport header
     size_t payloadSize = calculatePayloadSize(tasks);
-    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNSUBSCRIBE_ACK, payloadSize);
+    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNSUBSCRIBE_ACK, payloadSize, *writeBatch);
     tasks.insert(tasks.begin(), writeHeaderTask);
+    attachWriteBatch(tasks, writeBatch);
 
     session->scheduleWrite(std::move(tasks));
 }
@@ -79,6 +79,10 @@ void NativeStreamingClientImpl::manageTransportLayerProps()
     if (!transportLayerProperties.hasProperty("HostName"))
         transportLayerProperties.addProperty(StringProperty("HostName", ""));
     transportLayerProperties.setPropertyValue("HostName", String(boost::asio::ip::host_name()));
+
+    if (!transportLayerProperties.hasProperty("EventPacketEncodingVersion"))
+        transportLayerProperties.addProperty(
+            IntProperty("EventPacketEncodingVersion", static_cast<Int>(packet_streaming::EVENT_ENCODING_VERSION_LATEST)));
 }
 
 void NativeStreamingClientImpl::resetStreamingHandlers()
@@ -419,9 +423,9 @@ void NativeStreamingClientImpl::sendAvailableStreamingPackets()
     {
         if (auto packetStreamingServerTemp = this->packetStreamingServerPtr; packetStreamingServerTemp)
         {
-            auto [tasks,_] = StreamingManager::getStreamingWriteTasks(packetStreamingServerTemp);
+            auto [tasks, _, writeBatch] = StreamingManager::getStreamingWriteTasks(packetStreamingServerTemp);
             if (!tasks.empty())
-                sessionHandler->schedulePacketBufferWriteTasks(std::move(tasks), std::nullopt);
+                sessionHandler->schedulePacketBufferWriteTasks(std::move(tasks), std::nullopt, writeBatch);
         }
     }
 }
@@ -8,6 +8,7 @@
 
 #include <coreobjects/property_object_factory.h>
 #include <memory>
+#include <algorithm>
 #include <coreobjects/user_factory.h>
 #include <opendaq/errors.h>
 
@@ -52,6 +53,7 @@ NativeStreamingServerHandler::NativeStreamingServerHandler(const ContextPtr& con
     , controlConnectionsCount(0)
     , exclusiveControlConnectionsCount(0)
     , streamingPacketSendTimeout(config.getPropertyValue("StreamingPacketSendTimeout"))
+    , streamingSendQueueByteLimit(config.getPropertyValue("StreamingSendQueueByteLimit"))
     , packetStreamingReleaseThreshold(config.getPropertyValue("StreamingPacketReleaseThreshold"))
     , cacheablePacketPayloadSizeMax(config.getPropertyValue("StreamingCacheablePayloadSizeMax"))
 {
@@ -259,6 +261,16 @@ void NativeStreamingServerHandler::processStreamingPackets(const tsl::ordered_ma
     streamingManager.processPackets(packetIndices, packets);
 }
 
+void NativeStreamingServerHandler::processStreamingPackets(const SignalPacketIndices& packetIndices, const std::vector<IPacket*>& packets)
+{
+    streamingManager.processPackets(packetIndices, packets);
+}
+
+SignalNumericIdType NativeStreamingServerHandler::getSignalNumericId(const SignalPtr& signal)
+{
+    return streamingManager.findSignalNumericId(signal);
+}
+
 void NativeStreamingServerHandler::sendAvailableStreamingPackets()
 {
     std::scoped_lock lock(sync);
@@ -266,9 +278,9 @@ void NativeStreamingServerHandler::sendAvailableStreamingPackets()
     {
         if (const auto packetStreamingServerPtr = streamingManager.getPacketServerIfRegistered(clientId))
         {
-            auto [tasks, timeStamp] = StreamingManager::getStreamingWriteTasks(packetStreamingServerPtr);
+            auto [tasks, timeStamp, writeBatch] = StreamingManager::getStreamingWriteTasks(packetStreamingServerPtr);
             if (!tasks.empty())
-                sessionHandler->schedulePacketBufferWriteTasks(std::move(tasks), std::move(timeStamp));
+                sessionHandler->schedulePacketBufferWriteTasks(std::move(tasks), std::move(timeStamp), writeBatch);
         }
     }
 }
@@ -308,6 +320,18 @@ PropertyObjectPtr NativeStreamingServerHandler::createDefaultConfig()
                                                         .build();
         defaultConfig.addProperty(streamingPacketSendTimeoutProp);
     }
+    {
+        const auto streamingSendQueueByteLimitPropDescription =
+            "Defines the limit for the total size (in bytes) of streaming packets queued for transmission to a single client. "
+            "If the packets queued for a client exceed the limit, the server will reset the connection for the corresponding client, "
+            "effectively clearing its queue. Unlike the send timeout, the limit bounds the memory held by a slow client's queue "
+            "regardless of the data rate. The default value '0' signifies that the size of the queue is not limited.";
+        const auto streamingSendQueueByteLimitProp = IntPropertyBuilder("StreamingSendQueueByteLimit", UNLIMITED_SEND_QUEUE_SIZE)
+                                                         .setMinValue(0)
+                                                         .setDescription(streamingSendQueueByteLimitPropDescription)
+                                                         .build();
+        defaultConfig.addProperty(streamingSendQueueByteLimitProp);
+    }
     {
         const auto cacheablePayloadSizeMaxPropDescription =
             "Defines the threshold for packet's raw data payload size (in bytes) below which streaming data transmission optimizations are applied. "
@@ -563,6 +587,15 @@ void NativeStreamingServerHandler::handleTransportLayerProps(const PropertyObjec
     {
         sessionHandler->setExclusiveControlDropOthers(false);
     }
+
+    // clients not advertising the event encoding version support only JSON encoded event packets
+    if (propertyObject.hasProperty("EventPacketEncodingVersion") &&
+        propertyObject.getProperty("EventPacketEncodingVersion").getValueType() == ctInt)
+    {
+        const Int version = propertyObject.getPropertyValue("EventPacketEncodingVersion");
+        sessionHandler->setEventEncodingVersion(
+            static_cast<uint8_t>(std::clamp<Int>(version, packet_streaming::EVENT_ENCODING_JSON, packet_streaming::EVENT_ENCODING_VERSION_LATEST)));
+    }
 }
 
 void NativeStreamingServerHandler::setUpTransportLayerPropsCallback(std::shared_ptr<ServerSessionHandler> sessionHandler)
@@ -745,7 +778,8 @@ void NativeStreamingServerHandler::handleStreamingInit(std::shared_ptr<ServerSes
                                     sessionHandler->getReconnected(),
                                     streamingPacketSendTimeout != UNLIMITED_PACKET_SEND_TIME,
                                     cacheablePacketPayloadSizeMax,
-                                    packetStreamingReleaseThreshold);
+                                    packetStreamingReleaseThreshold,
+                                    sessionHandler->getEventEncodingVersion());
 
     OnPacketBufferReceivedCallback packetBufferReceivedHandler =
         [clientId = sessionHandler->getClientId(), thisWeakPtr = this->weak_from_this()](const packet_streaming::PacketBufferPtr& packetBuffer)
@@ -932,7 +966,8 @@ void NativeStreamingServerHandler::initSessionHandler(SessionPtr session)
                                                                  findSignalHandler,
                                                                  signalSubscriptionHandler,
                                                                  errorHandler,
-                                                                 streamingPacketSendTimeout);
+                                                                 streamingPacketSendTimeout,
+                                                                 streamingSendQueueByteLimit);
 
     setUpTransportLayerPropsCallback(sessionHandler);
 
@@ -18,7 +18,8 @@ ServerSessionHandler::ServerSessionHandler(const ContextPtr& daqContext,
                                            OnFindSignalCallback findSignalHandler,
                                            OnSignalSubscriptionCallback signalSubscriptionHandler,
                                            OnSessionErrorCallback errorHandler,
-                                           SizeT streamingPacketSendTimeout)
+                                           SizeT streamingPacketSendTimeout,
+                                           SizeT streamingSendQueueByteLimit)
     : BaseSessionHandler(daqContext,
                          session,
                          ioContextPtr,
@@ -28,7 +29,8 @@ ServerSessionHandler::ServerSessionHandler(const ContextPtr& daqContext,
                          findSignalHandler,
                          signalSubscriptionHandler,
                          "NativeProtocolServerSessionHandler",
-                         streamingPacketSendTimeout)
+                         streamingPacketSendTimeout,
+                         streamingSendQueueByteLimit)
     , transportLayerPropsHandler(nullptr)
     , clientId(clientId)
     , reconnected(false)
@@ -140,6 +142,16 @@ bool ServerSessionHandler::isExclusiveControlDropOthersEnabled()
     return exclusiveControlDropOthers;
 }
 
+void ServerSessionHandler::setEventEncodingVersion(uint8_t version)
+{
+    eventEncodingVersion = version;
+}
+
+uint8_t ServerSessionHandler::getEventEncodingVersion()
+{
+    return eventEncodingVersion;
+}
+
 void ServerSessionHandler::setClientId(const std::string& clientId)
 {
     this->clientId = clientId;
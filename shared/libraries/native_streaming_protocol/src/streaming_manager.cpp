@@ -67,44 +67,58 @@ void StreamingManager::processPackets(const tsl::ordered_map<std::string, Packet
 
     for (auto& [signalStringId, packetData] : packetIndices)
     {
-        if (auto it1 = registeredSignals.find(signalStringId); it1 != registeredSignals.end())
-        {
-            auto& registeredSignal = it1->second;
+        if (auto it = registeredSignals.find(signalStringId); it != registeredSignals.end())
+            processSignalPacketsNoLock(it->second, packetData, packets);
+        else
+            throw NativeStreamingProtocolException(fmt::format("Can't process packet - signal {} is not registered in streaming", signalStringId));
+    }
+}
+
+void StreamingManager::processPackets(const SignalPacketIndices& packetIndices, const std::vector<IPacket*>& packets)
+{
+    std::scoped_lock lock(sync);
+
+    for (auto& [signalNumericId, packetData] : packetIndices)
+    {
+        if (auto it = registeredSignalsByNumericId.find(signalNumericId); it != registeredSignalsByNumericId.end())
+            processSignalPacketsNoLock(*it->second, packetData, packets);
+        else
+            throw NativeStreamingProtocolException(fmt::format("Can't process packet - signal with numeric ID {} is not registered in streaming", signalNumericId));
+    }
+}
+
+void StreamingManager::processSignalPacketsNoLock(RegisteredServerSignal& registeredSignal,
+                                                  const PacketBufferData& packetData,
+                                                  const std::vector<IPacket*>& packets)
+{
+    for (int i = packetData.index; i < packetData.index + packetData.count; ++i)
+    {
+        auto packet = PacketPtr::Adopt(packets[i]);
 
-            for (int i = packetData.index; i < packetData.index + packetData.count; ++i)
+        if (packet.getType() == PacketType::Event)
+        {
+            const auto eventPacket = packet.asPtr<IEventPacket>(true);
+            if (eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
             {
-                auto packet = PacketPtr::Adopt(packets[i]);
-                
-                if (packet.getType() == PacketType::Event)
-                {
-                    const auto eventPacket = packet.asPtr<IEventPacket>(true);
-                    if (eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
-                    {
-                        const DataDescriptorPtr dataDescriptorParam = eventPacket.getParameters().get(event_packet_param::DATA_DESCRIPTOR);
-                        const DataDescriptorPtr domainDescriptorParam = eventPacket.getParameters().get(event_packet_param::DOMAIN_DATA_DESCRIPTOR);
-
-                        if (dataDescriptorParam.assigned())
-                            registeredSignal.lastDataDescriptorParam = dataDescriptorParam;
-                        if (domainDescriptorParam.assigned())
-                            registeredSignal.lastDomainDescriptorParam = domainDescriptorParam;
-                    }
-                }
+                const DataDescriptorPtr dataDescriptorParam = eventPacket.getParameters().get(event_packet_param::DATA_DESCRIPTOR);
+                const DataDescriptorPtr domainDescriptorParam = eventPacket.getParameters().get(event_packet_param::DOMAIN_DATA_DESCRIPTOR);
 
-                if (auto it2 = registeredSignal.subscribedClientsIds.begin(); it2 != registeredSignal.subscribedClientsIds.end())
-                {
-                    while (std::next(it2) != registeredSignal.subscribedClientsIds.end())
-                    {
-                        packetStreamingServers.at(*it2)->addDaqPacket(registeredSignal.numericId, packet);
-                        ++it2;
-                    }
-        
-                    pushToPacketStreamingServer(packetStreamingServers.at(*it2), std::move(packet), registeredSignal.numericId);
-                }
+                if (dataDescriptorParam.assigned())
+                    registeredSignal.lastDataDescriptorParam = dataDescriptorParam;
+                if (domainDescriptorParam.assigned())
+                    registeredSignal.lastDomainDescriptorParam = domainDescriptorParam;
             }
         }
-        else
+
+        if (auto it = registeredSignal.subscribedClientsIds.begin(); it != registeredSignal.subscribedClientsIds.end())
         {
-            throw NativeStreamingProtocolException(fmt::format("Can't process packet - signal {} is not registered in streaming", signalStringId));
+            while (std::next(it) != registeredSignal.subscribedClientsIds.end())
+            {
+                packetStreamingServers.at(*it)->addDaqPacket(registeredSignal.numericId, packet);
+                ++it;
+            }
+
+            pushToPacketStreamingServer(packetStreamingServers.at(*it), std::move(packet), registeredSignal.numericId);
         }
     }
 }
@@ -169,7 +183,8 @@ void StreamingManager::linearCachingAssertion(const std::string& condition,
 
 WriteTask StreamingManager::cachePacketsToLinearBuffer(const PacketStreamingServerPtr& packetStreamingServerPtr,
                                                        size_t cacheableGroupId,
-                                                       std::optional<std::chrono::steady_clock::time_point>& timeStamp)
+                                                       std::optional<std::chrono::steady_clock::time_point>& timeStamp,
+                                                       PacketBufferWriteBatch& writeBatch)
 {
     size_t countOfCacheableBuffer = packetStreamingServerPtr->getCountOfCacheableBuffers(cacheableGroupId);
     size_t sizeOfCacheableBuffers = packetStreamingServerPtr->getSizeOfCacheableBuffers(cacheableGroupId);
@@ -180,7 +195,7 @@ WriteTask StreamingManager::cachePacketsToLinearBuffer(const PacketStreamingServ
 
     const size_t linearCacheBufferSize =
         TransportHeader::PACKED_HEADER_SIZE * countOfCacheableBuffer + sizeOfCacheableBuffers;
-    auto linearCacheBuffer = std::make_shared<std::vector<char>>(linearCacheBufferSize);
+    char* linearCacheBuffer = writeBatch.allocateBuffer(linearCacheBufferSize);
 
     for(size_t i = 0; i < countOfCacheableBuffer; ++i)
     {
@@ -198,11 +213,11 @@ WriteTask StreamingManager::cachePacketsToLinearBuffer(const PacketStreamingServ
             linearCachingAssertion("linearCacheBufferSize < linearBufferCurPos + packetBufferSize", packetStreamingServerPtr, packetBufferPtr);
         }
 
-        BaseSessionHandler::copyHeadersToBuffer(packetBufferPtr, linearCacheBuffer->data() + linearBufferCurPos);
+        BaseSessionHandler::copyHeadersToBuffer(packetBufferPtr, linearCacheBuffer + linearBufferCurPos);
         linearBufferCurPos += TransportHeader::PACKED_HEADER_SIZE + packetBufferPtr->packetHeader->size;
         if (packetBufferPtr->packetHeader->payloadSize > 0)
         {
-            std::memcpy(linearCacheBuffer->data() + linearBufferCurPos,
+            std::memcpy(linearCacheBuffer + linearBufferCurPos,
                         packetBufferPtr->payload,
                         packetBufferPtr->packetHeader->payloadSize);
         }
@@ -215,8 +230,7 @@ WriteTask StreamingManager::cachePacketsToLinearBuffer(const PacketStreamingServ
     if (linearBufferCurPos != linearCacheBufferSize)
         linearCachingAssertion("linearBufferCurPos != linearCacheBufferSize", packetStreamingServerPtr, nullptr);
 
-    WriteHandler linearBufferHandler = [linearCacheBuffer = linearCacheBuffer]() {};
-    return WriteTask(boost::asio::const_buffer(linearCacheBuffer->data(), linearCacheBuffer->size()), linearBufferHandler);
+    return WriteTask(boost::asio::const_buffer(linearCacheBuffer, linearCacheBufferSize), []() {});
 }
 
 SignalNumericIdType StreamingManager::registerSignal(const SignalPtr& signal)
@@ -228,7 +242,8 @@ SignalNumericIdType StreamingManager::registerSignal(const SignalPtr& signal)
     if (auto iter = registeredSignals.find(signalStringId); iter == registeredSignals.end())
     {
         auto signalNumericId = ++signalNumericIdCounter;
-        registeredSignals.insert({signalStringId, RegisteredServerSignal(signal, signalNumericId)});
+        auto [inserted, _] = registeredSignals.insert({signalStringId, RegisteredServerSignal(signal, signalNumericId)});
+        registeredSignalsByNumericId.insert({signalNumericId, &inserted->second});
         return signalNumericId;
     }
     else
@@ -244,6 +259,7 @@ void StreamingManager::removeSignal(const SignalPtr& signal)
     std::scoped_lock lock(sync);
     if (auto signalIter = registeredSignals.find(signalStringId); signalIter != registeredSignals.end())
     {
+        registeredSignalsByNumericId.erase(signalIter->second.numericId);
         registeredSignals.erase(signalIter);
     }
     else
@@ -275,7 +291,8 @@ void StreamingManager::registerClient(const std::string& clientId,
                                       bool reconnected,
                                       bool enablePacketBufferTimestamps,
                                       size_t packetStreamingReleaseThreshold,
-                                      size_t cacheablePacketPayloadSizeMax)
+                                      size_t cacheablePacketPayloadSizeMax,
+                                      uint8_t eventEncodingVersion)
 {
     std::scoped_lock lock(sync);
 
@@ -305,7 +322,9 @@ void StreamingManager::registerClient(const std::string& clientId,
                 std::make_shared<packet_streaming::PacketStreamingServer>(
                     cacheablePacketPayloadSizeMax,
                     packetStreamingReleaseThreshold,
-                    enablePacketBufferTimestamps)
+                    enablePacketBufferTimestamps,
+                    0,
+                    eventEncodingVersion)
             }
         );
     }
@@ -501,22 +520,25 @@ StreamingWriteTasks StreamingManager::getStreamingWriteTasks(const PacketStreami
     // header and payload separate write tasks for each non-cacheable buffer
     // plus one task for each group of cacheable buffers
     tasks.reserve(2 * nonCacheableBuffersCount + cacheableGroupsCount);
+    auto writeBatch = std::make_shared<PacketBufferWriteBatch>(nonCacheableBuffersCount);
 
     while (auto packetBufferPtr = packetStreamingServerPtr->peekNextPacketBuffer())
     {
         if (packetBufferPtr->isCacheable())
         {
-            tasks.push_back(cachePacketsToLinearBuffer(packetStreamingServerPtr, packetBufferPtr->cacheableGroupId, timeStamp));
+            tasks.push_back(cachePacketsToLinearBuffer(packetStreamingServerPtr, packetBufferPtr->cacheableGroupId, timeStamp, *writeBatch));
         }
         else
         {
             if (!timeStamp.has_value() && packetBufferPtr->timeStamp.has_value())
                 timeStamp = packetBufferPtr->timeStamp.value();
-            BaseSessionHandler::createAndPushPacketBufferTasks(packetStreamingServerPtr->getNextPacketBuffer(), tasks);
+            BaseSessionHandler::createAndPushPacketBufferTasks(packetStreamingServerPtr->getNextPacketBuffer(), tasks, *writeBatch);
         }
     }
 
-    return {tasks, timeStamp};
+    BaseSessionHandler::attachWriteBatch(tasks, writeBatch);
+
+    return {std::move(tasks), timeStamp, std::move(writeBatch)};
 }
 
 void StreamingManager::registerClientSignal(const SignalNumericIdType& signalNumericId,
@@ -7,6 +7,9 @@
 
 #include <memory>
 #include <future>
+#include <atomic>
+#include <functional>
+#include <thread>
 
 using namespace daq;
 using namespace daq::opendaq_native_streaming_protocol;
@@ -201,7 +204,9 @@ public:
         return clientHandler;
     }
 
-    void startServer(const ListPtr<ISignal>& signalsList, const EventPacketPtr& eventPacket = nullptr)
+    void startServer(const ListPtr<ISignal>& signalsList,
+                     const EventPacketPtr& eventPacket = nullptr,
+                     SizeT streamingSendQueueByteLimit = UNLIMITED_SEND_QUEUE_SIZE)
     {
         initialEventPacket = eventPacket;
         startIoOperations();
@@ -209,6 +214,7 @@ public:
         auto config = NativeStreamingServerHandler::createDefaultConfig();
         // maxAllowedConfigConnections = 1 is used here to verify that the limit does not impact streaming connections
         config.setPropertyValue("MaxAllowedConfigConnections", 1);
+        config.setPropertyValue("StreamingSendQueueByteLimit", streamingSendQueueByteLimit);
 
         serverHandler = std::make_shared<NativeStreamingServerHandler>(
             serverContext,
@@ -901,6 +907,122 @@ TEST_P(StreamingProtocolTest, SendMultipleDataPackets)
     }
 }
 
+TEST_P(StreamingProtocolTest, SendQueueByteLimitExceeded)
+{
+    const SizeT packetsCount = 20;
+    const SizeT packetsWithinLimit = 4;
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    auto serverEventPacket = DataDescriptorChangedEventPacket(valueDescriptor, NullDataDescriptor());
+    auto serverSignal = SignalWithDescriptor(serverContext, valueDescriptor, nullptr, "signal");
+
+    // the signal is subscribed again after the connections are reset
+    signalSubscribedHandler = [this](const SignalPtr& signal)
+    {
+        serverHandler->sendPacket(signal.getGlobalId().toStdString(), initialEventPacket);
+    };
+    signalUnsubscribedHandler = [](const SignalPtr&) {};
+
+    // each data packet carries 400 bytes of samples, so the limit is reached after a few packets
+    startServer(List<ISignal>(serverSignal), serverEventPacket, packetsWithinLimit * 500);
+
+    struct ReceivedPackets
+    {
+        std::atomic<SizeT> eventPackets{0};
+        std::atomic<SizeT> dataPackets{0};
+    };
+    std::vector<std::shared_ptr<ReceivedPackets>> receivedPackets;
+
+    auto waitFor = [this](const std::function<bool()>& condition)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!condition() && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return condition();
+    };
+
+    auto subscribe = [this, &waitFor](StreamingProtocolAttributes& client, const std::shared_ptr<ReceivedPackets>& received)
+    {
+        client.streamingInitPromise = std::promise< void >();
+        client.streamingInitFuture = client.streamingInitPromise.get_future();
+        client.signalAvailablePromise = std::promise< std::tuple<StringPtr, StringPtr> >();
+        client.signalAvailableFuture = client.signalAvailablePromise.get_future();
+        client.subscribedAckPromise = std::promise< StringPtr >();
+        client.subscribedAckFuture = client.subscribedAckPromise.get_future();
+
+        const SizeT eventPackets = received->eventPackets;
+        client.clientHandler->sendStreamingRequest();
+        ASSERT_EQ(client.streamingInitFuture.wait_for(timeout), std::future_status::ready);
+        ASSERT_EQ(client.signalAvailableFuture.wait_for(timeout), std::future_status::ready);
+
+        client.clientHandler->subscribeSignal(std::get<0>(client.signalAvailableFuture.get()));
+        ASSERT_EQ(client.subscribedAckFuture.wait_for(timeout), std::future_status::ready);
+        ASSERT_TRUE(waitFor([&received, eventPackets] { return received->eventPackets > eventPackets; }));
+    };
+
+    for (auto& client : clients)
+    {
+        auto received = std::make_shared<ReceivedPackets>();
+        receivedPackets.push_back(received);
+
+        client.clientHandler = createClient(client, client.signalAvailableHandler);
+        client.packetHandler = [received](const StringPtr& /*signalStringId*/, const PacketPtr& packet)
+        {
+            if (packet.getType() == PacketType::Data)
+                ++received->dataPackets;
+            else
+                ++received->eventPackets;
+        };
+        client.clientHandler->setStreamingHandlers(client.signalAvailableHandler,
+                                                   client.signalUnavailableHandler,
+                                                   client.packetHandler,
+                                                   client.signalSubscriptionAckHandler,
+                                                   client.connectionStatusChangedHandler,
+                                                   client.streamingInitDoneHandler);
+
+        ASSERT_TRUE(client.clientHandler->connect(SERVER_ADDRESS, NATIVE_STREAMING_LISTENING_PORT));
+        subscribe(client, received);
+    }
+
+    // the server does not write while its io thread is blocked, so all the packets stay queued
+    std::promise<void> unblockPromise;
+    std::shared_future<void> unblockFuture = unblockPromise.get_future().share();
+    boost::asio::post(*ioContextPtrServer, [unblockFuture]() { unblockFuture.wait(); });
+
+    for (SizeT i = 0; i < packetsCount; ++i)
+        serverHandler->sendPacket(serverSignal.getGlobalId().toStdString(), DataPacket(valueDescriptor, 100, i * 100));
+
+    unblockPromise.set_value();
+
+    // packets above the limit are dropped and the connections are reset
+    for (size_t i = 0; i < clients.size(); ++i)
+    {
+        auto& client = clients[i];
+        ASSERT_EQ(client.connectionStatusFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+        ASSERT_EQ(client.connectionStatusFuture.get(), "Reconnecting");
+        ASSERT_LE(receivedPackets[i]->dataPackets.load(), packetsWithinLimit);
+
+        client.connectionStatusPromise = std::promise< EnumerationPtr >();
+        client.connectionStatusFuture = client.connectionStatusPromise.get_future();
+    }
+
+    // the queues of the new connections are empty, so packets are sent again
+    for (size_t i = 0; i < clients.size(); ++i)
+    {
+        auto& client = clients[i];
+        ASSERT_EQ(client.connectionStatusFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+        ASSERT_EQ(client.connectionStatusFuture.get(), "Connected");
+
+        subscribe(client, receivedPackets[i]);
+        receivedPackets[i]->dataPackets = 0;
+    }
+
+    serverHandler->sendPacket(serverSignal.getGlobalId().toStdString(), DataPacket(valueDescriptor, 100, packetsCount * 100));
+
+    for (const auto& received : receivedPackets)
+        ASSERT_TRUE(waitFor([&received] { return received->dataPackets == 1; }));
+}
+
 TEST_P(StreamingProtocolTest, AddNotPublicSignal)
 {
     startServer(List<ISignal>());
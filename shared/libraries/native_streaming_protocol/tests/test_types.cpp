@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 #include <testutils/memcheck_listener.h>
 #include <native_streaming_protocol/native_streaming_protocol_types.h>
+#include <native_streaming_protocol/base_session_handler.h>
 #include <memory>
+#include <cstring>
 
 using namespace daq;
 using namespace daq::opendaq_native_streaming_protocol;
@@ -23,3 +25,31 @@ TEST_F(TypesTest, TransportHeader)
         ASSERT_EQ(header2.getPayloadSize(), payloadSize);
     }
 }
+
+TEST_F(TypesTest, PacketBufferWriteBatch)
+{
+    const size_t packetsCount = 4;
+    auto queuedBytesCounter = std::make_shared<std::atomic<SizeT>>(100);
+
+    {
+        PacketBufferWriteBatch writeBatch(packetsCount);
+
+        // headers of the expected packets are placed contiguously into the arena
+        char* firstHeaders = writeBatch.allocateHeaders(TransportHeader::PACKED_HEADER_SIZE);
+        char* secondHeaders = writeBatch.allocateHeaders(TransportHeader::PACKED_HEADER_SIZE);
+        ASSERT_EQ(secondHeaders, firstHeaders + TransportHeader::PACKED_HEADER_SIZE);
+
+        // memory allocated when the arena is exhausted remains valid
+        const size_t largeSize = 1024 * 1024;
+        char* largeHeaders = writeBatch.allocateHeaders(largeSize);
+        ASSERT_NE(largeHeaders, nullptr);
+        std::memset(largeHeaders, 0xFF, largeSize);
+        ASSERT_EQ(writeBatch.allocateHeaders(TransportHeader::PACKED_HEADER_SIZE),
+                  secondHeaders + TransportHeader::PACKED_HEADER_SIZE);
+
+        writeBatch.trackQueuedBytes(queuedBytesCounter, 60);
+        ASSERT_EQ(queuedBytesCounter->load(), 100u);
+    }
+
+    ASSERT_EQ(queuedBytesCounter->load(), 40u);
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <packet_streaming/packet_streaming.h>
+#include <opendaq/event_packet_ptr.h>
+#include <vector>
+
+namespace daq::packet_streaming
+{
+
+// Event packet payload encodings, stored in the version field of the event packet header
+static constexpr uint8_t EVENT_ENCODING_JSON = 0;
+static constexpr uint8_t EVENT_ENCODING_BINARY_V1 = 1;
+static constexpr uint8_t EVENT_ENCODING_VERSION_LATEST = EVENT_ENCODING_BINARY_V1;
+
+/*
+ * Compact binary encoding of event packets.
+ * Covers the event parameter values used by the openDAQ event packets: null, bool, integer, float,
+ * string, ratio, list and dictionary values, as well as data descriptors and the objects they are built of.
+ * Events with parameters of any other type can't be encoded and are expected to be sent as JSON instead.
+ */
+class BinaryEventPacketEncoder
+{
+public:
+    // Returns false if the packet contains a value not supported by the binary encoding
+    bool encode(const EventPacketPtr& packet, std::vector<uint8_t>& output);
+};
+
+class BinaryEventPacketDecoder
+{
+public:
+    // Throws PacketStreamingException if the payload is malformed
+    EventPacketPtr decode(const void* payload, size_t payloadSize);
+};
+
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <packet_streaming/packet_streaming.h>
+#include <coretypes/lock_free_stack.h>
+#include <array>
+#include <atomic>
+
+namespace daq::packet_streaming
+{
+
+/*
+ * Recycles the memory blocks of received packet buffers.
+ * Blocks are grouped into power-of-two size classes, each keeping a bounded lock-free list of free blocks,
+ * so blocks can be returned from any thread that releases the last reference to a packet.
+ * Blocks larger than the biggest size class are not pooled.
+ */
+class PacketBufferMemoryPool
+{
+public:
+    static constexpr size_t MinBlockSizeShift = 6;
+    static constexpr size_t MaxBlockSizeShift = 20;
+    static constexpr size_t MaxFreeBlocksPerClass = 256;
+
+    PacketBufferMemoryPool();
+    ~PacketBufferMemoryPool();
+
+    PacketBufferMemoryPool(const PacketBufferMemoryPool&) = delete;
+    PacketBufferMemoryPool& operator=(const PacketBufferMemoryPool&) = delete;
+
+    // Process-wide pool; it is never destroyed, as packets referencing its blocks may outlive any other owner
+    static PacketBufferMemoryPool& Instance();
+
+    void* allocate(size_t size);
+    void deallocate(void* block, size_t size);
+
+    size_t getFreeBlockCount(size_t size) const;
+
+private:
+    struct SizeClass
+    {
+        LockFreeStackHandle freeBlocks;
+        std::atomic<size_t> freeBlockCount{0};
+    };
+
+    std::array<SizeClass, MaxBlockSizeShift - MinBlockSizeShift + 1> sizeClasses;
+
+    static size_t getSizeClassIndex(size_t size);
+};
+
+/*
+ * Creates a packet buffer with the header and the payload stored in a single block of the packet buffer memory pool.
+ * The payload starts at the first suitably aligned offset after the header and is null if the payload size is 0.
+ */
+PacketBufferPtr createPooledPacketBuffer(size_t headerSize, size_t payloadSize);
+
+}
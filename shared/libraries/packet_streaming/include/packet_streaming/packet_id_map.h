@@ -0,0 +1,137 @@
+/*
+ * Copyright 2022-2026 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <coretypes/common.h>
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace daq::packet_streaming
+{
+
+/*
+ * Map of values keyed by packet ID, stored in a flat vector sorted by ID.
+ * Packet IDs are assigned in increasing order by the server, so new entries are appended at the back
+ * and the oldest ones are released from the front. Erased entries leave a hole that is skipped by the
+ * live range and reclaimed once the holes make up half of the storage, which keeps the capacity
+ * reused after warm-up without per-entry allocations.
+ */
+template <typename T>
+class PacketIdMap
+{
+public:
+    T* find(Int packetId)
+    {
+        const auto it = lowerBound(packetId);
+        if (it == entries.end() || it->packetId != packetId || !it->value.has_value())
+            return nullptr;
+        return &it->value.value();
+    }
+
+    // Returns false if the packet ID is already present
+    bool insert(Int packetId, T value)
+    {
+        if (entries.size() == head || entries.back().packetId < packetId)
+        {
+            entries.push_back({packetId, std::move(value)});
+            ++count;
+            return true;
+        }
+
+        const auto it = lowerBound(packetId);
+        if (it != entries.end() && it->packetId == packetId)
+        {
+            if (it->value.has_value())
+                return false;
+            it->value = std::move(value);
+        }
+        else
+        {
+            entries.insert(it, {packetId, std::move(value)});
+        }
+
+        ++count;
+        return true;
+    }
+
+    bool erase(Int packetId)
+    {
+        const auto it = lowerBound(packetId);
+        if (it == entries.end() || it->packetId != packetId || !it->value.has_value())
+            return false;
+
+        it->value.reset();
+        --count;
+        reclaim();
+        return true;
+    }
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    size_t size() const
+    {
+        return count;
+    }
+
+private:
+    struct Entry
+    {
+        Int packetId;
+        std::optional<T> value;
+    };
+
+    std::vector<Entry> entries;
+    size_t head = 0;
+    size_t count = 0;
+
+    typename std::vector<Entry>::iterator lowerBound(Int packetId)
+    {
+        return std::lower_bound(entries.begin() + head,
+                                entries.end(),
+                                packetId,
+                                [](const Entry& entry, Int id) { return entry.packetId < id; });
+    }
+
+    void reclaim()
+    {
+        if (count == 0)
+        {
+            entries.clear();
+            head = 0;
+            return;
+        }
+
+        while (!entries[head].value.has_value())
+            ++head;
+        while (!entries.back().value.has_value())
+            entries.pop_back();
+
+        const size_t holes = entries.size() - count;
+        if (holes > 0 && holes >= entries.size() / 2)
+        {
+            entries.erase(std::remove_if(entries.begin(), entries.end(), [](const Entry& entry) { return !entry.value.has_value(); }),
+                          entries.end());
+            head = 0;
+        }
+    }
+};
+
+}
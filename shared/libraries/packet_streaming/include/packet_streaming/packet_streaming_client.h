@@ -17,6 +17,8 @@
 #pragma once
 
 #include <packet_streaming/packet_streaming.h>
+#include <packet_streaming/event_packet_encoding.h>
+#include <packet_streaming/packet_id_map.h>
 #include <opendaq/data_packet_ptr.h>
 #include "opendaq/event_packet_ptr.h"
 #include <queue>
@@ -45,13 +47,14 @@ public:
 
 private:
     DeserializerPtr jsonDeserializer;
+    BinaryEventPacketDecoder binaryEventDecoder;
     std::queue<std::tuple<uint32_t, PacketPtr>> queue;
     std::unordered_map<uint32_t, DataDescriptorPtr> dataDescriptors;
     std::unordered_map<uint32_t, DataDescriptorPtr> domainDescriptors;
 
-    std::unordered_map<Int, DataPacketPtr> referencedPackets;
-    std::unordered_map<Int, PacketBufferPtr> referencedPacketBuffers;
-    std::unordered_map<Int, std::vector<PacketBufferPtr>> packetBuffersWaitingForDomainPackets;
+    PacketIdMap<DataPacketPtr> referencedPackets;
+    PacketIdMap<PacketBufferPtr> referencedPacketBuffers;
+    PacketIdMap<std::vector<PacketBufferPtr>> packetBuffersWaitingForDomainPackets;
 
     mutable std::mutex descriptorsSync;
 
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <packet_streaming/packet_streaming.h>
+#include <packet_streaming/event_packet_encoding.h>
 #include <opendaq/data_packet_ptr.h>
 #include <opendaq/event_packet_ptr.h>
 #include <queue>
@@ -44,7 +45,8 @@ public:
     PacketStreamingServer(size_t cacheablePacketPayloadSizeMax,
                           size_t releaseThreshold,
                           bool attachTimestampToPacketBuffer,
-                          Int jsonSerializerVersion = 0);
+                          Int jsonSerializerVersion = 0,
+                          uint8_t eventEncodingVersion = EVENT_ENCODING_JSON);
 
     void addDaqPacket(const uint32_t signalId, const PacketPtr& packet);
     void addDaqPacket(const uint32_t signalId, PacketPtr&& packet);
@@ -61,6 +63,8 @@ public:
 
 private:
     SerializerPtr jsonSerializer;
+    BinaryEventPacketEncoder binaryEventEncoder;
+    const uint8_t eventEncodingVersion;
     std::queue<PacketBufferPtr> queue;
 
     size_t countOfNonCacheableBuffers;
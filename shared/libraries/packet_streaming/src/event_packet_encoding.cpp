@@ -0,0 +1,541 @@
+#include <packet_streaming/event_packet_encoding.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/data_rule_factory.h>
+#include <opendaq/dimension_factory.h>
+#include <opendaq/dimension_rule_factory.h>
+#include <opendaq/range_factory.h>
+#include <opendaq/reference_domain_info_factory.h>
+#include <opendaq/scaling_factory.h>
+#include <coreobjects/unit_factory.h>
+#include <coretypes/list_element_type.h>
+#include <coretypes/dict_element_type.h>
+#include <cstring>
+
+namespace daq::packet_streaming
+{
+
+namespace
+{
+
+enum class ValueTag : uint8_t
+{
+    Null = 0,
+    False,
+    True,
+    Integer,
+    Float,
+    String,
+    Ratio,
+    List,
+    Dict,
+    DataDescriptor,
+    Unit,
+    Range,
+    DataRule,
+    Scaling,
+    Dimension,
+    DimensionRule,
+    ReferenceDomainInfo
+};
+
+class Writer
+{
+public:
+    explicit Writer(std::vector<uint8_t>& output)
+        : output(output)
+    {
+    }
+
+    void writeByte(uint8_t value)
+    {
+        output.push_back(value);
+    }
+
+    void writeTag(ValueTag tag)
+    {
+        output.push_back(static_cast<uint8_t>(tag));
+    }
+
+    void writeUInt(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            output.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        output.push_back(static_cast<uint8_t>(value));
+    }
+
+    // zig-zag encoded so that small negative values are compact as well
+    void writeInt(int64_t value)
+    {
+        writeUInt((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    void writeFloat(double value)
+    {
+        writeRaw(&value, sizeof(value));
+    }
+
+    void writeString(const StringPtr& value)
+    {
+        const auto length = value.getLength();
+        writeUInt(length);
+        writeRaw(value.getCharPtr(), length);
+    }
+
+    void writeIntfId(const IntfID& id)
+    {
+        if (id == IUnknown::Id)
+        {
+            writeByte(0);
+        }
+        else
+        {
+            writeByte(1);
+            writeRaw(&id, sizeof(IntfID));
+        }
+    }
+
+    bool writeValue(const BaseObjectPtr& value);
+
+private:
+    std::vector<uint8_t>& output;
+
+    void writeRaw(const void* data, size_t size)
+    {
+        const auto bytes = static_cast<const uint8_t*>(data);
+        output.insert(output.end(), bytes, bytes + size);
+    }
+
+    bool writeList(const ListPtr<IBaseObject>& value);
+    bool writeDict(const DictPtr<IBaseObject, IBaseObject>& value);
+    bool writeObject(const BaseObjectPtr& value);
+};
+
+bool Writer::writeValue(const BaseObjectPtr& value)
+{
+    if (!value.assigned())
+    {
+        writeTag(ValueTag::Null);
+        return true;
+    }
+
+    switch (value.getCoreType())
+    {
+        case ctBool:
+            writeTag(static_cast<bool>(value) ? ValueTag::True : ValueTag::False);
+            return true;
+        case ctInt:
+            writeTag(ValueTag::Integer);
+            writeInt(static_cast<Int>(value));
+            return true;
+        case ctFloat:
+            writeTag(ValueTag::Float);
+            writeFloat(static_cast<Float>(value));
+            return true;
+        case ctString:
+            writeTag(ValueTag::String);
+            writeString(value);
+            return true;
+        case ctRatio:
+        {
+            const RatioPtr ratio = value;
+            writeTag(ValueTag::Ratio);
+            writeInt(ratio.getNumerator());
+            writeInt(ratio.getDenominator());
+            return true;
+        }
+        case ctList:
+            return writeList(value);
+        case ctDict:
+            return writeDict(value);
+        default:
+            return writeObject(value);
+    }
+}
+
+bool Writer::writeList(const ListPtr<IBaseObject>& value)
+{
+    IntfID elementId = IUnknown::Id;
+    if (const auto elementType = value.asPtrOrNull<IListElementType>(true); elementType.assigned())
+        elementType->getElementInterfaceId(&elementId);
+
+    writeTag(ValueTag::List);
+    writeIntfId(elementId);
+    writeUInt(value.getCount());
+    for (const auto& item : value)
+    {
+        if (!writeValue(item))
+            return false;
+    }
+    return true;
+}
+
+bool Writer::writeDict(const DictPtr<IBaseObject, IBaseObject>& value)
+{
+    IntfID keyId = IUnknown::Id;
+    IntfID valueId = IUnknown::Id;
+    if (const auto elementType = value.asPtrOrNull<IDictElementType>(true); elementType.assigned())
+    {
+        elementType->getKeyInterfaceId(&keyId);
+        elementType->getValueInterfaceId(&valueId);
+    }
+
+    writeTag(ValueTag::Dict);
+    writeIntfId(keyId);
+    writeIntfId(valueId);
+    writeUInt(value.getCount());
+    for (const auto& [key, item] : value)
+    {
+        if (!writeValue(key) || !writeValue(item))
+            return false;
+    }
+    return true;
+}
+
+bool Writer::writeObject(const BaseObjectPtr& value)
+{
+    if (const auto descriptor = value.asPtrOrNull<IDataDescriptor>(true); descriptor.assigned())
+    {
+        writeTag(ValueTag::DataDescriptor);
+        writeInt(static_cast<Int>(descriptor.getSampleType()));
+        return writeValue(descriptor.getName()) &&
+               writeValue(descriptor.getUnit()) &&
+               writeValue(descriptor.getDimensions()) &&
+               writeValue(descriptor.getValueRange()) &&
+               writeValue(descriptor.getRule()) &&
+               writeValue(descriptor.getPostScaling()) &&
+               writeValue(descriptor.getOrigin()) &&
+               writeValue(descriptor.getTickResolution()) &&
+               writeValue(descriptor.getMetadata()) &&
+               writeValue(descriptor.getStructFields()) &&
+               writeValue(descriptor.getReferenceDomainInfo());
+    }
+
+    if (const auto unitObj = value.asPtrOrNull<IUnit>(true); unitObj.assigned())
+    {
+        writeTag(ValueTag::Unit);
+        writeInt(unitObj.getId());
+        return writeValue(unitObj.getSymbol()) && writeValue(unitObj.getName()) && writeValue(unitObj.getQuantity());
+    }
+
+    if (const auto rangeObj = value.asPtrOrNull<IRange>(true); rangeObj.assigned())
+    {
+        writeTag(ValueTag::Range);
+        return writeValue(rangeObj.getLowValue()) && writeValue(rangeObj.getHighValue());
+    }
+
+    if (const auto rule = value.asPtrOrNull<IDataRule>(true); rule.assigned())
+    {
+        writeTag(ValueTag::DataRule);
+        writeInt(static_cast<Int>(rule.getType()));
+        return writeValue(rule.getParameters());
+    }
+
+    if (const auto scalingObj = value.asPtrOrNull<IScaling>(true); scalingObj.assigned())
+    {
+        writeTag(ValueTag::Scaling);
+        writeInt(static_cast<Int>(scalingObj.getInputSampleType()));
+        writeInt(static_cast<Int>(scalingObj.getOutputSampleType()));
+        writeInt(static_cast<Int>(scalingObj.getType()));
+        return writeValue(scalingObj.getParameters());
+    }
+
+    if (const auto dimensionObj = value.asPtrOrNull<IDimension>(true); dimensionObj.assigned())
+    {
+        writeTag(ValueTag::Dimension);
+        return writeValue(dimensionObj.getName()) && writeValue(dimensionObj.getUnit()) && writeValue(dimensionObj.getRule());
+    }
+
+    if (const auto rule = value.asPtrOrNull<IDimensionRule>(true); rule.assigned())
+    {
+        writeTag(ValueTag::DimensionRule);
+        writeInt(static_cast<Int>(rule.getType()));
+        return writeValue(rule.getParameters());
+    }
+
+    if (const auto info = value.asPtrOrNull<IReferenceDomainInfo>(true); info.assigned())
+    {
+        writeTag(ValueTag::ReferenceDomainInfo);
+        writeInt(static_cast<Int>(info.getReferenceTimeProtocol()));
+        writeInt(static_cast<Int>(info.getUsesOffset()));
+        return writeValue(info.getReferenceDomainId()) && writeValue(info.getReferenceDomainOffset());
+    }
+
+    return false;
+}
+
+class Reader
+{
+public:
+    Reader(const uint8_t* data, size_t size)
+        : current(data)
+        , end(data + size)
+    {
+    }
+
+    uint8_t readByte()
+    {
+        if (current == end)
+            throwMalformed();
+        return *current++;
+    }
+
+    uint64_t readUInt()
+    {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+            const uint8_t byte = readByte();
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return value;
+        }
+        throwMalformed();
+    }
+
+    int64_t readInt()
+    {
+        const uint64_t value = readUInt();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    double readFloat()
+    {
+        double value;
+        readRaw(&value, sizeof(value));
+        return value;
+    }
+
+    StringPtr readString()
+    {
+        const auto length = readSize();
+        const auto chars = reinterpret_cast<ConstCharPtr>(current);
+        current += length;
+        return String(chars, length);
+    }
+
+    IntfID readIntfId()
+    {
+        IntfID id = IUnknown::Id;
+        if (readByte())
+            readRaw(&id, sizeof(IntfID));
+        return id;
+    }
+
+    BaseObjectPtr readValue();
+
+    bool atEnd() const
+    {
+        return current == end;
+    }
+
+    [[noreturn]] static void throwMalformed()
+    {
+        throw PacketStreamingException("Malformed binary event packet payload");
+    }
+
+private:
+    const uint8_t* current;
+    const uint8_t* end;
+
+    size_t readSize()
+    {
+        const auto size = readUInt();
+        if (size > static_cast<uint64_t>(end - current))
+            throwMalformed();
+        return static_cast<size_t>(size);
+    }
+
+    void readRaw(void* data, size_t size)
+    {
+        if (size > static_cast<size_t>(end - current))
+            throwMalformed();
+        std::memcpy(data, current, size);
+        current += size;
+    }
+
+    BaseObjectPtr readList();
+    BaseObjectPtr readDict();
+    DataDescriptorPtr readDataDescriptor();
+    UnitPtr readUnit();
+    ReferenceDomainInfoPtr readReferenceDomainInfo();
+};
+
+BaseObjectPtr Reader::readValue()
+{
+    switch (static_cast<ValueTag>(readByte()))
+    {
+        case ValueTag::Null:
+            return nullptr;
+        case ValueTag::False:
+            return Boolean(false);
+        case ValueTag::True:
+            return Boolean(true);
+        case ValueTag::Integer:
+            return Integer(readInt());
+        case ValueTag::Float:
+            return Floating(readFloat());
+        case ValueTag::String:
+            return readString();
+        case ValueTag::Ratio:
+        {
+            const auto numerator = readInt();
+            const auto denominator = readInt();
+            return Ratio(numerator, denominator);
+        }
+        case ValueTag::List:
+            return readList();
+        case ValueTag::Dict:
+            return readDict();
+        case ValueTag::DataDescriptor:
+            return readDataDescriptor();
+        case ValueTag::Unit:
+            return readUnit();
+        case ValueTag::Range:
+        {
+            const NumberPtr low = readValue();
+            const NumberPtr high = readValue();
+            return Range(low, high);
+        }
+        case ValueTag::DataRule:
+        {
+            const auto type = static_cast<DataRuleType>(readInt());
+            const DictPtr<IString, IBaseObject> parameters = readValue();
+            return DataRule(type, parameters);
+        }
+        case ValueTag::Scaling:
+        {
+            const auto inputType = static_cast<SampleType>(readInt());
+            const auto outputType = static_cast<ScaledSampleType>(readInt());
+            const auto type = static_cast<ScalingType>(readInt());
+            const DictPtr<IString, IBaseObject> parameters = readValue();
+            return Scaling(inputType, outputType, type, parameters);
+        }
+        case ValueTag::Dimension:
+        {
+            const StringPtr name = readValue();
+            const UnitPtr dimensionUnit = readValue();
+            const DimensionRulePtr rule = readValue();
+            return Dimension(rule, dimensionUnit, name);
+        }
+        case ValueTag::DimensionRule:
+        {
+            const auto type = static_cast<DimensionRuleType>(readInt());
+            const DictPtr<IString, IBaseObject> parameters = readValue();
+            return DimensionRule(type, parameters);
+        }
+        case ValueTag::ReferenceDomainInfo:
+            return readReferenceDomainInfo();
+        default:
+            throwMalformed();
+    }
+}
+
+BaseObjectPtr Reader::readList()
+{
+    ListPtr<IBaseObject> list(ListWithElementType_Create(readIntfId()));
+
+    const auto count = readSize();
+    for (size_t i = 0; i < count; ++i)
+        list.pushBack(readValue());
+    return list;
+}
+
+BaseObjectPtr Reader::readDict()
+{
+    const auto keyId = readIntfId();
+    const auto valueId = readIntfId();
+
+    DictPtr<IBaseObject, IBaseObject> dict(DictWithExpectedTypes_Create(keyId, valueId));
+
+    const auto count = readSize();
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto key = readValue();
+        dict.set(key, readValue());
+    }
+    return dict;
+}
+
+DataDescriptorPtr Reader::readDataDescriptor()
+{
+    const auto builder = DataDescriptorBuilder().setSampleType(static_cast<SampleType>(readInt()));
+
+    if (const StringPtr name = readValue(); name.assigned())
+        builder.setName(name);
+    if (const UnitPtr descriptorUnit = readValue(); descriptorUnit.assigned())
+        builder.setUnit(descriptorUnit);
+    if (const ListPtr<IDimension> dimensions = readValue(); dimensions.assigned())
+        builder.setDimensions(dimensions);
+    if (const RangePtr valueRange = readValue(); valueRange.assigned())
+        builder.setValueRange(valueRange);
+    if (const DataRulePtr rule = readValue(); rule.assigned())
+        builder.setRule(rule);
+    if (const ScalingPtr postScaling = readValue(); postScaling.assigned())
+        builder.setPostScaling(postScaling);
+    if (const StringPtr origin = readValue(); origin.assigned())
+        builder.setOrigin(origin);
+    if (const RatioPtr tickResolution = readValue(); tickResolution.assigned())
+        builder.setTickResolution(tickResolution);
+    if (const DictPtr<IString, IString> metadata = readValue(); metadata.assigned())
+        builder.setMetadata(metadata);
+    if (const ListPtr<IDataDescriptor> structFields = readValue(); structFields.assigned())
+        builder.setStructFields(structFields);
+    if (const ReferenceDomainInfoPtr info = readValue(); info.assigned())
+        builder.setReferenceDomainInfo(info);
+
+    return builder.build();
+}
+
+UnitPtr Reader::readUnit()
+{
+    const auto id = readInt();
+    const StringPtr symbol = readValue();
+    const StringPtr name = readValue();
+    const StringPtr quantity = readValue();
+
+    return UnitBuilder().setId(id).setSymbol(symbol).setName(name).setQuantity(quantity).build();
+}
+
+ReferenceDomainInfoPtr Reader::readReferenceDomainInfo()
+{
+    const auto timeProtocol = static_cast<TimeProtocol>(readInt());
+    const auto usesOffset = static_cast<UsesOffset>(readInt());
+    const StringPtr referenceDomainId = readValue();
+    const IntegerPtr referenceDomainOffset = readValue();
+
+    return ReferenceDomainInfoBuilder()
+        .setReferenceDomainId(referenceDomainId)
+        .setReferenceDomainOffset(referenceDomainOffset)
+        .setReferenceTimeProtocol(timeProtocol)
+        .setUsesOffset(usesOffset)
+        .build();
+}
+
+}
+
+bool BinaryEventPacketEncoder::encode(const EventPacketPtr& packet, std::vector<uint8_t>& output)
+{
+    output.clear();
+
+    Writer writer(output);
+    writer.writeString(packet.getEventId());
+    return writer.writeValue(packet.getParameters());
+}
+
+EventPacketPtr BinaryEventPacketDecoder::decode(const void* payload, size_t payloadSize)
+{
+    Reader reader(static_cast<const uint8_t*>(payload), payloadSize);
+
+    const auto eventId = reader.readString();
+    const DictPtr<IString, IBaseObject> parameters = reader.readValue();
+    if (!reader.atEnd())
+        Reader::throwMalformed();
+
+    return EventPacket(eventId, parameters);
+}
+
+}
@@ -0,0 +1,116 @@
+#include <packet_streaming/packet_buffer_pool.h>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+namespace daq::packet_streaming
+{
+
+static constexpr size_t InvalidSizeClassIndex = std::numeric_limits<size_t>::max();
+
+PacketBufferMemoryPool::PacketBufferMemoryPool()
+{
+    for (auto& sizeClass : sizeClasses)
+        sizeClass.freeBlocks = daqLockFreeStackCreate(MaxFreeBlocksPerClass);
+}
+
+PacketBufferMemoryPool::~PacketBufferMemoryPool()
+{
+    for (auto& sizeClass : sizeClasses)
+    {
+        while (void* block = daqLockFreeStackPop(sizeClass.freeBlocks))
+            std::free(block);
+        daqLockFreeStackDestroy(sizeClass.freeBlocks);
+    }
+}
+
+PacketBufferMemoryPool& PacketBufferMemoryPool::Instance()
+{
+    static auto* const pool = new PacketBufferMemoryPool();
+    return *pool;
+}
+
+size_t PacketBufferMemoryPool::getSizeClassIndex(size_t size)
+{
+    if (size > (size_t(1) << MaxBlockSizeShift))
+        return InvalidSizeClassIndex;
+
+    size_t shift = MinBlockSizeShift;
+    while ((size_t(1) << shift) < size)
+        ++shift;
+    return shift - MinBlockSizeShift;
+}
+
+void* PacketBufferMemoryPool::allocate(size_t size)
+{
+    const auto index = getSizeClassIndex(size);
+    if (index == InvalidSizeClassIndex)
+    {
+        void* block = std::malloc(size);
+        if (!block)
+            throw std::bad_alloc();
+        return block;
+    }
+
+    auto& sizeClass = sizeClasses[index];
+    if (void* block = daqLockFreeStackPop(sizeClass.freeBlocks))
+    {
+        sizeClass.freeBlockCount.fetch_sub(1, std::memory_order_relaxed);
+        return block;
+    }
+
+    void* block = std::malloc(size_t(1) << (index + MinBlockSizeShift));
+    if (!block)
+        throw std::bad_alloc();
+    return block;
+}
+
+void PacketBufferMemoryPool::deallocate(void* block, size_t size)
+{
+    const auto index = getSizeClassIndex(size);
+    if (index == InvalidSizeClassIndex)
+    {
+        std::free(block);
+        return;
+    }
+
+    // keep the memory held by idle blocks bounded after bursts
+    auto& sizeClass = sizeClasses[index];
+    if (sizeClass.freeBlockCount.fetch_add(1, std::memory_order_relaxed) >= MaxFreeBlocksPerClass)
+    {
+        sizeClass.freeBlockCount.fetch_sub(1, std::memory_order_relaxed);
+        std::free(block);
+        return;
+    }
+
+    daqLockFreeStackPush(sizeClass.freeBlocks, block);
+}
+
+size_t PacketBufferMemoryPool::getFreeBlockCount(size_t size) const
+{
+    const auto index = getSizeClassIndex(size);
+    if (index == InvalidSizeClassIndex)
+        return 0;
+    return sizeClasses[index].freeBlockCount.load(std::memory_order_relaxed);
+}
+
+PacketBufferPtr createPooledPacketBuffer(size_t headerSize, size_t payloadSize)
+{
+    constexpr size_t payloadAlignment = alignof(std::max_align_t);
+    const size_t payloadOffset = (headerSize + payloadAlignment - 1) / payloadAlignment * payloadAlignment;
+    const size_t blockSize = payloadOffset + payloadSize;
+
+    auto block = static_cast<uint8_t*>(PacketBufferMemoryPool::Instance().allocate(blockSize));
+
+    // captures only trivially copyable values, so the callback does not allocate
+    return std::make_shared<PacketBuffer>(reinterpret_cast<GenericPacketHeader*>(block),
+                                          payloadSize > 0 ? block + payloadOffset : nullptr,
+                                          [block, blockSize]()
+                                          {
+                                              PacketBufferMemoryPool::Instance().deallocate(block, blockSize);
+                                          },
+                                          false);
+}
+
+}
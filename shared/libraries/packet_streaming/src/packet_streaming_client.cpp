@@ -5,11 +5,51 @@
 #include <opendaq/binary_data_packet_factory.h>
 #include <opendaq/deleter_factory.h>
 #include <opendaq/data_descriptor_factory.h>
+#include <coretypes/intfs.h>
+#include <coretypes/pooled_object.h>
 #include <algorithm>
 
 namespace daq::packet_streaming
 {
 
+namespace
+{
+
+// Keeps the received packet buffer alive while the data packet wrapping its payload exists.
+// Instances are recycled through a pool instead of allocating a callback deleter for every received packet.
+class PooledPacketBufferDeleterImpl : public object_pool::PooledObject<PooledPacketBufferDeleterImpl, ImplementationOf<IDeleter>>
+{
+public:
+    using object_pool::PooledObject<PooledPacketBufferDeleterImpl, ImplementationOf<IDeleter>>::PooledObject;
+
+    void reset(PacketBufferPtr packetBuffer)
+    {
+        this->packetBuffer = std::move(packetBuffer);
+        this->markLive();
+    }
+
+    ErrCode INTERFACE_FUNC deleteMemory(void* /*address*/) override
+    {
+        packetBuffer.reset();
+        return OPENDAQ_SUCCESS;
+    }
+
+private:
+    PacketBufferPtr packetBuffer;
+};
+
+DeleterPtr createPacketBufferDeleter(PacketBufferPtr packetBuffer)
+{
+    // deleters may outlive any client, so the pool is never destroyed
+    static auto* const deleterPool = new object_pool::ObjectPool<PooledPacketBufferDeleterImpl>(64);
+
+    IDeleter* deleter = deleterPool->get(std::move(packetBuffer));
+    deleter->addRef();
+    return DeleterPtr(std::move(deleter));
+}
+
+}
+
 PacketStreamingClient::PacketStreamingClient()
     : jsonDeserializer(JsonDeserializer())
 {
@@ -54,9 +94,20 @@ void PacketStreamingClient::addEventPacketBuffer(const PacketBufferPtr& packetBu
     bool forwardPacket = false;
     auto signalId = packetBuffer->packetHeader->signalId;
 
-    const auto eventPayloadString = String((ConstCharPtr) packetBuffer->payload);
+    EventPacketPtr packet;
+    if (packetBuffer->packetHeader->flags & PACKET_FLAG_BINARY_EVENT_PAYLOAD)
+    {
+        if (packetBuffer->packetHeader->version > EVENT_ENCODING_VERSION_LATEST)
+            throw PacketStreamingException(
+                fmt::format("Unsupported event packet encoding version {}", packetBuffer->packetHeader->version));
 
-    EventPacketPtr packet = jsonDeserializer.deserialize(eventPayloadString);
+        packet = binaryEventDecoder.decode(packetBuffer->payload, packetBuffer->packetHeader->payloadSize);
+    }
+    else
+    {
+        const auto eventPayloadString = String((ConstCharPtr) packetBuffer->payload);
+        packet = jsonDeserializer.deserialize(eventPayloadString);
+    }
 
     if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
     {
@@ -96,21 +147,19 @@ DataPacketPtr PacketStreamingClient::addDataPacketBuffer(const PacketBufferPtr&
     if (!domPacket.assigned() && domainPacketId >= 0)
     {
         // check if domain packet already arrived
-        const auto domainPacketIt = referencedPackets.find(domainPacketId);
-        if (domainPacketIt != referencedPackets.end())
+        if (const auto domainPacketIt = referencedPackets.find(domainPacketId))
         {
             // domain packet arrived before this packet, should be in the referenced packets
-            domPacket = domainPacketIt->second;
+            domPacket = *domainPacketIt;
         }
         else
         {
             // domain packet did not arrive yet, do not process this packet now, will do it later when the domain packet arrives
-            const auto it = packetBuffersWaitingForDomainPackets.find(domainPacketId);
-            if (it == packetBuffersWaitingForDomainPackets.end())
-                packetBuffersWaitingForDomainPackets.insert({domainPacketId, {packetBuffer}});
+            if (const auto waitingIt = packetBuffersWaitingForDomainPackets.find(domainPacketId))
+                waitingIt->push_back(packetBuffer);
             else
-                it->second.push_back(packetBuffer);
-            referencedPacketBuffers.insert({dataPacketHeader->packetId, packetBuffer});
+                packetBuffersWaitingForDomainPackets.insert(domainPacketId, {packetBuffer});
+            referencedPacketBuffers.insert(dataPacketHeader->packetId, packetBuffer);
             return nullptr;
         }
     }
@@ -153,7 +202,7 @@ DataPacketPtr PacketStreamingClient::addDataPacketBuffer(const PacketBufferPtr&
                                                        valueDescriptor,
                                                        dataPacketHeader->genericHeader.payloadSize, // Binary packets rely on payload size rather than sample count
                                                        const_cast<void*>(packetBuffer->payload),
-                                                       Deleter([packetBuffer = packetBuffer](void*) mutable { packetBuffer.reset(); }));
+                                                       createPacketBufferDeleter(packetBuffer));
         }
         else
         {
@@ -161,7 +210,7 @@ DataPacketPtr PacketStreamingClient::addDataPacketBuffer(const PacketBufferPtr&
                                                  valueDescriptor,
                                                  dataPacketHeader->sampleCount,
                                                  const_cast<void*>(packetBuffer->payload),
-                                                 Deleter([packetBuffer = packetBuffer](void*) mutable { packetBuffer.reset(); }),
+                                                 createPacketBufferDeleter(packetBuffer),
                                                  offset,
                                                  dataPacketHeader->genericHeader.payloadSize);
         }
@@ -170,11 +219,14 @@ DataPacketPtr PacketStreamingClient::addDataPacketBuffer(const PacketBufferPtr&
     queue.push({signalId, packet});
 
     // check if this is domain packet that other value packets have been waiting for
-    const auto packetsWaitingIt = packetBuffersWaitingForDomainPackets.find(dataPacketHeader->packetId);
-    if (packetsWaitingIt != packetBuffersWaitingForDomainPackets.end())
+    if (const auto packetsWaitingIt = packetBuffersWaitingForDomainPackets.find(dataPacketHeader->packetId))
     {
+        // take the waiting packet buffers out first, processing them modifies the map
+        const auto packetBuffersWaiting = std::move(*packetsWaitingIt);
+        packetBuffersWaitingForDomainPackets.erase(dataPacketHeader->packetId);
+
         // iterate through all the packet buffers that are waiting for this domain packet and process those value packets
-        for (const auto& pktBuffer : packetsWaitingIt->second)
+        for (const auto& pktBuffer : packetBuffersWaiting)
         {
             const auto pktHeader = reinterpret_cast<DataPacketHeader*>(pktBuffer->packetHeader);
             referencedPacketBuffers.erase(pktHeader->packetId);
@@ -183,13 +235,12 @@ DataPacketPtr PacketStreamingClient::addDataPacketBuffer(const PacketBufferPtr&
             for (const auto sigId: pktBuffer->additionalSignalIds)
                 queue.push({sigId, dataPacket});
         }
-        packetBuffersWaitingForDomainPackets.erase(packetsWaitingIt);
     }
 
     // if the domain packet arrives first or this is shared domain packet, it should have the CAN_RELEASE flag OFF,
     // so keep it in the referenced packets list
     if (!(dataPacketHeader->genericHeader.flags & PACKET_FLAG_CAN_RELEASE))
-        referencedPackets.insert({dataPacketHeader->packetId, packet});
+        referencedPackets.insert(dataPacketHeader->packetId, packet);
 
     return packet;
 }
@@ -203,15 +254,11 @@ void PacketStreamingClient::addReleasePacketBuffer(const PacketBufferPtr& packet
     {
         const auto packetId = *packetIds++;
 
-        const auto packetIt = referencedPackets.find(packetId);
-        if (packetIt != referencedPackets.end())
-            referencedPackets.erase(packetIt);
-        else
+        if (!referencedPackets.erase(packetId))
         {
-            const auto packetBufferIt = referencedPacketBuffers.find(packetId);
-            if (packetBufferIt != referencedPacketBuffers.end())
+            if (const auto packetBufferIt = referencedPacketBuffers.find(packetId))
             {
-                const auto dataPacketHeader = reinterpret_cast<DataPacketHeader*>(packetBufferIt->second->packetHeader);
+                const auto dataPacketHeader = reinterpret_cast<DataPacketHeader*>((*packetBufferIt)->packetHeader);
                 dataPacketHeader->genericHeader.flags += PACKET_FLAG_CAN_RELEASE;
             }
             else
@@ -234,19 +281,19 @@ void PacketStreamingClient::addAlreadySentPacketBuffer(const PacketBufferPtr& pa
         throw PacketStreamingException("Descriptor not registered");
 
     const auto packetIt = referencedPackets.find(packetId);
-    if (packetIt == referencedPackets.end())
+    if (!packetIt)
     {
         const auto packetBuffersIt = packetBuffersWaitingForDomainPackets.find(domainPacketId);
-        if (packetBuffersIt == packetBuffersWaitingForDomainPackets.end())
+        if (!packetBuffersIt)
             throw PacketStreamingException("Packet not found");
 
-        const auto packetBufferIt = std::find_if(packetBuffersIt->second.begin(),
-                                        packetBuffersIt->second.end(),
+        const auto packetBufferIt = std::find_if(packetBuffersIt->begin(),
+                                        packetBuffersIt->end(),
                                         [packetId](const PacketBufferPtr& packetBuffer) {
                                             const auto otherPacketId = reinterpret_cast<DataPacketHeader*>(packetBuffer->packetHeader)->packetId;
                                             return (packetId == otherPacketId);
                                         });
-        if (packetBufferIt == packetBuffersIt->second.end())
+        if (packetBufferIt == packetBuffersIt->end())
             throw PacketStreamingException("Packet not found");
 
         const auto& packetPtr = *packetBufferIt;
@@ -254,10 +301,10 @@ void PacketStreamingClient::addAlreadySentPacketBuffer(const PacketBufferPtr& pa
         return;
     }
 
-    queue.push({signalId, packetIt->second});
+    queue.push({signalId, *packetIt});
 
     if (alreadySentPacketHeader->genericHeader.flags & PACKET_FLAG_CAN_RELEASE)
-        referencedPackets.erase(packetIt);
+        referencedPackets.erase(packetId);
 }
 
 }
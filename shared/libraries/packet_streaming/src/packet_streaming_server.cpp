@@ -5,6 +5,7 @@
 #include <opendaq/data_descriptor_factory.h>
 #include "opendaq/context_factory.h"
 #include "opendaq/custom_log.h"
+#include <algorithm>
 
 namespace daq::packet_streaming
 {
@@ -12,8 +13,10 @@ namespace daq::packet_streaming
 PacketStreamingServer::PacketStreamingServer(size_t cacheablePacketPayloadSizeMax,
                                              size_t releaseThreshold,
                                              bool attachTimestampToPacketBuffer,
-                                             Int jsonSerializerVersion)
+                                             Int jsonSerializerVersion,
+                                             uint8_t eventEncodingVersion)
     : jsonSerializer(jsonSerializerVersion ? JsonSerializerWithVersion(jsonSerializerVersion) : JsonSerializer())
+    , eventEncodingVersion(std::min(eventEncodingVersion, EVENT_ENCODING_VERSION_LATEST))
     , countOfNonCacheableBuffers(0)
     , currentCacheablePacketGroupId(0)
     , packetCollection(std::make_shared<PacketCollection>())
@@ -152,22 +155,47 @@ void PacketStreamingServer::addEventPacket(const uint32_t signalId, const EventP
     packetHeader->flags = 0;
     packetHeader->signalId = signalId;
 
-    jsonSerializer.reset();
-    packet.serialize(jsonSerializer);
-    auto serializedPacket = jsonSerializer.getOutput();
+    PacketBufferPtr packetBuffer;
 
-    packetHeader->payloadSize = static_cast<uint32_t>(serializedPacket.getLength() + 1);
-
-    const auto packetBuffer = std::make_shared<PacketBuffer>(
-            packetHeader,
-            reinterpret_cast<const void*>(serializedPacket.getCharPtr()),
-            [packetHeader, serializedPacket]() mutable {
-                delete packetHeader;
-                serializedPacket.release();
-            },
-            attachTimestampToPacketBuffer,
-            getPacketCacheableGroupId(packetHeader->size, packetHeader->payloadSize)
-        );
+    // events with values not covered by the binary encoding fall back to JSON
+    auto binaryPayload = std::make_unique<std::vector<uint8_t>>();
+    if (eventEncodingVersion != EVENT_ENCODING_JSON && binaryEventEncoder.encode(packet, *binaryPayload))
+    {
+        packetHeader->version = eventEncodingVersion;
+        packetHeader->flags = PACKET_FLAG_BINARY_EVENT_PAYLOAD;
+        packetHeader->payloadSize = static_cast<uint32_t>(binaryPayload->size());
+
+        const auto payload = binaryPayload.release();
+        packetBuffer = std::make_shared<PacketBuffer>(
+                packetHeader,
+                reinterpret_cast<const void*>(payload->data()),
+                [packetHeader, payload]() {
+                    delete packetHeader;
+                    delete payload;
+                },
+                attachTimestampToPacketBuffer,
+                getPacketCacheableGroupId(packetHeader->size, packetHeader->payloadSize)
+            );
+    }
+    else
+    {
+        jsonSerializer.reset();
+        packet.serialize(jsonSerializer);
+        auto serializedPacket = jsonSerializer.getOutput();
+
+        packetHeader->payloadSize = static_cast<uint32_t>(serializedPacket.getLength() + 1);
+
+        packetBuffer = std::make_shared<PacketBuffer>(
+                packetHeader,
+                reinterpret_cast<const void*>(serializedPacket.getCharPtr()),
+                [packetHeader, serializedPacket]() mutable {
+                    delete packetHeader;
+                    serializedPacket.release();
+                },
+                attachTimestampToPacketBuffer,
+                getPacketCacheableGroupId(packetHeader->size, packetHeader->payloadSize)
+            );
+    }
 
     if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
     {
@@ -1,34 +1,17 @@
 #include "packet_transmission.h"
+#include <packet_streaming/packet_buffer_pool.h>
 
 namespace daq::packet_streaming
 {
 
 void PacketTransmission::sendPacketBuffer(const PacketBufferPtr& packetBuffer)
 {
-    GenericPacketHeader* recvPacketHeader {};
-    recvPacketHeader = static_cast<GenericPacketHeader*>(std::malloc(packetBuffer->packetHeader->size));
-    std::memcpy(recvPacketHeader, packetBuffer->packetHeader, packetBuffer->packetHeader->size);
-
-    void* recvPayload;
+    // received packet buffers are allocated the same way as on the native streaming receive path
+    auto recvPacketBuffer = createPooledPacketBuffer(packetBuffer->packetHeader->size, packetBuffer->packetHeader->payloadSize);
 
+    std::memcpy(recvPacketBuffer->packetHeader, packetBuffer->packetHeader, packetBuffer->packetHeader->size);
     if (packetBuffer->packetHeader->payloadSize > 0)
-    {
-        recvPayload = std::malloc(packetBuffer->packetHeader->payloadSize);
-        std::memcpy(recvPayload, packetBuffer->payload, packetBuffer->packetHeader->payloadSize);
-    }
-    else
-        recvPayload = nullptr;
-
-    auto recvPacketBuffer = std::make_shared<PacketBuffer>(
-        recvPacketHeader,
-        recvPayload,
-        [recvPacketHeader, recvPayload]() {
-        std::free(recvPacketHeader);
-        if (recvPayload != nullptr)
-          std::free(recvPayload);
-        },
-        false
-    );
+        std::memcpy(const_cast<void*>(recvPacketBuffer->payload), packetBuffer->payload, packetBuffer->packetHeader->payloadSize);
 
     queue.push(recvPacketBuffer);
 }
@@ -7,6 +7,15 @@
 #include <opendaq/data_rule_factory.h>
 #include <opendaq/packet_destruct_callback_factory.h>
 #include <opendaq/sample_type_traits.h>
+#include <opendaq/dimension_factory.h>
+#include <opendaq/dimension_rule_factory.h>
+#include <opendaq/range_factory.h>
+#include <opendaq/reference_domain_info_factory.h>
+#include <opendaq/scaling_factory.h>
+#include <opendaq/event_packet_params.h>
+#include <coreobjects/unit_factory.h>
+#include <coretypes/complex_number_factory.h>
+#include <packet_streaming/packet_buffer_pool.h>
 #include "packet_transmission.h"
 
 using namespace daq;
@@ -141,6 +150,103 @@ TEST_F(PacketStreamingTest, DataDescNullEventPacket)
     ASSERT_TRUE(client.areReferencesCleared());
 }
 
+TEST_F(PacketStreamingTest, BinaryEncodedDataDescChangedEventPacket)
+{
+    PacketStreamingServer binaryServer {PACKET_ZERO_PAYLOAD_SIZE, PACKET_RELEASE_THRESHOLD_DEFAULT, false, 0, EVENT_ENCODING_VERSION_LATEST};
+
+    auto dimensions = List<IDimension>();
+    dimensions.pushBack(Dimension(LinearDimensionRule(10, 10, 10), Unit("Hz"), "Frequency"));
+
+    auto metadata = Dict<IString, IString>();
+    metadata["key"] = "value";
+
+    const auto valueDescriptor = DataDescriptorBuilder()
+                                     .setName("Value")
+                                     .setSampleType(SampleType::Float64)
+                                     .setUnit(Unit("V", 5, "volt", "voltage"))
+                                     .setValueRange(Range(-10, 10.5))
+                                     .setDimensions(dimensions)
+                                     .setPostScaling(LinearScaling(2, -1, SampleType::Int16, ScaledSampleType::Float64))
+                                     .setMetadata(metadata)
+                                     .build();
+    const auto domainDescriptor = DataDescriptorBuilder()
+                                      .setSampleType(SampleType::Int64)
+                                      .setRule(LinearDataRule(1, 0))
+                                      .setOrigin("1970-01-01T00:00:00Z")
+                                      .setTickResolution(Ratio(1, 1000000))
+                                      .setReferenceDomainInfo(ReferenceDomainInfoBuilder()
+                                                                  .setReferenceDomainId("Domain")
+                                                                  .setReferenceDomainOffset(-53)
+                                                                  .setReferenceTimeProtocol(TimeProtocol::Tai)
+                                                                  .setUsesOffset(UsesOffset::True)
+                                                                  .build())
+                                      .build();
+    const auto serverEventPacket = DataDescriptorChangedEventPacket(valueDescriptor, domainDescriptor);
+
+    binaryServer.addDaqPacket(1, serverEventPacket);
+    const auto serverPacketBuffer = binaryServer.getNextPacketBuffer();
+    ASSERT_TRUE(serverPacketBuffer->packetHeader->flags & PACKET_FLAG_BINARY_EVENT_PAYLOAD);
+    ASSERT_EQ(serverPacketBuffer->packetHeader->version, EVENT_ENCODING_BINARY_V1);
+
+    transmission.sendPacketBuffer(serverPacketBuffer);
+    client.addPacketBuffer(transmission.recvPacketBuffer());
+    auto [signalId, clientEventPacket] = client.getNextDaqPacket();
+
+    ASSERT_EQ(signalId, 1u);
+    ASSERT_EQ(serverEventPacket, clientEventPacket);
+
+    const DataDescriptorPtr clientDomainDescriptor = clientEventPacket.asPtr<IEventPacket>().getParameters()[event_packet_param::DOMAIN_DATA_DESCRIPTOR];
+    ASSERT_EQ(clientDomainDescriptor.getTickResolution(), Ratio(1, 1000000));
+    ASSERT_EQ(clientDomainDescriptor.getReferenceDomainInfo().getReferenceDomainOffset(), -53);
+
+    ASSERT_TRUE(client.areReferencesCleared());
+}
+
+TEST_F(PacketStreamingTest, BinaryEncodedDataDescUnchangedEventPacket)
+{
+    PacketStreamingServer binaryServer {PACKET_ZERO_PAYLOAD_SIZE, PACKET_RELEASE_THRESHOLD_DEFAULT, false, 0, EVENT_ENCODING_VERSION_LATEST};
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    const auto firstEventPacket = DataDescriptorChangedEventPacket(valueDescriptor, NullDataDescriptor());
+    const auto secondEventPacket = DataDescriptorChangedEventPacket(NullDataDescriptor(), nullptr);
+
+    binaryServer.addDaqPacket(1, firstEventPacket);
+    binaryServer.addDaqPacket(1, secondEventPacket);
+    while (const auto serverPacketBuffer = binaryServer.getNextPacketBuffer())
+    {
+        transmission.sendPacketBuffer(serverPacketBuffer);
+        client.addPacketBuffer(transmission.recvPacketBuffer());
+    }
+
+    auto [firstSignalId, firstClientEventPacket] = client.getNextDaqPacket();
+    ASSERT_EQ(firstSignalId, 1u);
+    ASSERT_EQ(firstEventPacket, firstClientEventPacket);
+
+    auto [secondSignalId, secondClientEventPacket] = client.getNextDaqPacket();
+    ASSERT_EQ(secondSignalId, 1u);
+    ASSERT_EQ(secondEventPacket, secondClientEventPacket);
+}
+
+TEST_F(PacketStreamingTest, BinaryEncodingFallbackToJson)
+{
+    PacketStreamingServer binaryServer {PACKET_ZERO_PAYLOAD_SIZE, PACKET_RELEASE_THRESHOLD_DEFAULT, false, 0, EVENT_ENCODING_VERSION_LATEST};
+
+    auto gapEventPacket = ImplicitDomainGapDetectedEventPacket(Integer(10));
+    auto customEventPacket = EventPacket("Custom", Dict<IString, IBaseObject>({{"Value", ComplexNumber(1.0, 2.0)}}));
+
+    binaryServer.addDaqPacket(1, gapEventPacket);
+    binaryServer.addDaqPacket(1, customEventPacket);
+
+    const auto gapPacketBuffer = binaryServer.getNextPacketBuffer();
+    ASSERT_TRUE(gapPacketBuffer->packetHeader->flags & PACKET_FLAG_BINARY_EVENT_PAYLOAD);
+    const auto customPacketBuffer = binaryServer.getNextPacketBuffer();
+    ASSERT_FALSE(customPacketBuffer->packetHeader->flags & PACKET_FLAG_BINARY_EVENT_PAYLOAD);
+
+    BinaryEventPacketDecoder decoder;
+    ASSERT_EQ(decoder.decode(gapPacketBuffer->payload, gapPacketBuffer->packetHeader->payloadSize), gapEventPacket);
+    ASSERT_THROW(decoder.decode(gapPacketBuffer->payload, gapPacketBuffer->packetHeader->payloadSize - 1), PacketStreamingException);
+}
+
 TEST_F(PacketStreamingTest, DataPacket)
 {
     const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
@@ -1146,3 +1252,56 @@ TEST_F(PacketStreamingTest, CacheablePacketsAny)
 }
 
 INSTANTIATE_TEST_SUITE_P(MovePacket, ValuePacketDestroyedBeforeDomainSentTest, testing::Values(true, false));
+
+TEST(PacketIdMapTest, InsertFindErase)
+{
+    PacketIdMap<Int> map;
+    ASSERT_TRUE(map.empty());
+
+    for (Int id = 0; id < 10; ++id)
+        ASSERT_TRUE(map.insert(id * 2, id));
+    ASSERT_FALSE(map.insert(4, 100));
+    ASSERT_EQ(map.size(), 10u);
+
+    // out of order insert between existing ids
+    ASSERT_TRUE(map.insert(5, 50));
+    ASSERT_EQ(*map.find(5), 50);
+    ASSERT_EQ(map.find(7), nullptr);
+
+    ASSERT_TRUE(map.erase(0));
+    ASSERT_TRUE(map.erase(10));
+    ASSERT_FALSE(map.erase(10));
+    ASSERT_EQ(map.find(10), nullptr);
+    ASSERT_EQ(*map.find(2), 1);
+    ASSERT_EQ(*map.find(18), 9);
+
+    for (Int id = 1; id < 10; ++id)
+        map.erase(id * 2);
+    ASSERT_EQ(map.size(), 1u);
+    ASSERT_TRUE(map.erase(5));
+    ASSERT_TRUE(map.empty());
+
+    ASSERT_TRUE(map.insert(3, 3));
+    ASSERT_EQ(*map.find(3), 3);
+}
+
+TEST(PacketBufferMemoryPoolTest, BlocksAreRecycled)
+{
+    auto& pool = PacketBufferMemoryPool::Instance();
+    const size_t payloadSize = 3000;
+
+    auto packetBuffer = createPooledPacketBuffer(sizeof(DataPacketHeader), payloadSize);
+    ASSERT_NE(packetBuffer->payload, nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(packetBuffer->payload) % alignof(std::max_align_t), 0u);
+
+    const void* block = packetBuffer->packetHeader;
+    const auto freeBlocks = pool.getFreeBlockCount(sizeof(DataPacketHeader) + payloadSize);
+    packetBuffer.reset();
+    ASSERT_EQ(pool.getFreeBlockCount(sizeof(DataPacketHeader) + payloadSize), freeBlocks + 1);
+
+    packetBuffer = createPooledPacketBuffer(sizeof(DataPacketHeader), payloadSize);
+    ASSERT_EQ(packetBuffer->packetHeader, block);
+    ASSERT_EQ(pool.getFreeBlockCount(sizeof(DataPacketHeader) + payloadSize), freeBlocks);
+
+    ASSERT_EQ(createPooledPacketBuffer(sizeof(GenericPacketHeader), 0)->payload, nullptr);
+}
@@ -0,0 +1,106 @@
+#include <opendaq/opendaq.h>
+#include <opendaq/malloc_allocator_factory.h>
+#ifdef OPENDAQ_MIMALLOC_SUPPORT
+#include <opendaq/mimalloc_allocator_factory.h>
+#endif
+#include <benchmark/benchmark.h>
+#include <array>
+
+using namespace daq;
+
+namespace
+{
+
+constexpr size_t BlocksPerIteration = 64;
+
+AllocatorPtr createAllocator(int64_t kind)
+{
+    switch (kind)
+    {
+        case 1:
+            return PoolAllocator();
+#ifdef OPENDAQ_MIMALLOC_SUPPORT
+        case 2:
+            return MiMallocAllocator();
+#endif
+        default:
+            return MallocAllocator();
+    }
+}
+
+const char* getAllocatorName(int64_t kind)
+{
+    switch (kind)
+    {
+        case 1:
+            return "pool";
+        case 2:
+            return "mimalloc";
+        default:
+            return "malloc";
+    }
+}
+
+void applyAllocatorArgs(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"allocator", "bytes"});
+#ifdef OPENDAQ_MIMALLOC_SUPPORT
+    constexpr int64_t allocatorCount = 3;
+#else
+    constexpr int64_t allocatorCount = 2;
+#endif
+    for (int64_t kind = 0; kind < allocatorCount; ++kind)
+        for (int64_t bytes : {64, 4096, 65536, 1 << 20})
+            benchmark->Args({kind, bytes});
+}
+
+}
+
+// Allocates and releases a batch of equally sized blocks, as a packet stream with a steady packet size does.
+static void BM_AllocateFree(benchmark::State& state)
+{
+    static AllocatorPtr allocator;
+    if (state.thread_index() == 0)
+        allocator = createAllocator(state.range(0));
+    state.SetLabel(getAllocatorName(state.range(0)));
+
+    const auto bytes = static_cast<SizeT>(state.range(1));
+    std::array<void*, BlocksPerIteration> blocks{};
+
+    for (auto _ : state)
+    {
+        for (auto& block : blocks)
+            block = allocator.allocate(nullptr, bytes, 8);
+        benchmark::DoNotOptimize(blocks.data());
+        for (auto block : blocks)
+            allocator.free(block);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * BlocksPerIteration));
+
+    if (state.thread_index() == 0)
+        allocator.release();
+}
+BENCHMARK(BM_AllocateFree)->Apply(applyAllocatorArgs)->ThreadRange(1, 4)->UseRealTime();
+
+// Creates and destroys data packets, including the scaled data buffer filled on the first access.
+static void BM_DataPacketLifetime(benchmark::State& state)
+{
+    const auto allocator = createAllocator(state.range(0));
+    state.SetLabel(getAllocatorName(state.range(0)));
+
+    const auto sampleCount = static_cast<uint64_t>(state.range(1)) / sizeof(int32_t);
+    const auto descriptor = DataDescriptorBuilder()
+                                .setSampleType(SampleType::Float64)
+                                .setPostScaling(LinearScaling(2, 1, SampleType::Int32, ScaledSampleType::Float64))
+                                .build();
+
+    for (auto _ : state)
+    {
+        const auto packet = DataPacketWithAllocator(nullptr, descriptor, sampleCount, allocator);
+        benchmark::DoNotOptimize(packet.getData());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_DataPacketLifetime)->Apply(applyAllocatorArgs);
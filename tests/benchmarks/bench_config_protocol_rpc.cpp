@@ -0,0 +1,173 @@
+#include <opendaq/opendaq.h>
+#include <config_protocol/config_protocol_server.h>
+#include <config_protocol/config_protocol_client.h>
+#include <config_protocol/config_client_device_impl.h>
+#include <benchmark/benchmark.h>
+#include <latency_loopback.h>
+
+using namespace daq;
+using namespace daq::config_protocol;
+
+namespace
+{
+
+constexpr SizeT PropertyCount = 64;
+
+struct RpcFixture
+{
+    explicit RpcFixture(std::chrono::microseconds latency)
+        : serverDevice(createServerDevice())
+        , server(serverDevice,
+                 [](const PacketBuffer&) {},
+                 User("", ""),
+                 ClientType::Control,
+                 Folder<ISignal>(serverDevice.getContext(), nullptr, "ext"))
+        , loopback(server, latency)
+        , client(NullContext(),
+                 [this](const PacketBuffer& requestPacket) { return loopback.sendRequest(requestPacket).get(); },
+                 [this](const PacketBuffer& requestPacket) { server.processNoReplyRequest(requestPacket); },
+                 nullptr,
+                 nullptr,
+                 nullptr,
+                 nullptr,
+                 [this](const PacketBuffer& requestPacket) { return loopback.sendRequest(requestPacket); })
+    {
+        clientDevice = client.connect();
+        clientComm = client.getClientComm();
+    }
+
+    static DevicePtr createServerDevice()
+    {
+        const auto context = Context(nullptr, Logger(), TypeManager(), ModuleManager("[[none]]"), AuthenticationProvider());
+        auto device = Client(context, "dev");
+        for (SizeT i = 0; i < PropertyCount; ++i)
+            device.addProperty(IntProperty("Property" + std::to_string(i), static_cast<Int>(i)));
+        return device;
+    }
+
+    DevicePtr serverDevice;
+    ConfigProtocolServer server;
+    LatencyLoopback loopback;
+    ConfigProtocolClient<ConfigClientDeviceImpl> client;
+    DevicePtr clientDevice;
+    ConfigProtocolClientCommPtr clientComm;
+};
+
+}
+
+// Reads the properties of a remote device one request at a time; arg is the one-way link latency in microseconds.
+static void BM_ConfigGetPropertyValueSequential(benchmark::State& state)
+{
+    RpcFixture fixture(std::chrono::microseconds(state.range(0)));
+    const std::string globalId = fixture.serverDevice.getGlobalId();
+
+    for (auto _ : state)
+    {
+        for (SizeT i = 0; i < PropertyCount; ++i)
+            benchmark::DoNotOptimize(fixture.clientComm->getPropertyValue(globalId, "Property" + std::to_string(i)));
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * PropertyCount));
+}
+BENCHMARK(BM_ConfigGetPropertyValueSequential)->Arg(0)->Arg(1000)->Arg(5000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Same reads, but all requests are in flight before the first reply is awaited.
+static void BM_ConfigGetPropertyValuePipelined(benchmark::State& state)
+{
+    RpcFixture fixture(std::chrono::microseconds(state.range(0)));
+    const std::string globalId = fixture.serverDevice.getGlobalId();
+
+    std::vector<std::future<BaseObjectPtr>> values;
+    values.reserve(PropertyCount);
+
+    for (auto _ : state)
+    {
+        for (SizeT i = 0; i < PropertyCount; ++i)
+            values.push_back(fixture.clientComm->getPropertyValueAsync(globalId, "Property" + std::to_string(i)));
+
+        for (auto& value : values)
+            benchmark::DoNotOptimize(value.get());
+        values.clear();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * PropertyCount));
+}
+BENCHMARK(BM_ConfigGetPropertyValuePipelined)->Arg(0)->Arg(1000)->Arg(5000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Reads all property values of the remote component tree with the prefetch helper.
+static void BM_ConfigPrefetchPropertyValues(benchmark::State& state)
+{
+    RpcFixture fixture(std::chrono::microseconds(state.range(0)));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(fixture.clientComm->prefetchPropertyValues(fixture.clientDevice));
+}
+BENCHMARK(BM_ConfigPrefetchPropertyValues)->Arg(0)->Arg(1000)->Arg(5000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+namespace
+{
+
+// Creates a root device with width sub-devices, each having width sub-devices of its own, and returns the global IDs of the leaves
+DevicePtr createDeviceTree(SizeT width, std::vector<std::string>& leafIds)
+{
+    const auto context = Context(nullptr, Logger(), TypeManager(), ModuleManager("[[none]]"), AuthenticationProvider());
+    auto root = Client(context, "dev");
+
+    const FolderConfigPtr rootDevices = root.getItem("Dev");
+    for (SizeT i = 0; i < width; ++i)
+    {
+        auto device = Client(context, "dev" + std::to_string(i), nullptr, rootDevices);
+        rootDevices.addItem(device);
+
+        const FolderConfigPtr devices = device.getItem("Dev");
+        for (SizeT j = 0; j < width; ++j)
+        {
+            auto leaf = Client(context, "dev" + std::to_string(j), nullptr, devices);
+            devices.addItem(leaf);
+            leafIds.push_back(leaf.getGlobalId());
+        }
+    }
+
+    return root;
+}
+
+}
+
+// Resolves the global IDs of all leaf devices by walking the component tree; arg is the tree width.
+static void BM_ConfigFindComponentTreeWalk(benchmark::State& state)
+{
+    std::vector<std::string> leafIds;
+    const auto root = createDeviceTree(state.range(0), leafIds);
+
+    for (auto _ : state)
+    {
+        ComponentFinderRootDevice componentFinder(root);
+        for (const auto& id : leafIds)
+            benchmark::DoNotOptimize(componentFinder.findComponent(id));
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * leafIds.size()));
+    state.counters["Components"] = static_cast<double>(leafIds.size());
+}
+BENCHMARK(BM_ConfigFindComponentTreeWalk)->Arg(4)->Arg(16)->Arg(64);
+
+// Resolves the same global IDs from the index of an already warmed-up component finder.
+static void BM_ConfigFindComponentIndexed(benchmark::State& state)
+{
+    std::vector<std::string> leafIds;
+    const auto root = createDeviceTree(state.range(0), leafIds);
+
+    ComponentFinderRootDevice componentFinder(root);
+    for (const auto& id : leafIds)
+        componentFinder.findComponent(id);
+
+    for (auto _ : state)
+    {
+        for (const auto& id : leafIds)
+            benchmark::DoNotOptimize(componentFinder.findComponent(id));
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * leafIds.size()));
+    state.counters["Components"] = static_cast<double>(leafIds.size());
+}
+BENCHMARK(BM_ConfigFindComponentIndexed)->Arg(4)->Arg(16)->Arg(64);
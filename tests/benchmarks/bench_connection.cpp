@@ -0,0 +1,69 @@
+#include <opendaq/opendaq.h>
+#include <benchmark/benchmark.h>
+
+using namespace daq;
+
+namespace
+{
+
+struct ConnectionFixture
+{
+    ConnectionFixture()
+        : context(NullContext())
+        , descriptor(DataDescriptorBuilder().setSampleType(SampleType::Float64).build())
+        , signal(SignalWithDescriptor(context, descriptor, nullptr, "sig"))
+        , port(InputPort(context, nullptr, "ip"))
+    {
+        port.setNotificationMethod(PacketReadyNotification::None);
+        port.connect(signal);
+        connection = port.getConnection();
+        connection.dequeueAll();
+    }
+
+    ContextPtr context;
+    DataDescriptorPtr descriptor;
+    SignalConfigPtr signal;
+    InputPortConfigPtr port;
+    ConnectionPtr connection;
+};
+
+}
+
+// Enqueues a batch of packets one at a time and dequeues them one at a time.
+static void BM_ConnectionEnqueueDequeue(benchmark::State& state)
+{
+    ConnectionFixture fixture;
+    const auto packetCount = static_cast<SizeT>(state.range(0));
+    const auto packet = DataPacket(fixture.descriptor, 1);
+
+    for (auto _ : state)
+    {
+        for (SizeT i = 0; i < packetCount; ++i)
+            fixture.connection.enqueue(packet);
+
+        for (SizeT i = 0; i < packetCount; ++i)
+            benchmark::DoNotOptimize(fixture.connection.dequeue());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * packetCount));
+}
+BENCHMARK(BM_ConnectionEnqueueDequeue)->RangeMultiplier(4)->Range(1, 1024);
+
+// Enqueues a list of packets with a single call and drains the queue with dequeueAll.
+static void BM_ConnectionEnqueueMultipleDequeueAll(benchmark::State& state)
+{
+    ConnectionFixture fixture;
+    const auto packetCount = static_cast<SizeT>(state.range(0));
+    auto packets = List<IPacket>();
+    for (SizeT i = 0; i < packetCount; ++i)
+        packets.pushBack(DataPacket(fixture.descriptor, 1));
+
+    for (auto _ : state)
+    {
+        fixture.connection.enqueueMultiple(packets);
+        benchmark::DoNotOptimize(fixture.connection.dequeueAll());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * packetCount));
+}
+BENCHMARK(BM_ConnectionEnqueueMultipleDequeueAll)->RangeMultiplier(4)->Range(1, 1024);
@@ -0,0 +1,253 @@
+#include <opendaq/opendaq.h>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace daq;
+
+namespace
+{
+
+constexpr int64_t MinSampleCount = 1 << 8;
+constexpr int64_t MaxSampleCount = 1 << 16;
+constexpr SizeT BlockSize = 64;
+
+// Value signals with an implicit (linear rule) domain; all signals share the same domain parameters
+// so that they can also be read with a MultiReader.
+template <typename T>
+struct ReaderFixture
+{
+    explicit ReaderFixture(SizeT signalCount = 1)
+        : context(NullContext())
+        , domainDescriptor(DataDescriptorBuilder()
+                               .setSampleType(SampleType::Int64)
+                               .setRule(LinearDataRule(1, 0))
+                               .setOrigin("1970-01-01T00:00:00Z")
+                               .setTickResolution(Ratio(1, 1000000))
+                               .setUnit(Unit("s", -1, "seconds", "time"))
+                               .build())
+        , valueDescriptor(DataDescriptorBuilder().setSampleType(SampleTypeFromType<T>::SampleType).build())
+        , offset(0)
+    {
+        for (SizeT i = 0; i < signalCount; ++i)
+        {
+            auto domainSignal = SignalWithDescriptor(context, domainDescriptor, nullptr, "domain" + std::to_string(i));
+            auto signal = SignalWithDescriptor(context, valueDescriptor, nullptr, "sig" + std::to_string(i));
+            signal.setDomainSignal(domainSignal);
+            domainSignals.push_back(domainSignal);
+            signals.push_back(signal);
+        }
+    }
+
+    void sendPackets(SizeT sampleCount)
+    {
+        const auto domainPacket = DataPacket(domainDescriptor, sampleCount, offset);
+        for (const auto& signal : signals)
+            signal.sendPacket(DataPacketWithDomain(domainPacket, valueDescriptor, sampleCount));
+        offset += static_cast<Int>(sampleCount);
+    }
+
+    ListPtr<ISignal> getSignalList() const
+    {
+        auto list = List<ISignal>();
+        for (const auto& signal : signals)
+            list.pushBack(signal);
+        return list;
+    }
+
+    ContextPtr context;
+    DataDescriptorPtr domainDescriptor;
+    DataDescriptorPtr valueDescriptor;
+    std::vector<SignalConfigPtr> domainSignals;
+    std::vector<SignalConfigPtr> signals;
+    Int offset;
+};
+
+template <typename T>
+void setReaderCounters(benchmark::State& state, SizeT samplesPerIteration)
+{
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * samplesPerIteration * sizeof(T)));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * samplesPerIteration));
+}
+
+}
+
+// Throughput of reading values and domain through a StreamReader without sample type conversion.
+template <typename T>
+static void BM_StreamReaderRead(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    ReaderFixture<T> fixture;
+    auto reader = StreamReaderBuilder()
+                      .setSignal(fixture.signals[0])
+                      .setValueReadType(SampleTypeFromType<T>::SampleType)
+                      .setDomainReadType(SampleType::Int64)
+                      .setSkipEvents(true)
+                      .build();
+
+    std::vector<T> values(sampleCount);
+    std::vector<int64_t> domain(sampleCount);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        fixture.sendPackets(sampleCount);
+        state.ResumeTiming();
+
+        SizeT count = sampleCount;
+        reader.readWithDomain(values.data(), domain.data(), &count);
+        benchmark::DoNotOptimize(count);
+    }
+
+    setReaderCounters<T>(state, sampleCount);
+}
+BENCHMARK_TEMPLATE(BM_StreamReaderRead, int16_t)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_StreamReaderRead, int32_t)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_StreamReaderRead, float)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_StreamReaderRead, double)->Range(MinSampleCount, MaxSampleCount);
+
+// Same as above, but the reader converts the samples to double.
+template <typename T>
+static void BM_StreamReaderReadConverted(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    ReaderFixture<T> fixture;
+    auto reader = StreamReaderBuilder()
+                      .setSignal(fixture.signals[0])
+                      .setValueReadType(SampleType::Float64)
+                      .setDomainReadType(SampleType::Int64)
+                      .setSkipEvents(true)
+                      .build();
+
+    std::vector<double> values(sampleCount);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        fixture.sendPackets(sampleCount);
+        state.ResumeTiming();
+
+        SizeT count = sampleCount;
+        reader.read(values.data(), &count);
+        benchmark::DoNotOptimize(count);
+    }
+
+    setReaderCounters<T>(state, sampleCount);
+}
+BENCHMARK_TEMPLATE(BM_StreamReaderReadConverted, int16_t)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_StreamReaderReadConverted, int32_t)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_StreamReaderReadConverted, float)->Range(MinSampleCount, MaxSampleCount);
+
+// Throughput of reading whole blocks of values and domain through a BlockReader.
+template <typename T>
+static void BM_BlockReaderRead(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const SizeT blockCount = sampleCount / BlockSize;
+    ReaderFixture<T> fixture;
+    auto reader = BlockReaderBuilder()
+                      .setSignal(fixture.signals[0])
+                      .setBlockSize(BlockSize)
+                      .setValueReadType(SampleTypeFromType<T>::SampleType)
+                      .setDomainReadType(SampleType::Int64)
+                      .setSkipEvents(true)
+                      .build();
+
+    std::vector<T> values(blockCount * BlockSize);
+    std::vector<int64_t> domain(blockCount * BlockSize);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        fixture.sendPackets(blockCount * BlockSize);
+        state.ResumeTiming();
+
+        SizeT count = blockCount;
+        reader.readWithDomain(values.data(), domain.data(), &count);
+        benchmark::DoNotOptimize(count);
+    }
+
+    setReaderCounters<T>(state, blockCount * BlockSize);
+}
+BENCHMARK_TEMPLATE(BM_BlockReaderRead, int16_t)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_BlockReaderRead, int32_t)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_BlockReaderRead, float)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_BlockReaderRead, double)->Range(MinSampleCount, MaxSampleCount);
+
+// Throughput of reading the last `historySize` values and domain through a TailReader.
+template <typename T>
+static void BM_TailReaderRead(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    ReaderFixture<T> fixture;
+    auto reader = TailReaderBuilder()
+                      .setSignal(fixture.signals[0])
+                      .setHistorySize(sampleCount)
+                      .setValueReadType(SampleTypeFromType<T>::SampleType)
+                      .setDomainReadType(SampleType::Int64)
+                      .setSkipEvents(true)
+                      .build();
+
+    std::vector<T> values(sampleCount);
+    std::vector<int64_t> domain(sampleCount);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        fixture.sendPackets(sampleCount);
+        state.ResumeTiming();
+
+        SizeT count = sampleCount;
+        reader.readWithDomain(values.data(), domain.data(), &count);
+        benchmark::DoNotOptimize(count);
+    }
+
+    setReaderCounters<T>(state, sampleCount);
+}
+BENCHMARK_TEMPLATE(BM_TailReaderRead, int16_t)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_TailReaderRead, int32_t)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_TailReaderRead, float)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_TailReaderRead, double)->Range(MinSampleCount, MaxSampleCount);
+
+// Throughput of reading aligned values and domain of several signals through a MultiReader.
+template <typename T>
+static void BM_MultiReaderRead(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<SizeT>(state.range(0));
+    const auto signalCount = static_cast<SizeT>(state.range(1));
+    ReaderFixture<T> fixture(signalCount);
+    auto reader = MultiReaderBuilder()
+                      .addSignals(fixture.getSignalList())
+                      .setValueReadType(SampleTypeFromType<T>::SampleType)
+                      .setDomainReadType(SampleType::Int64)
+                      .setInputPortNotificationMethod(PacketReadyNotification::SameThread)
+                      .build();
+
+    SizeT count = 0;
+    reader.read(nullptr, &count);
+
+    std::vector<std::vector<T>> values(signalCount, std::vector<T>(sampleCount));
+    std::vector<std::vector<int64_t>> domain(signalCount, std::vector<int64_t>(sampleCount));
+    std::vector<void*> valuesPerSignal;
+    std::vector<void*> domainPerSignal;
+    for (SizeT i = 0; i < signalCount; ++i)
+    {
+        valuesPerSignal.push_back(values[i].data());
+        domainPerSignal.push_back(domain[i].data());
+    }
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        fixture.sendPackets(sampleCount);
+        state.ResumeTiming();
+
+        count = sampleCount;
+        reader.readWithDomain(valuesPerSignal.data(), domainPerSignal.data(), &count);
+        benchmark::DoNotOptimize(count);
+    }
+
+    setReaderCounters<T>(state, sampleCount * signalCount);
+    state.counters["signals"] = static_cast<double>(signalCount);
+}
+BENCHMARK_TEMPLATE(BM_MultiReaderRead, int32_t)->Ranges({{MinSampleCount, MaxSampleCount}, {2, 8}});
+BENCHMARK_TEMPLATE(BM_MultiReaderRead, double)->Ranges({{MinSampleCount, MaxSampleCount}, {2, 8}});
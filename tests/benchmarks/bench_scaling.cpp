@@ -0,0 +1,128 @@
+#include <opendaq/opendaq.h>
+#include <opendaq/scaling_kernels.h>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace daq;
+
+namespace
+{
+
+constexpr int64_t MinSampleCount = 1 << 10;
+constexpr int64_t MaxSampleCount = 1 << 20;
+
+template <typename T>
+std::vector<T> createInput(size_t count)
+{
+    std::vector<T> input(count);
+    for (size_t i = 0; i < count; ++i)
+        input[i] = static_cast<T>(i % 127);
+    return input;
+}
+
+}
+
+// Throughput of the dispatched (vectorized where available) linear scaling kernel.
+template <typename T, typename U>
+static void BM_ScaleLinear(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto input = createInput<T>(count);
+    std::vector<U> output(count);
+
+    for (auto _ : state)
+    {
+        kernels::scaleLinear(input.data(), output.data(), count, static_cast<U>(0.5), static_cast<U>(10));
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * count * (sizeof(T) + sizeof(U))));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+// Same as above, using the scalar loop as a baseline.
+template <typename T, typename U>
+static void BM_ScaleLinearScalar(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto input = createInput<T>(count);
+    std::vector<U> output(count);
+
+    for (auto _ : state)
+    {
+        kernels::scaleLinearScalar(input.data(), output.data(), count, static_cast<U>(0.5), static_cast<U>(10));
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * count * (sizeof(T) + sizeof(U))));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+BENCHMARK_TEMPLATE(BM_ScaleLinear, int16_t, float)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_ScaleLinearScalar, int16_t, float)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_ScaleLinear, int32_t, double)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_ScaleLinearScalar, int32_t, double)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_ScaleLinear, uint8_t, float)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_ScaleLinearScalar, uint8_t, float)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_ScaleLinear, double, double)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_ScaleLinearScalar, double, double)->Range(MinSampleCount, MaxSampleCount);
+
+// Throughput of the linear data rule kernel (implicit domain values).
+template <typename T>
+static void BM_LinearRule(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    std::vector<T> output(count);
+
+    for (auto _ : state)
+    {
+        kernels::linearRule(output.data(), count, static_cast<T>(10), static_cast<T>(1000));
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * count * sizeof(T)));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+BENCHMARK_TEMPLATE(BM_LinearRule, int64_t)->Range(MinSampleCount, MaxSampleCount);
+BENCHMARK_TEMPLATE(BM_LinearRule, double)->Range(MinSampleCount, MaxSampleCount);
+
+// End-to-end cost of getting scaled data from a freshly created data packet.
+static void BM_DataPacketGetScaledData(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto descriptor = DataDescriptorBuilder()
+                                .setSampleType(SampleType::Float64)
+                                .setPostScaling(LinearScaling(0.5, 10, SampleType::Int32, ScaledSampleType::Float64))
+                                .build();
+
+    for (auto _ : state)
+    {
+        const auto packet = DataPacket(descriptor, count);
+        benchmark::DoNotOptimize(packet.getData());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * count * (sizeof(int32_t) + sizeof(double))));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_DataPacketGetScaledData)->Range(MinSampleCount, MaxSampleCount);
+
+// End-to-end cost of getting the values of a freshly created implicit (linear rule) domain packet.
+static void BM_DataPacketGetImplicitData(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Int64).setRule(LinearDataRule(10, 1000)).build();
+
+    for (auto _ : state)
+    {
+        const auto packet = DataPacket(descriptor, count, 0);
+        benchmark::DoNotOptimize(packet.getData());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * count * sizeof(int64_t)));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_DataPacketGetImplicitData)->Range(MinSampleCount, MaxSampleCount);
@@ -0,0 +1,108 @@
+#include <opendaq/opendaq.h>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace daq;
+
+namespace
+{
+
+constexpr SizeT PacketsPerIteration = 256;
+
+struct FanOutFixture
+{
+    explicit FanOutFixture(SizeT connectionCount)
+        : context(NullContext())
+        , descriptor(DataDescriptorBuilder().setSampleType(SampleType::Float64).build())
+        , signal(SignalWithDescriptor(context, descriptor, nullptr, "sig"))
+    {
+        for (SizeT i = 0; i < connectionCount; ++i)
+        {
+            auto port = InputPort(context, nullptr, "ip" + std::to_string(i));
+            port.setNotificationMethod(PacketReadyNotification::None);
+            port.connect(signal);
+            ports.push_back(port);
+            connections.push_back(port.getConnection());
+        }
+    }
+
+    void drain()
+    {
+        for (const auto& connection : connections)
+            connection.dequeueAll();
+    }
+
+    ContextPtr context;
+    DataDescriptorPtr descriptor;
+    SignalConfigPtr signal;
+    std::vector<InputPortConfigPtr> ports;
+    std::vector<ConnectionPtr> connections;
+};
+
+}
+
+// Measures the throughput of sending one packet to a signal with a growing number of connections.
+static void BM_SignalSendPacket(benchmark::State& state)
+{
+    FanOutFixture fixture(static_cast<SizeT>(state.range(0)));
+    const auto packet = DataPacket(fixture.descriptor, 1);
+    fixture.drain();
+
+    for (auto _ : state)
+    {
+        for (SizeT i = 0; i < PacketsPerIteration; ++i)
+            fixture.signal.sendPacket(packet);
+
+        state.PauseTiming();
+        fixture.drain();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * PacketsPerIteration));
+    state.counters["connections"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_SignalSendPacket)->RangeMultiplier(2)->Range(1, 64);
+
+// Same as above, but the packet reference is handed over to the signal.
+static void BM_SignalSendPacketAndStealRef(benchmark::State& state)
+{
+    FanOutFixture fixture(static_cast<SizeT>(state.range(0)));
+    fixture.drain();
+
+    for (auto _ : state)
+    {
+        for (SizeT i = 0; i < PacketsPerIteration; ++i)
+            fixture.signal.sendPacket(DataPacket(fixture.descriptor, 1));
+
+        state.PauseTiming();
+        fixture.drain();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * PacketsPerIteration));
+    state.counters["connections"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_SignalSendPacketAndStealRef)->RangeMultiplier(2)->Range(1, 64);
+
+// Measures the throughput of sending a list of packets with a single call.
+static void BM_SignalSendPackets(benchmark::State& state)
+{
+    FanOutFixture fixture(static_cast<SizeT>(state.range(0)));
+    auto packets = List<IPacket>();
+    for (SizeT i = 0; i < PacketsPerIteration; ++i)
+        packets.pushBack(DataPacket(fixture.descriptor, 1));
+    fixture.drain();
+
+    for (auto _ : state)
+    {
+        fixture.signal.sendPackets(packets);
+
+        state.PauseTiming();
+        fixture.drain();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * PacketsPerIteration));
+    state.counters["connections"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_SignalSendPackets)->RangeMultiplier(2)->Range(1, 64);
@@ -1773,6 +1773,41 @@ TEST_F(NativeDeviceModulesTest, SubscribeReadUnsubscribe)
     ASSERT_EQ(domainUnsubscribeFuture.get(), streamingSource);
 }
 
+TEST_F(NativeDeviceModulesTest, ReadInNotificationReadMode)
+{
+    SKIP_TEST_MAC_CI;
+    auto server = CreateDefaultServerInstance();
+    auto serverConfig = server.getAvailableServerTypes().get("OpenDAQNativeStreaming").createDefaultConfig();
+    serverConfig.setPropertyValue("StreamingDataReadMode", 1);
+    const auto nativeServer = server.addServer("OpenDAQNativeStreaming", serverConfig);
+
+    auto client = CreateClientInstance();
+
+    auto device = client.getDevices()[0].getDevices()[0];
+    const auto signal = device.getChannels()[0].getSignals(search::Recursive(search::Visible()))[0];
+
+    StreamReaderPtr reader = daq::StreamReader<double, uint64_t>(signal, ReadTimeoutType::Any);
+
+    {
+        daq::SizeT count = 0;
+        reader.read(nullptr, &count, 1000);
+    }
+
+    double samples[100];
+    for (int i = 0; i < 5; ++i)
+    {
+        daq::SizeT count = 100;
+        reader.read(samples, &count, 1000);
+        EXPECT_GT(count, 0u) << "iteration " << i;
+    }
+
+    ListPtr<IInteger> histogram = nativeServer.getPropertyValue("StreamingLatencyHistogram");
+    Int readCycles = 0;
+    for (const auto& bucketCount : histogram)
+        readCycles += bucketCount;
+    ASSERT_GT(readCycles, 0);
+}
+
 TEST_F(NativeDeviceModulesTest, DISABLED_RendererSimple)
 {
     SKIP_TEST_MAC_CI;